@@ -18,4 +18,28 @@
 #define ADC_SAMPLE_POWER    0x0F   // (15 in decimal) Max pow of 2 that can be given as arg 
                                        // for M234/5.
 
+/* Background sampler */
+/*--------------------*/
+// Channel 0 (EXT_ADC_RAW_0) is converted continuously from idle() while
+// anything reads it, so M234/M235/M238 and the bed leveling probe wait in
+// idle() instead of delay().
+
+#define ADC_SAMPLER_RING_POWER  4       // ADC_sampler_filtered() averages 2^4 conversions
+#define ADC_SAMPLER_KEEPALIVE   10000   // (ms) Keep sampling this long after the last read
+#define ADC_SAMPLER_MAX_ERRORS  5       // Failed transfers in a row before the sampler stops
+
+void ADC_sampler_update(void);
+
+uint16_t ADC_sampler_count(void);
+
+uint32_t ADC_sampler_sum(void);
+
+bool ADC_sampler_busy(void);
+
+uint16_t ADC_sampler_latest(void);
+
+uint16_t ADC_sampler_filtered(void);
+
+bool ADC_sampler_failed(void);
+
 #endif // EXT_ADC.h
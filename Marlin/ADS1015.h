@@ -9,7 +9,6 @@
 #define ADS1015_H
 
 #include "Arduino.h"
-#include <Wire.h>
 #include "Configuration.h"
 #include "DistanceSensor.h"
 
@@ -118,6 +117,10 @@
 /* Function Prototypes */
 /*=====================*/
 
+uint16_t configADC_SingleEnded(uint8_t channel);
+
+uint16_t configADC_Differential(uint8_t first_channel, uint8_t second_channel);
+
 uint16_t readADC_SingleEnded(uint8_t channel);
 
 uint16_t readADC_Differential(uint8_t first_channel, uint8_t second_channel);
@@ -8,15 +8,73 @@
 
 #if ENABLED(EXT_ADC)
 
+#include "Marlin.h"
+#include "language.h"
 #include "ADC.h"
+#include "TwiQueue.h"
+
+#if EXT_ADC == 1
+    #define ADS_I2C_ADDRESS         ADS1115_I2C_ADDRESS
+    #define ADS_CONVERSION_DELAY    ADS1115_CONVERSION_DELAY
+    #define ADS_CONVERSION_REG      ADS1115_CONVERSION_REG
+    #define ADS_CONFIG_REG          ADS1115_CONFIG_REG
+    #define ADS_OS_NOTBUSY          ADS1115_OS_NOTBUSY
+#elif EXT_ADC == 2
+    #define ADS_I2C_ADDRESS         ADS1015_I2C_ADDRESS
+    #define ADS_CONVERSION_DELAY    ADS1015_CONVERSION_DELAY
+    #define ADS_CONVERSION_REG      ADS1015_CONVERSION_REG
+    #define ADS_CONFIG_REG          ADS1015_CONFIG_REG
+    #define ADS_OS_NOTBUSY          ADS1015_OS_NOTBUSY
+#endif
+
+// Channel sampled in the background, as read by EXT_ADC_RAW_0
+#if EXT_ADC_MODE == 2
+    #define SAMPLER_CONFIG  configADC_Differential(0, 1)
+#else
+    #define SAMPLER_CONFIG  configADC_SingleEnded(0)
+#endif
+
+#define SAMPLER_RING_SIZE   (1 << ADC_SAMPLER_RING_POWER)
+#define SAMPLER_RING_MASK   (SAMPLER_RING_SIZE - 1)
 
 uint16_t ADC_val = 0;
 
+// Background sampler state. A step either waits on the conversion or on a
+// transfer queued by the previous step, never on the bus.
+#define SAMPLER_IDLE        0
+#define SAMPLER_CONVERTING  1                   // Config written, waiting
+#define SAMPLER_POLLING     2                   // Config register read queued
+#define SAMPLER_READING     3                   // Conversion register read queued
+
+static uint8_t sampler_state = SAMPLER_IDLE;
+static volatile uint8_t sampler_status = TWI_STATUS_OK;
+static uint8_t sampler_rx[2];
+static unsigned long sampler_started_ms;        // Start of the current conversion
+static unsigned long sampler_polled_ms;         // Last read of the OS bit
+static unsigned long sampler_requested_ms;      // Last call to ADC_sampler_count()
+static bool sampler_requested = false;
+static uint8_t sampler_errors = 0;              // Failed transfers in a row
+static bool sampler_failed = false;             // Stopped after ADC_SAMPLER_MAX_ERRORS
+static unsigned long sampler_failed_ms;
+static uint16_t sampler_ring[SAMPLER_RING_SIZE];
+static uint8_t sampler_ring_index = 0;
+static uint8_t sampler_ring_fill = 0;           // Conversions in the ring, up to SAMPLER_RING_SIZE
+static uint32_t sampler_ring_sum = 0;
+static uint16_t sampler_count = 0;              // Conversions completed (wraps)
+static uint32_t sampler_sum = 0;                // Sum of all conversions (wraps)
+
+static uint16_t convert(uint16_t config);
+static bool samplerTransferFailed(void);
+static uint16_t regReadRaw(uint8_t address, uint8_t reg);
+static void regQueueRead(uint8_t address, uint8_t reg, volatile uint8_t *status, uint8_t *rx);
+
 /*================================================================================*/
-/*                   GET SINGLE READING FROM ADC (Single-Ended)                   */
+/*                   CONFIG REGISTER VALUE (Single-Ended)                         */
 /*================================================================================*/
 
-uint16_t readADC_SingleEnded(uint8_t channel) {
+// Returns the config register value that starts a conversion, or 0 if the
+// channel is invalid
+uint16_t configADC_SingleEnded(uint8_t channel) {
     
     if(channel > 3) {
         return 0;
@@ -50,13 +108,7 @@ uint16_t readADC_SingleEnded(uint8_t channel) {
         // set conversion bit
         config |= ADS1115_OS_SINGLE;
 
-        // write config settings to config register
-        regWrite(ADS1115_I2C_ADDRESS, ADS1115_CONFIG_REG, config);
-    
-       // delay for 8ms (wait for conversion to finish)
-        delay(ADS1115_CONVERSION_DELAY);
-    
-        ADC_val = regRead(ADS1115_I2C_ADDRESS, ADS1115_CONVERSION_REG);
+        return config;
     
       #elif EXT_ADC == 2
         uint16_t config =   ADS1015_MODE_SINGLE | ADS1015_DR_1600 |
@@ -86,24 +138,20 @@ uint16_t readADC_SingleEnded(uint8_t channel) {
         // set conversion bit
         config |= ADS1015_OS_SINGLE;
 
-        // write config settings to config register
-        regWrite(ADS1015_I2C_ADDRESS, ADS1015_CONFIG_REG, config);
-    
-        // delay for 8ms (wait for conversion to finish)
-        delay(ADS1015_CONVERSION_DELAY);
-    
-        ADC_val = regRead(ADS1015_I2C_ADDRESS, ADS1015_CONVERSION_REG);
+        return config;
 
     #endif
 
-    return ADC_val;
+    return 0;
 }
 
 /*================================================================================*/
-/*                   GET SINGLE READING FROM ADC (Differential)                   */
+/*                   CONFIG REGISTER VALUE (Differential)                         */
 /*================================================================================*/
 
-uint16_t readADC_Differential(uint8_t first_channel, uint8_t second_channel) {
+// Returns the config register value that starts a conversion, or 0 if the
+// channel pair is invalid
+uint16_t configADC_Differential(uint8_t first_channel, uint8_t second_channel) {
     
      // general values for config register
     #if EXT_ADC == 1
@@ -133,13 +181,7 @@ uint16_t readADC_Differential(uint8_t first_channel, uint8_t second_channel) {
         // set conversion bit
         config |= ADS1115_OS_SINGLE;
 
-        // write config settings to config register
-        regWrite(ADS1115_I2C_ADDRESS, ADS1115_CONFIG_REG, config);
-    
-        // delay for 8ms (wait for conversion to finish)
-        delay(ADS1115_CONVERSION_DELAY);
-    
-        ADC_val = regRead(ADS1115_I2C_ADDRESS, ADS1115_CONVERSION_REG);
+        return config;
 
     #elif EXT_ADC == 2
         uint16_t config =   ADS1015_MODE_SINGLE | ADS1015_DR_1600 |
@@ -168,29 +210,214 @@ uint16_t readADC_Differential(uint8_t first_channel, uint8_t second_channel) {
         // set conversion bit
         config |= ADS1015_OS_SINGLE;
 
-        // write config settings to config register
-        regWrite(ADS1015_I2C_ADDRESS, ADS1015_CONFIG_REG, config);
-    
-        // delay for 8ms (wait for conversion to finish)
-        delay(ADS1015_CONVERSION_DELAY);
-    
-        ADC_val = regRead(ADS1015_I2C_ADDRESS, ADS1015_CONVERSION_REG);
+        return config;
             
     #endif
     
+    return 0;
+}
+
+/*================================================================================*/
+/*                   GET SINGLE READING FROM ADC (Single-Ended)                   */
+/*================================================================================*/
+
+uint16_t readADC_SingleEnded(uint8_t channel) {
+    uint16_t config = configADC_SingleEnded(channel);
+    if(!config) {
+        return 0;
+    }
+    ADC_val = convert(config);
+    return ADC_val;
+}
+
+/*================================================================================*/
+/*                   GET SINGLE READING FROM ADC (Differential)                   */
+/*================================================================================*/
+
+uint16_t readADC_Differential(uint8_t first_channel, uint8_t second_channel) {
+    uint16_t config = configADC_Differential(first_channel, second_channel);
+    if(!config) {
+        return 0;
+    }
+    ADC_val = convert(config);
     return ADC_val;
 }
 
+/*================================================================================*/
+/*                        BLOCKING CONVERSION (polls OS bit)                      */
+/*================================================================================*/
+
+// Starts a conversion and waits until the OS bit reports it done, instead of
+// a fixed ADS_CONVERSION_DELAY. Aborts any conversion of the background
+// sampler, since the new config replaces its channel.
+static uint16_t convert(uint16_t config) {
+    TwiQueue__Wait(&sampler_status);
+    sampler_state = SAMPLER_IDLE;
+    regWrite(ADS_I2C_ADDRESS, ADS_CONFIG_REG, config);
+
+    unsigned long started_ms = millis();
+    while(!(regReadRaw(ADS_I2C_ADDRESS, ADS_CONFIG_REG) & ADS_OS_NOTBUSY)) {
+        // Give up after twice the nominal conversion time and read anyway
+        if(millis() - started_ms > 2 * ADS_CONVERSION_DELAY) {
+            break;
+        }
+    }
+    return regRead(ADS_I2C_ADDRESS, ADS_CONVERSION_REG);
+}
+
+/*================================================================================*/
+/*                        BACKGROUND SAMPLER (called from idle)                   */
+/*================================================================================*/
+
+// One step of the sampler: polls the OS bit of a running conversion, stores
+// a finished one and starts the next. Register reads are queued and picked
+// up by a later step, so this never waits on the ADC or the bus. Sampling
+// stops ADC_SAMPLER_KEEPALIVE ms after the last ADC_sampler_count() call,
+// or after ADC_SAMPLER_MAX_ERRORS failed transfers in a row.
+void ADC_sampler_update(void) {
+    if(!sampler_requested || sampler_status == TWI_STATUS_PENDING) {
+        return;
+    }
+    unsigned long ms = millis();
+
+    if(ms - sampler_requested_ms > ADC_SAMPLER_KEEPALIVE) {
+        sampler_requested = false;
+        sampler_state = SAMPLER_IDLE;
+        return;
+    }
+
+    switch(sampler_state) {
+    case SAMPLER_CONVERTING:
+        // Don't poll before the conversion can be done, and at most once per ms
+        if(ms - sampler_started_ms < ADS_CONVERSION_DELAY - 1 || ms == sampler_polled_ms) {
+            return;
+        }
+        sampler_polled_ms = ms;
+        regQueueRead(ADS_I2C_ADDRESS, ADS_CONFIG_REG, &sampler_status, sampler_rx);
+        sampler_state = SAMPLER_POLLING;
+        return;
+
+    case SAMPLER_POLLING:
+        if(samplerTransferFailed()) {
+            return;
+        }
+        if((sampler_rx[0] << 8) & ADS_OS_NOTBUSY) {
+            regQueueRead(ADS_I2C_ADDRESS, ADS_CONVERSION_REG, &sampler_status, sampler_rx);
+            sampler_state = SAMPLER_READING;
+        }
+        else {
+            sampler_state = SAMPLER_CONVERTING;
+        }
+        return;
+
+    case SAMPLER_READING:
+        // A failed read loses the sample, the next conversion starts anyway
+        if(!samplerTransferFailed()) {
+            #if EXT_ADC == 1
+                uint16_t sample = (sampler_rx[0] << 8) | sampler_rx[1];
+            #elif EXT_ADC == 2
+                uint16_t sample = ((sampler_rx[0] << 8) | sampler_rx[1]) >> 4;
+            #endif
+            ADC_val = sample;
+            sampler_ring_sum -= sampler_ring[sampler_ring_index];
+            sampler_ring_sum += sample;
+            sampler_ring[sampler_ring_index] = sample;
+            sampler_ring_index = (sampler_ring_index + 1) & SAMPLER_RING_MASK;
+            if(sampler_ring_fill < SAMPLER_RING_SIZE) {
+                sampler_ring_fill++;
+            }
+            sampler_sum += sample;
+            sampler_count++;
+        }
+        else {
+            return;
+        }
+        sampler_state = SAMPLER_IDLE;
+        break;
+    }
+
+    regWrite(ADS_I2C_ADDRESS, ADS_CONFIG_REG, SAMPLER_CONFIG);
+    sampler_started_ms = ms;
+    sampler_state = SAMPLER_CONVERTING;
+}
+
+// Number of conversions completed so far. Starts the sampler if it is
+// stopped and keeps it running. After a failure it only retries once
+// ADC_SAMPLER_KEEPALIVE ms have passed.
+uint16_t ADC_sampler_count(void) {
+    sampler_requested_ms = millis();
+    if(sampler_failed && sampler_requested_ms - sampler_failed_ms > ADC_SAMPLER_KEEPALIVE) {
+        sampler_failed = false;
+    }
+    if(!sampler_failed) {
+        sampler_requested = true;
+    }
+    return sampler_count;
+}
+
+// true while the sampler is stopped because the ADC does not respond
+bool ADC_sampler_failed(void) {
+    return sampler_failed;
+}
+
+// Sum of all conversions so far. The difference of two readings divided by
+// the difference of the counts is the average over that window.
+uint32_t ADC_sampler_sum(void) {
+    return sampler_sum;
+}
+
+// true while a conversion of the sampler is running
+bool ADC_sampler_busy(void) {
+    return sampler_state != SAMPLER_IDLE;
+}
+
+// Last conversion of the sampler
+uint16_t ADC_sampler_latest(void) {
+    return sampler_ring[(sampler_ring_index - 1) & SAMPLER_RING_MASK];
+}
+
+// Moving average of the last 2^ADC_SAMPLER_RING_POWER conversions, or of
+// those collected so far while the ring fills
+uint16_t ADC_sampler_filtered(void) {
+    if(sampler_ring_fill < SAMPLER_RING_SIZE) {
+        return sampler_ring_fill ? sampler_ring_sum / sampler_ring_fill : 0;
+    }
+    return sampler_ring_sum >> ADC_SAMPLER_RING_POWER;
+}
+
+// Checks the transfer queued by the last step. A failed one restarts the
+// conversion, and ADC_SAMPLER_MAX_ERRORS of them in a row stop the sampler.
+// Returns true if the transfer failed.
+static bool samplerTransferFailed(void) {
+    if(sampler_status == TWI_STATUS_OK) {
+        sampler_errors = 0;
+        return false;
+    }
+    sampler_state = SAMPLER_IDLE;
+    if(++sampler_errors < ADC_SAMPLER_MAX_ERRORS) {
+        // Start over with a new conversion
+        regWrite(ADS_I2C_ADDRESS, ADS_CONFIG_REG, SAMPLER_CONFIG);
+        sampler_started_ms = millis();
+        sampler_state = SAMPLER_CONVERTING;
+        return true;
+    }
+    sampler_errors = 0;
+    sampler_requested = false;
+    sampler_failed = true;
+    sampler_failed_ms = millis();
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_EXT_ADC_FAILED);
+    return true;
+}
+
 /*================================================================================*/
 /*                               WRITE TO A REGISTER                              */
 /*================================================================================*/
 
 void regWrite(uint8_t address, uint8_t reg, uint16_t value) {
-    Wire.beginTransmission(address);
-    Wire.write((uint8_t)reg);               // select register
-    Wire.write((uint8_t)(value >> 8));      // write first byte
-    Wire.write((uint8_t)(value & 0xFF));    // write second byte
-    Wire.endTransmission();
+    // register, first byte, second byte; queued without waiting
+    uint8_t packet[3] = { reg, (uint8_t)(value >> 8), (uint8_t)(value & 0xFF) };
+    TwiQueue__Write(address, packet, sizeof(packet));
 }
 
 /*================================================================================*/
@@ -198,25 +425,35 @@ void regWrite(uint8_t address, uint8_t reg, uint16_t value) {
 /*================================================================================*/
 
 uint16_t regRead(uint8_t address, uint8_t reg) {
-    Wire.beginTransmission(address);
-    Wire.write(reg);                        // select register
-    Wire.endTransmission();
-    Wire.requestFrom(address, (uint8_t)2);
-    
     #if EXT_ADC == 1
-        uint16_t volatile ADC_raw = (Wire.read() << 8) | Wire.read();
+        uint16_t volatile ADC_raw = regReadRaw(address, reg);
     #elif EXT_ADC == 2
-        uint16_t volatile ADC_raw = ( (Wire.read() << 8) | Wire.read() ) >> 4;
+        uint16_t volatile ADC_raw = regReadRaw(address, reg) >> 4;
     #endif
 
     return ADC_raw;
 }
+
+// The register as sent, without the ADS1015 conversion shift
+static uint16_t regReadRaw(uint8_t address, uint8_t reg) {
+    volatile uint8_t status;
+    uint8_t value[2] = { 0, 0 };
+    regQueueRead(address, reg, &status, value);
+    TwiQueue__Wait(&status);
+    return (value[0] << 8) | value[1];      // MSB first
+}
+
+// Selects the register and reads its two bytes after a repeated start
+static void regQueueRead(uint8_t address, uint8_t reg, volatile uint8_t *status, uint8_t *rx) {
+    TwiQueue__Transfer(address, &reg, 1, rx, 2, status, NULL);
+}
+
 /*================================================================================*/
 /*                              INITIALIZE I2C COMM                               */
 /*================================================================================*/
 
 void ADC_i2c_init(void) {
-    Wire.begin();
+    TwiQueue__Init();
 }
 
 #endif
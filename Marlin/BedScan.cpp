@@ -0,0 +1,284 @@
+/**
+ * BedScan.cpp - Laser bed mapping while moving.
+ * Binning of laser samples into a height grid; the raster moves themselves
+ * are planned by G29 in Marlin_main.cpp. See BedScan.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "BedScan.h"
+
+#if ENABLED(LASER_BED_SCAN)
+
+#include "stepper.h"
+#include "planner.h"
+#include "ADC.h"
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define SCAN_EMPTY (-32767 - 1) // Height of a cell without a sample
+#define SCAN_CELL_MAX_COUNT 255
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+// Heights in um relative to LDIST_OFFSET, [x][y]
+static int16_t scanHeight[SCAN_GRID_POINTS][SCAN_GRID_POINTS];
+
+// Row being binned
+static bool rowOpen = false;
+static uint8_t rowIndex;
+static int32_t rowSum[SCAN_GRID_POINTS];
+static uint8_t rowCount[SCAN_GRID_POINTS];
+
+// Head position and stepper counts when the row was opened
+static float refX, refY;
+static long refA, refB;
+
+// Stepper counts at the end of the previous conversion
+static uint16_t lastSampleCount;
+static bool lastSampleValid;
+static long lastA, lastB;
+
+// Least squares plane, z = planeZ + planeDX * (x - center) + planeDY * (y - center)
+static float planeZ, planeDX, planeDY;
+
+#if ENABLED(LASER_MESH_LEVELING)
+  static int16_t scanMean;  // um, of the last finished scan
+
+  // The mesh is a copy of a scan, so a dry run scan leaves it alone
+  static int16_t meshHeight[SCAN_GRID_POINTS][SCAN_GRID_POINTS];
+  static bool meshValid = false;
+  static bool meshActive = false;
+  static int16_t meshMean;  // um, subtracted so corrections stay small
+#endif
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static void _bin_sample(long a, long b, uint16_t raw);
+static void _fill_line(int16_t *line, uint8_t stride);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Clears the grid before a new scan.
+ */
+void BedScan__Start(void) {
+  for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++)
+    for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++)
+      scanHeight[i][j] = SCAN_EMPTY;
+  rowOpen = false;
+  planeZ = planeDX = planeDY = 0;
+}
+
+/**
+ * Starts binning samples into a row, with the head standing still at
+ * current_position.
+ */
+void BedScan__BeginRow(uint8_t row) {
+  for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++) {
+    rowSum[i] = 0;
+    rowCount[i] = 0;
+  }
+  rowIndex = row;
+  refX = current_position[X_AXIS] + X_PROBE_OFFSET_FROM_EXTRUDER;
+  refY = current_position[Y_AXIS] + Y_PROBE_OFFSET_FROM_EXTRUDER;
+  refA = st_get_position(X_AXIS);
+  refB = st_get_position(Y_AXIS);
+  lastSampleCount = ADC_sampler_count();
+  lastSampleValid = false;
+  rowOpen = true;
+}
+
+/**
+ * Takes a new sample from the ADC sampler while a row is open. A conversion
+ * ends where the next one starts, so a sample is placed halfway between the
+ * positions at which it and the previous sample were collected.
+ */
+void BedScan__Update(void) {
+  if (!rowOpen) return;
+
+  uint16_t count = ADC_sampler_count(); // Also keeps the sampler running
+  if (count == lastSampleCount) return;
+
+  long a = st_get_position(X_AXIS),
+       b = st_get_position(Y_AXIS);
+  if (lastSampleValid && (uint16_t)(count - lastSampleCount) == 1)
+    _bin_sample((a + lastA) / 2, (b + lastB) / 2, ADC_sampler_latest());
+
+  lastSampleCount = count;
+  lastSampleValid = true;
+  lastA = a;
+  lastB = b;
+}
+
+/**
+ * Stores the averages of the open row as heights.
+ * @returns  Number of cells in the row that got no sample
+ */
+uint8_t BedScan__EndRow(void) {
+  uint8_t empty = 0;
+  rowOpen = false;
+  for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++) {
+    if (rowCount[i])
+      scanHeight[i][rowIndex] = rowSum[i] / rowCount[i];
+    else
+      empty++;
+  }
+  return empty;
+}
+
+/**
+ * Fills cells without a sample along their row, then rows without a sample
+ * along the columns, and fits a plane to the grid. The grid is regular and
+ * complete after filling, so the least squares slopes reduce to independent
+ * sums over centered coordinates.
+ */
+bool BedScan__Finish(void) {
+  for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++)
+    _fill_line(&scanHeight[0][j], SCAN_GRID_POINTS);
+  for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++)
+    _fill_line(&scanHeight[i][0], 1);
+  if (scanHeight[0][0] == SCAN_EMPTY) return false;
+
+  const float center = (SCAN_GRID_POINTS - 1) / 2.0;
+  float sum = 0, sum_x = 0, sum_y = 0, sum_sq = 0;
+  for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++) {
+    for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++) {
+      float z = scanHeight[i][j];
+      sum += z;
+      sum_x += (i - center) * z;
+      sum_y += (j - center) * z;
+    }
+    sum_sq += (i - center) * (i - center);
+  }
+  sum_sq *= SCAN_GRID_POINTS;
+
+  planeZ = sum / (SCAN_GRID_POINTS * SCAN_GRID_POINTS) / LDIST_UNIT_DIVISOR;
+  planeDX = sum_x / sum_sq / LDIST_UNIT_DIVISOR / SCAN_X_DIST;
+  planeDY = sum_y / sum_sq / LDIST_UNIT_DIVISOR / SCAN_Y_DIST;
+  #if ENABLED(LASER_MESH_LEVELING)
+    scanMean = lround(sum / (SCAN_GRID_POINTS * SCAN_GRID_POINTS));
+  #endif
+  return true;
+}
+
+/**
+ * @returns  Height at grid point (i, j), in mm
+ */
+float BedScan__Height(uint8_t i, uint8_t j) {
+  return (float)scanHeight[i][j] / LDIST_UNIT_DIVISOR;
+}
+
+/**
+ * @returns  Height of the least squares plane at (x, y), in mm
+ */
+float BedScan__PlaneHeight(float x, float y) {
+  return planeZ
+       + planeDX * (x - (LEFT_SCAN_BED_POSITION + RIGHT_SCAN_BED_POSITION) / 2.0)
+       + planeDY * (y - (FRONT_SCAN_BED_POSITION + BACK_SCAN_BED_POSITION) / 2.0);
+}
+
+#if ENABLED(LASER_MESH_LEVELING)
+
+  /**
+   * Copies the grid of the last BedScan__Finish() into the mesh.
+   */
+  void BedScan__StoreMesh(void) {
+    memcpy(meshHeight, scanHeight, sizeof(meshHeight));
+    meshMean = scanMean;
+    meshValid = true;
+  }
+
+  /**
+   * Turns mesh compensation on or off, if the grid is complete.
+   */
+  bool BedScan__SetMeshActive(bool value) {
+    meshActive = value && meshValid;
+    return meshActive;
+  }
+
+  bool BedScan__MeshActive(void) { return meshActive; }
+
+  /**
+   * Bilinear height of the grid at (x, y) relative to the grid mean, in mm.
+   * The cell comes from the reciprocal of the grid spacing, not a search.
+   */
+  float BedScan__MeshZ(float x, float y) {
+    float fx = (x - LEFT_SCAN_BED_POSITION) * SCAN_X_DIST_INV,
+          fy = (y - FRONT_SCAN_BED_POSITION) * SCAN_Y_DIST_INV;
+    fx = constrain(fx, 0, SCAN_GRID_POINTS - 1);
+    fy = constrain(fy, 0, SCAN_GRID_POINTS - 1);
+
+    uint8_t i = min((uint8_t)fx, SCAN_GRID_POINTS - 2),
+            j = min((uint8_t)fy, SCAN_GRID_POINTS - 2);
+    fx -= i;
+    fy -= j;
+
+    float z0 = meshHeight[i][j] + (meshHeight[i + 1][j] - meshHeight[i][j]) * fx,
+          z1 = meshHeight[i][j + 1] + (meshHeight[i + 1][j + 1] - meshHeight[i][j + 1]) * fx;
+    return (z0 + (z1 - z0) * fy - meshMean) * (1.0 / LDIST_UNIT_DIVISOR);
+  }
+
+#endif // LASER_MESH_LEVELING
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * Adds a raw laser reading taken at stepper counts (a, b) to its cell, if it
+ * lies in the open row.
+ */
+static void _bin_sample(long a, long b, uint16_t raw) {
+  long da = a - refA, db = b - refB;
+  #if ENABLED(COREXY)
+    // Motor A moves X+Y, motor B moves X-Y
+    float x = refX + (da + db) / 2.0 / axis_steps_per_unit[X_AXIS],
+          y = refY + (da - db) / 2.0 / axis_steps_per_unit[Y_AXIS];
+  #else
+    float x = refX + da / axis_steps_per_unit[X_AXIS],
+          y = refY + db / axis_steps_per_unit[Y_AXIS];
+  #endif
+
+  float row_y = FRONT_SCAN_BED_POSITION + rowIndex * SCAN_Y_DIST;
+  if (fabs(y - row_y) > SCAN_Y_DIST / 2) return;
+
+  float cell = (x - LEFT_SCAN_BED_POSITION) / SCAN_X_DIST + 0.5;
+  if (cell < 0 || cell >= SCAN_GRID_POINTS) return;
+
+  uint8_t i = (uint8_t)cell;
+  if (rowCount[i] == SCAN_CELL_MAX_COUNT) return;
+  rowSum[i] += (int32_t)get_dist_from_raw(raw) - LDIST_OFFSET;
+  rowCount[i]++;
+}
+
+/**
+ * Fills the empty cells of one grid line by linear interpolation between the
+ * nearest cells with a sample, or copies the nearest one at the ends. A line
+ * without any sample stays empty.
+ * @param line    First cell of the line
+ * @param stride  Distance between cells of the line
+ */
+static void _fill_line(int16_t *line, uint8_t stride) {
+  int8_t prev = -1;
+  for (uint8_t k = 0; k <= SCAN_GRID_POINTS; k++) {
+    if (k < SCAN_GRID_POINTS && line[k * stride] == SCAN_EMPTY) continue;
+    // Cells prev+1 .. k-1 are empty
+    for (uint8_t e = prev + 1; e < k; e++) {
+      if (prev < 0 && k == SCAN_GRID_POINTS) return; // Nothing to fill from
+      else if (prev < 0) line[e * stride] = line[k * stride];
+      else if (k == SCAN_GRID_POINTS) line[e * stride] = line[prev * stride];
+      else line[e * stride] = line[prev * stride] + (int32_t)(line[k * stride] - line[prev * stride]) * (e - prev) / (k - prev);
+    }
+    prev = k;
+  }
+}
+
+#endif // LASER_BED_SCAN
@@ -0,0 +1,136 @@
+/**
+ * BedScan.h - Laser bed mapping while moving.
+ * Copyright (C) 2016 Voxel8
+ *
+ * G29 S1 sweeps the laser spot along SCAN_GRID_POINTS rows at SCAN_FEEDRATE.
+ * Each conversion of the external ADC background sampler is tagged with the
+ * head position from the stepper counts (the middle of the conversion) and
+ * summed into the grid cell it falls in. A row is finished, averaged and
+ * stored as heights before the next one starts, so only one row of sums is
+ * kept in RAM.
+ *
+ * Grid point (i, j) is at
+ *   x = LEFT_SCAN_BED_POSITION  + i * (RIGHT - LEFT) / (SCAN_GRID_POINTS - 1)
+ *   y = FRONT_SCAN_BED_POSITION + j * (BACK - FRONT) / (SCAN_GRID_POINTS - 1)
+ * and its cell extends half a grid spacing to each side.
+ *
+ * With LASER_MESH_LEVELING the grid is also used as a mesh: the planner adds
+ * the bilinear height of the grid at each target, relative to the grid mean,
+ * and G29 S1 splits moves where they cross grid lines so every segment stays
+ * in one cell. Cell indices come straight from reciprocals of the spacing.
+ */
+
+#ifndef MARLIN_BED_SCAN_H_
+#define MARLIN_BED_SCAN_H_
+
+#include "Marlin.h"
+
+#if ENABLED(LASER_BED_SCAN)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define SCAN_X_DIST ((float)(RIGHT_SCAN_BED_POSITION - LEFT_SCAN_BED_POSITION) / (SCAN_GRID_POINTS - 1))
+#define SCAN_Y_DIST ((float)(BACK_SCAN_BED_POSITION - FRONT_SCAN_BED_POSITION) / (SCAN_GRID_POINTS - 1))
+#define SCAN_X_DIST_INV ((float)(SCAN_GRID_POINTS - 1) / (RIGHT_SCAN_BED_POSITION - LEFT_SCAN_BED_POSITION))
+#define SCAN_Y_DIST_INV ((float)(SCAN_GRID_POINTS - 1) / (BACK_SCAN_BED_POSITION - FRONT_SCAN_BED_POSITION))
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Clears the grid before a new scan.
+ */
+void BedScan__Start(void);
+
+/**
+ * Starts binning samples into a row. The head must be standing still at
+ * current_position (after st_synchronize()), which becomes the reference for
+ * the stepper counts.
+ * @param row  Grid row 0 to SCAN_GRID_POINTS - 1
+ */
+void BedScan__BeginRow(uint8_t row);
+
+/**
+ * Takes a new sample from the ADC sampler while a row is open. Called from
+ * idle().
+ */
+void BedScan__Update(void);
+
+/**
+ * Stops binning and stores the averages of the open row as heights.
+ * @returns  Number of cells in the row that got no sample
+ */
+uint8_t BedScan__EndRow(void);
+
+/**
+ * Fills cells without a sample from their neighbours and fits a plane to
+ * the grid.
+ * @returns  false if the whole grid is empty
+ */
+bool BedScan__Finish(void);
+
+/**
+ * @returns  Height at grid point (i, j), in mm, as G29 computes it from a
+ *           laser distance: (distance - LDIST_OFFSET) / LDIST_UNIT_DIVISOR
+ */
+float BedScan__Height(uint8_t i, uint8_t j);
+
+/**
+ * @returns  Height of the least squares plane through the grid at (x, y),
+ *           valid after BedScan__Finish()
+ */
+float BedScan__PlaneHeight(float x, float y);
+
+#if ENABLED(LASER_MESH_LEVELING)
+
+  /**
+   * Makes the grid of the last successful BedScan__Finish() the mesh. Until
+   * then later scans, such as G29 dry runs, leave the mesh as it was. Only
+   * while the mesh is off, or the planner position would jump.
+   */
+  void BedScan__StoreMesh(void);
+
+  /**
+   * Turns mesh compensation on or off. Only possible once a mesh is stored.
+   * @returns  true if the mesh is active
+   */
+  bool BedScan__SetMeshActive(bool value);
+
+  /**
+   * @returns  true if the planner adds BedScan__MeshZ() to every target
+   */
+  bool BedScan__MeshActive(void);
+
+  /**
+   * @returns  Bilinear height of the grid at (x, y) minus the grid mean, in
+   *           mm. Outside the grid the height of the nearest edge is used.
+   */
+  float BedScan__MeshZ(float x, float y);
+
+  /**
+   * @returns  Column of the cell containing x, 0 to SCAN_GRID_POINTS - 2
+   */
+  FORCE_INLINE uint8_t BedScan__CellX(float x) {
+    float cell = (x - LEFT_SCAN_BED_POSITION) * SCAN_X_DIST_INV;
+    return cell <= 0 ? 0 : cell >= SCAN_GRID_POINTS - 2 ? SCAN_GRID_POINTS - 2 : (uint8_t)cell;
+  }
+
+  /**
+   * @returns  Row of the cell containing y, 0 to SCAN_GRID_POINTS - 2
+   */
+  FORCE_INLINE uint8_t BedScan__CellY(float y) {
+    float cell = (y - FRONT_SCAN_BED_POSITION) * SCAN_Y_DIST_INV;
+    return cell <= 0 ? 0 : cell >= SCAN_GRID_POINTS - 2 ? SCAN_GRID_POINTS - 2 : (uint8_t)cell;
+  }
+
+  FORCE_INLINE float BedScan__GridX(uint8_t i) { return LEFT_SCAN_BED_POSITION + i * SCAN_X_DIST; }
+  FORCE_INLINE float BedScan__GridY(uint8_t j) { return FRONT_SCAN_BED_POSITION + j * SCAN_Y_DIST; }
+
+#endif // LASER_MESH_LEVELING
+
+#endif // LASER_BED_SCAN
+
+#endif  // MARLIN_BED_SCAN_H_
@@ -0,0 +1,247 @@
+/**
+ * BinaryProtocol.cpp - Binary framed serial protocol.
+ * Frame parser, CRC and acknowledgements. The command queue itself stays in
+ * Marlin_main.cpp; see BinaryProtocol.h for the frame layout.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "BinaryProtocol.h"
+#include "language.h"
+
+#if ENABLED(BINARY_PROTOCOL)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+typedef enum _FrameState { WAIT_SYNC = 0, WAIT_SEQ, WAIT_TYPE, WAIT_LEN, WAIT_PAYLOAD, WAIT_CRC_LOW, WAIT_CRC_HIGH } FRAME_STATE;
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static bool binaryEnabled = false;
+
+// Frame being received
+static FRAME_STATE frameState = WAIT_SYNC;
+static uint8_t frameSeq;
+static uint8_t frameType;
+static uint8_t frameLength;
+static uint8_t frameCount;
+static uint16_t frameCrc;
+static uint16_t receivedCrc;
+
+static uint8_t expectedSeq = 0;
+static bool ackPending = false;
+static bool nakSent = false;
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static uint8_t _move_payload_length(uint8_t fields);
+static uint8_t _accept_frame(char *buffer);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Switches the serial port between ASCII lines and binary frames.
+ * @param value  true = binary frames, false = ASCII lines
+ */
+void BinaryProtocol__SetEnabled(bool value) {
+  binaryEnabled = value;
+  frameState = WAIT_SYNC;
+  expectedSeq = 0;
+  ackPending = false;
+  nakSent = false;
+}
+
+/**
+ * @returns  true if the serial port is reading binary frames
+ */
+bool BinaryProtocol__Enabled(void) { return binaryEnabled; }
+
+/**
+ * Consumes the available serial bytes until one frame is complete.
+ * @param buffer  Receives the payload, MAX_CMD_SIZE bytes
+ * @returns       The type of a valid frame in sequence, else BINARY_FRAME_NONE
+ */
+uint8_t BinaryProtocol__Read(char *buffer) {
+  while (MYSERIAL.available() > 0) {
+    uint8_t c = MYSERIAL.read();
+
+    if (frameState != WAIT_SYNC && frameState < WAIT_CRC_LOW)
+      frameCrc = BinaryProtocol__Crc16(frameCrc, c);
+
+    switch (frameState) {
+      case WAIT_SYNC:
+        if (c == BINARY_FRAME_SYNC) {
+          frameCrc = 0xFFFF;
+          frameState = WAIT_SEQ;
+        }
+        break;
+      case WAIT_SEQ:
+        frameSeq = c;
+        frameState = WAIT_TYPE;
+        break;
+      case WAIT_TYPE:
+        frameType = c;
+        frameState = WAIT_LEN;
+        break;
+      case WAIT_LEN:
+        frameLength = c;
+        frameCount = 0;
+        // A length that can't fit a command means we synced on a stray byte
+        if (frameLength > MAX_CMD_SIZE - 1) frameState = WAIT_SYNC;
+        else frameState = frameLength ? WAIT_PAYLOAD : WAIT_CRC_LOW;
+        break;
+      case WAIT_PAYLOAD:
+        buffer[frameCount++] = c;
+        if (frameCount == frameLength) frameState = WAIT_CRC_LOW;
+        break;
+      case WAIT_CRC_LOW:
+        receivedCrc = c;
+        frameState = WAIT_CRC_HIGH;
+        break;
+      case WAIT_CRC_HIGH: {
+        receivedCrc |= (uint16_t)c << 8;
+        frameState = WAIT_SYNC;
+        uint8_t type = _accept_frame(buffer);
+        if (type != BINARY_FRAME_NONE) return type;
+      } break;
+    }
+  }
+  return BINARY_FRAME_NONE;
+}
+
+/**
+ * @returns  Payload bytes of the frame last returned by BinaryProtocol__Read()
+ */
+uint8_t BinaryProtocol__FrameLength(void) { return frameLength; }
+
+/**
+ * Notes that a command from a frame has finished
+ */
+void BinaryProtocol__CommandDone(void) { ackPending = true; }
+
+/**
+ * Sends an ack if any frame was accepted or command completed since the
+ * last one.
+ * @param free_slots  Free command queue slots to advertise
+ */
+void BinaryProtocol__SendAck(uint8_t free_slots) {
+  if (!ackPending) return;
+  ackPending = false;
+  BinaryProtocol__SendFrame(expectedSeq - 1, BINARY_FRAME_ACK, &free_slots, 1);
+}
+
+/**
+ * Decodes the payload of a move frame.
+ * @param payload  Payload as returned by BinaryProtocol__Read()
+ * @param values   Receives the fields, indexed X, Y, Z, E, then BINARY_MOVE_F
+ * @returns        The field mask
+ */
+uint8_t BinaryProtocol__DecodeMove(const char *payload, float values[BINARY_MOVE_FIELDS]) {
+  uint8_t fields = payload[0];
+  const char *value = payload + 1;
+  for (uint8_t i = 0; i < BINARY_MOVE_FIELDS; i++) {
+    if (TEST(fields, i)) {
+      memcpy(&values[i], value, sizeof(float));
+      value += sizeof(float);
+    }
+  }
+  return fields;
+}
+
+/**
+ * CRC-16/CCITT update for one byte, without a lookup table.
+ */
+uint16_t BinaryProtocol__Crc16(uint16_t crc, uint8_t data) {
+  crc = (crc >> 8) | (crc << 8);
+  crc ^= data;
+  crc ^= (crc & 0xFF) >> 4;
+  crc ^= crc << 12;
+  crc ^= (crc & 0xFF) << 5;
+  return crc;
+}
+
+/**
+ * Writes one frame to the serial port.
+ */
+void BinaryProtocol__SendFrame(uint8_t seq, uint8_t type, const uint8_t *payload, uint8_t length) {
+  uint8_t header[] = { seq, type, length };
+  uint16_t crc = 0xFFFF;
+  MYSERIAL.write(BINARY_FRAME_SYNC);
+  for (uint8_t i = 0; i < sizeof(header); i++) {
+    crc = BinaryProtocol__Crc16(crc, header[i]);
+    MYSERIAL.write(header[i]);
+  }
+  for (uint8_t i = 0; i < length; i++) {
+    crc = BinaryProtocol__Crc16(crc, payload[i]);
+    MYSERIAL.write(payload[i]);
+  }
+  MYSERIAL.write(crc & 0xFF);
+  MYSERIAL.write(crc >> 8);
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+static uint8_t _move_payload_length(uint8_t fields) {
+  uint8_t length = 1;
+  for (uint8_t i = 0; i < BINARY_MOVE_FIELDS; i++)
+    if (TEST(fields, i)) length += sizeof(float);
+  return length;
+}
+
+/**
+ * Checks a complete frame. Corrupt, malformed or out of order frames are
+ * answered with a single NAK until the expected frame arrives (go-back-N);
+ * frames already accepted once are dropped and acked again.
+ * @returns  The frame type if the frame should be queued
+ */
+static uint8_t _accept_frame(char *buffer) {
+  if (receivedCrc != frameCrc || frameSeq != expectedSeq) {
+    // A resend of a frame we already have means our ack was lost
+    if (receivedCrc == frameCrc && (uint8_t)(expectedSeq - frameSeq) <= BUFSIZE) {
+      ackPending = true;
+    }
+    else if (!nakSent) {
+      BinaryProtocol__SendFrame(expectedSeq, BINARY_FRAME_NAK, NULL, 0);
+      nakSent = true;
+    }
+    return BINARY_FRAME_NONE;
+  }
+
+  bool valid = false;
+  switch (frameType) {
+    case BINARY_FRAME_LINE:
+      valid = true;
+      break;
+    case BINARY_FRAME_MOVE:
+      valid = frameLength && frameLength == _move_payload_length(buffer[0]);
+      break;
+  }
+
+  // Intact but not a command: not acked, so the host sends it again
+  if (!valid) {
+    SERIAL_ERROR_START;
+    SERIAL_ERRORLNPGM(MSG_ERR_BINARY_FRAME);
+    if (!nakSent) {
+      BinaryProtocol__SendFrame(expectedSeq, BINARY_FRAME_NAK, NULL, 0);
+      nakSent = true;
+    }
+    return BINARY_FRAME_NONE;
+  }
+
+  expectedSeq++;
+  nakSent = false;
+  ackPending = true;
+  if (frameType == BINARY_FRAME_LINE) buffer[frameLength] = '\0';
+  return frameType;
+}
+
+#endif // BINARY_PROTOCOL
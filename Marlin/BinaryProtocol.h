@@ -0,0 +1,126 @@
+/**
+ * BinaryProtocol.h - Binary framed serial protocol.
+ * Copyright (C) 2016 Voxel8
+ *
+ * An alternative to the ASCII line protocol for streaming dense paths. It is
+ * switched on with M254 S1 (sent as an ordinary ASCII line) and off again with
+ * a line frame holding "M254 S0".
+ *
+ * Every frame, in either direction, has the layout
+ *
+ *   0xA5 | SEQ | TYPE | LEN | PAYLOAD[LEN] | CRC16 (low byte first)
+ *
+ * where the CRC is CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+ * over SEQ, TYPE, LEN and the payload.
+ *
+ * Host to firmware:
+ *   LINE (0x01)  Payload is one G-code command without line number, checksum
+ *                or terminator.
+ *   MOVE (0x02)  G0/G1 with a field mask byte (bit 0-3 X Y Z E, bit 4 F)
+ *                followed by one little-endian float per set bit.
+ *
+ * Firmware to host:
+ *   ACK (0x80)   SEQ is the last frame accepted; the one-byte payload is the
+ *                number of move frames with every field that the command
+ *                queue still takes. The host may have at most that many
+ *                frames in flight beyond SEQ, counting a longer line frame
+ *                as several by its length. Acks are sent once per pass of
+ *                the main loop, covering every frame accepted and every
+ *                command completed since the previous ack.
+ *   NAK (0x81)   SEQ is the frame the firmware expects next. Sent after a
+ *                CRC error, a sequence gap, or a frame of an unknown type or
+ *                with a payload that doesn't match its field mask; the host
+ *                resends from SEQ.
+ *   TELEMETRY (0x82)  Unsolicited temperatures and pressures, see
+ *                Telemetry.h. SEQ counts telemetry frames only.
+ *
+ * Command output (M105 reports, errors) is still ASCII. It never contains the
+ * 0xA5 sync byte, so the host can tell it apart from ack frames.
+ */
+
+#ifndef BINARY_PROTOCOL_H
+#define BINARY_PROTOCOL_H
+
+#include "Marlin.h"
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define BINARY_FRAME_SYNC 0xA5
+
+#define BINARY_FRAME_NONE 0x00
+#define BINARY_FRAME_LINE 0x01
+#define BINARY_FRAME_MOVE 0x02
+#define BINARY_FRAME_ACK  0x80
+#define BINARY_FRAME_NAK  0x81
+#define BINARY_FRAME_TELEMETRY 0x82
+
+// Move frame fields, in payload order. Bits of the field mask byte.
+#define BINARY_MOVE_F      NUM_AXIS
+#define BINARY_MOVE_FIELDS (NUM_AXIS + 1)
+#define BINARY_MOVE_MAX_LENGTH (1 + BINARY_MOVE_FIELDS * sizeof(float)) // Payload with every field
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Switches the serial port between ASCII lines and binary frames. Enabling
+ * resets the expected sequence number to 0.
+ * @param value  true = binary frames, false = ASCII lines
+ */
+void BinaryProtocol__SetEnabled(bool value);
+
+/**
+ * @returns  true if the serial port is reading binary frames
+ */
+bool BinaryProtocol__Enabled(void);
+
+/**
+ * Consumes the available serial bytes until one frame is complete.
+ * @param buffer  Receives the payload, MAX_CMD_SIZE bytes. A partial frame
+ *                stays in it between calls, so pass the same buffer until
+ *                a frame is returned. Line payloads are nul-terminated.
+ * @returns       BINARY_FRAME_LINE or BINARY_FRAME_MOVE for a valid frame in
+ *                sequence, otherwise BINARY_FRAME_NONE.
+ */
+uint8_t BinaryProtocol__Read(char *buffer);
+
+/**
+ * @returns  Payload bytes of the frame last returned by BinaryProtocol__Read()
+ */
+uint8_t BinaryProtocol__FrameLength(void);
+
+/**
+ * Notes that a command from a frame has finished, so the next ack will
+ * advertise the freed slot.
+ */
+void BinaryProtocol__CommandDone(void);
+
+/**
+ * Sends an ack if any frame was accepted or command completed since the
+ * last one.
+ * @param free_slots  Free command queue slots to advertise
+ */
+void BinaryProtocol__SendAck(uint8_t free_slots);
+
+/**
+ * Decodes the payload of a move frame.
+ * @param payload  Payload as returned by BinaryProtocol__Read()
+ * @param values   Receives the fields, indexed X, Y, Z, E, then BINARY_MOVE_F
+ * @returns        The field mask; bits that are clear leave values untouched
+ */
+uint8_t BinaryProtocol__DecodeMove(const char *payload, float values[BINARY_MOVE_FIELDS]);
+
+/**
+ * Writes one frame to the serial port, whatever the protocol in use.
+ */
+void BinaryProtocol__SendFrame(uint8_t seq, uint8_t type, const uint8_t *payload, uint8_t length);
+
+/**
+ * CRC-16/CCITT update for one byte.
+ */
+uint16_t BinaryProtocol__Crc16(uint16_t crc, uint8_t data);
+
+#endif // BINARY_PROTOCOL_H
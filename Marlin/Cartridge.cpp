@@ -10,6 +10,7 @@
 
 #include "../tests/GTest/mocks/Marlin.h"
 #include "Cartridge.h"
+#include "Voxel8_I2C_Commands.h"
 
 #include "../tests/GTest/mocks/temperature.h"  // for disable_all_heaters()
 #include "../tests/GTest/mocks/stepper.h"      // for quickStop()
@@ -19,6 +20,7 @@
 
 #include "Marlin.h"
 #include "Cartridge.h"
+#include "Voxel8_I2C_Commands.h"
 
 #include "./temperature.h"  // for disable_all_heaters()
 #include "./stepper.h"      // for quickStop()
@@ -194,11 +196,12 @@ bool Cartridge__GetAugerEnabled(void) { return augerEnabled; }
 
 /**
  * Reports that a cartridge is absent. If there was a cartridge present,
- * marks it as removed
+ * marks it as removed and drops its cached metadata
  */
 static void cartridgeAbsentUpdate(uint8_t cartNumber) {
   if (cartridgeStatus[cartNumber] == PRESENT) {
     cartridgeStatus[cartNumber] = REMOVED;
+    I2C__InvalidateCartridgeInfo(cartNumber);
     switch (cartNumber) {
       case FFF_INDEX:
         SERIAL_PROTOCOLLNPGM("FFF Cartridge Removed");
@@ -219,10 +222,12 @@ static void cartridgeAbsentUpdate(uint8_t cartNumber) {
 
 /**
  * Reports that a cartridge is present. If it was marked as removed,
- * this will clear it.
+ * this will clear it. A newly inserted cartridge gets its metadata read in
+ * the background.
  */
 static void cartridgePresentUpdate(uint8_t cartNumber) {
   if (cartridgeStatus[cartNumber] != PRESENT) {
+    I2C__RequestCartridgeInfo(cartNumber);
     switch (cartNumber) {
       case FFF_INDEX:
         SERIAL_PROTOCOLLNPGM("FFF Cartridge Inserted");
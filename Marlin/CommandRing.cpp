@@ -0,0 +1,118 @@
+/**
+ * CommandRing.cpp - Byte-packed ring of variable length commands.
+ * See CommandRing.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "CommandRing.h"
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static bool _place(const CommandRing *ring, uint16_t bytes, uint16_t *at);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void CommandRing__Init(CommandRing *ring, char *buffer, uint16_t size) {
+  ring->buffer = buffer;
+  ring->size = size;
+  CommandRing__Clear(ring);
+}
+
+void CommandRing__Clear(CommandRing *ring) {
+  ring->read = ring->write = 0;
+  ring->count = 0;
+}
+
+uint8_t CommandRing__Count(const CommandRing *ring) { return ring->count; }
+
+/**
+ * The larger of the free space after the newest entry and before the oldest.
+ * The write offset never catches up with the read offset from behind, so
+ * equal offsets always mean an empty ring.
+ */
+uint16_t CommandRing__Room(const CommandRing *ring) {
+  uint16_t room;
+  if (!ring->count)
+    room = ring->size;
+  else if (ring->write > ring->read)
+    room = max(ring->size - ring->write, ring->read ? ring->read - 1 : 0);
+  else
+    room = ring->read - ring->write - 1;
+  return room > COMMAND_RING_HEADER ? room - COMMAND_RING_HEADER : 0;
+}
+
+/**
+ * Entries fill the space after the newest one first, then wrap to the space
+ * before the oldest, as _place() finds them.
+ */
+uint8_t CommandRing__Slots(const CommandRing *ring, uint8_t length) {
+  uint16_t bytes = length + COMMAND_RING_HEADER, slots;
+  if (!ring->count)
+    slots = ring->size / bytes;
+  else if (ring->write > ring->read)
+    slots = (ring->size - ring->write) / bytes + (ring->read ? (ring->read - 1) / bytes : 0);
+  else
+    slots = (ring->read - ring->write - 1) / bytes;
+  return min(slots, 255);
+}
+
+bool CommandRing__Push(CommandRing *ring, const char *data, uint8_t length, uint8_t flags) {
+  uint16_t bytes = length + COMMAND_RING_HEADER, at;
+  if (bytes > 255 || !_place(ring, bytes, &at)) return false;
+
+  // Skipping the rest of the buffer: mark it for the reader
+  if (at != ring->write && ring->write < ring->size) ring->buffer[ring->write] = 0;
+
+  char *entry = ring->buffer + at;
+  entry[0] = bytes;
+  entry[1] = flags;
+  memcpy(entry + COMMAND_RING_HEADER, data, length);
+  ring->write = at + bytes;
+  ring->count++;
+  return true;
+}
+
+char *CommandRing__Front(CommandRing *ring, uint8_t *flags) {
+  if (!ring->count) return NULL;
+  char *entry = ring->buffer + ring->read;
+  if (flags) *flags = entry[1];
+  return entry + COMMAND_RING_HEADER;
+}
+
+void CommandRing__Pop(CommandRing *ring) {
+  if (!ring->count) return;
+  ring->read += (uint8_t)ring->buffer[ring->read];
+  if (!--ring->count)
+    ring->read = ring->write = 0; // Start over at the front, where the most room is
+  else if (ring->read == ring->size || !ring->buffer[ring->read])
+    ring->read = 0;
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * Finds room for an entry of the given size.
+ * @param at  Receives the offset to write it to
+ */
+static bool _place(const CommandRing *ring, uint16_t bytes, uint16_t *at) {
+  if (!ring->count) {
+    *at = 0;
+    return bytes <= ring->size;
+  }
+  if (ring->write > ring->read) {
+    if (ring->size - ring->write >= bytes) {
+      *at = ring->write;
+      return true;
+    }
+    *at = 0;
+    return ring->read > bytes;
+  }
+  *at = ring->write;
+  return ring->read - ring->write > bytes;
+}
@@ -0,0 +1,81 @@
+/**
+ * CommandRing.h - Byte-packed ring of variable length commands.
+ * Copyright (C) 2016 Voxel8
+ *
+ * Each command takes its own length plus a two byte header (entry size and
+ * flags) instead of a whole MAX_CMD_SIZE row, so a ring of the same RAM
+ * holds several times more short G1 lines. Commands are never split at the
+ * end of the buffer: one that does not fit there leaves a zero size byte as
+ * a wrap marker and starts over at the front, so every command can be
+ * parsed in place.
+ */
+
+#ifndef MARLIN_COMMAND_RING_H_
+#define MARLIN_COMMAND_RING_H_
+
+#include "Marlin.h"
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define COMMAND_RING_HEADER 2 // Entry size and flags
+
+typedef struct {
+  char *buffer;
+  uint16_t size;   // Bytes of buffer
+  uint16_t read;   // Offset of the oldest entry
+  uint16_t write;  // Offset the next entry goes to, unless it has to wrap
+  uint8_t count;   // Entries queued
+} CommandRing;
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * @param buffer  Storage of the ring, at most 65535 bytes
+ */
+void CommandRing__Init(CommandRing *ring, char *buffer, uint16_t size);
+
+void CommandRing__Clear(CommandRing *ring);
+
+/**
+ * @returns  Entries queued
+ */
+uint8_t CommandRing__Count(const CommandRing *ring);
+
+/**
+ * @returns  Longest command that can be pushed right now, in bytes
+ */
+uint16_t CommandRing__Room(const CommandRing *ring);
+
+/**
+ * @param length  Bytes of a command
+ * @returns       How many commands of that length can be pushed one after
+ *                the other right now, at most 255
+ */
+uint8_t CommandRing__Slots(const CommandRing *ring, uint8_t length);
+
+/**
+ * Copies a command to the back of the ring.
+ * @param data    The command. Text is pushed with its nul terminator.
+ * @param length  Bytes of data, at most 253
+ * @param flags   Stored with the command
+ * @returns       false if there is no room for it
+ */
+bool CommandRing__Push(CommandRing *ring, const char *data, uint8_t length, uint8_t flags);
+
+/**
+ * @param flags  Receives the flags of the command, may be NULL
+ * @returns      The oldest command, which may be modified in place until
+ *               it is popped, or NULL if the ring is empty
+ */
+char *CommandRing__Front(CommandRing *ring, uint8_t *flags);
+
+/**
+ * Drops the oldest command.
+ */
+void CommandRing__Pop(CommandRing *ring);
+
+#endif  // MARLIN_COMMAND_RING_H_
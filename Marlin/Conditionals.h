@@ -404,6 +404,27 @@
 
   #define ARRAY_BY_EXTRUDERS1(v1) ARRAY_BY_EXTRUDERS(v1, v1, v1, v1)
 
+  /**
+   * PID gains of extruders 1-3 default to those of extruder 0
+   */
+  #if ENABLED(PID_PARAMS_PER_EXTRUDER)
+    #ifndef DEFAULT_Kp_E1
+      #define DEFAULT_Kp_E1 DEFAULT_Kp
+      #define DEFAULT_Ki_E1 DEFAULT_Ki
+      #define DEFAULT_Kd_E1 DEFAULT_Kd
+    #endif
+    #ifndef DEFAULT_Kp_E2
+      #define DEFAULT_Kp_E2 DEFAULT_Kp
+      #define DEFAULT_Ki_E2 DEFAULT_Ki
+      #define DEFAULT_Kd_E2 DEFAULT_Kd
+    #endif
+    #ifndef DEFAULT_Kp_E3
+      #define DEFAULT_Kp_E3 DEFAULT_Kp
+      #define DEFAULT_Ki_E3 DEFAULT_Ki
+      #define DEFAULT_Kd_E3 DEFAULT_Kd
+    #endif
+  #endif
+
   /**
    * Shorthand for pin tests, used wherever needed
    */
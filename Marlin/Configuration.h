@@ -229,8 +229,9 @@ Here are some standard links for getting your machine calibrated:
   //#define PID_DEBUG // Sends debug data to the serial port.
   //#define PID_OPENLOOP 1 // Puts PID in open loop. M104/M140 sets the output power from 0 to PID_MAX
   //#define SLOW_PWM_HEATERS // PWM with very low frequency (roughly 0.125Hz=8s) and minimum state time of approximately 1s useful for heaters driven by a relay
-  //#define PID_PARAMS_PER_EXTRUDER // Uses separate PID parameters for each extruder (useful for mismatched extruders)
+  #define PID_PARAMS_PER_EXTRUDER // Uses separate PID parameters for each extruder (useful for mismatched extruders)
                                     // Set/get with gcode: M301 E[extruder number, 0-2]
+  #define PID_FIXED_POINT // Runs the hot end and bed PIDs in Q16.16 fixed point instead of float, see PidFixed.h
   #define PID_FUNCTIONAL_RANGE 30 // If the temperature difference between the target temperature and the actual temperature
                                   // is more then PID_FUNCTIONAL_RANGE then the PID will be shut off and the heater will be set to min/max.
   #define PID_INTEGRAL_DRIVE_MAX PID_MAX  //limit for the integral term
@@ -267,6 +268,12 @@ Here are some standard links for getting your machine calibrated:
     #define  DEFAULT_Ki 1.24
     #define  DEFAULT_Kd 80.47
 
+// With PID_PARAMS_PER_EXTRUDER, cartridges whose heaters differ from extruder 0's
+// get their own gains here; the ones left undefined use extruder 0's.
+//    #define  DEFAULT_Kp_E1 19.96
+//    #define  DEFAULT_Ki_E1 1.24
+//    #define  DEFAULT_Kd_E1 80.47
+
 // D3D 24V New Heat Block
 //    #define  DEFAULT_Kp 9.83
 //    #define  DEFAULT_Ki 0.37
@@ -618,6 +625,25 @@ const bool Z_MIN_PROBE_ENDSTOP_INVERTING = true; // set to true to invert the lo
 
   #endif // AUTO_BED_LEVELING_GRID
 
+  // G29 S1 - Map the bed with the laser distance sensor while sweeping rows at
+  // constant speed, instead of stopping at each probe point. Samples from the
+  // external ADC are tagged with the stepper position and averaged per cell.
+  // The positions are those of the laser spot, as for ABL_PROBE_PT_*.
+  #if ENABLED(EXT_ADC)
+    #define LASER_BED_SCAN
+
+    #define SCAN_GRID_POINTS 15         // Grid points per dimension
+    #define LEFT_SCAN_BED_POSITION  (X_MIN_POS + 25 + X_PROBE_OFFSET_FROM_EXTRUDER)
+    #define RIGHT_SCAN_BED_POSITION (X_MAX_POS - 25 + X_PROBE_OFFSET_FROM_EXTRUDER)
+    #define FRONT_SCAN_BED_POSITION (60 + Y_PROBE_OFFSET_FROM_EXTRUDER)
+    #define BACK_SCAN_BED_POSITION  (175 + Y_PROBE_OFFSET_FROM_EXTRUDER)
+    #define SCAN_FEEDRATE 5000          // (mm/min) Speed along each row
+
+    // Compensate with the scanned grid itself (bilinear, moves split at grid
+    // lines) instead of the plane fitted to it. M420 S0/S1 turns it off/on.
+    #define LASER_MESH_LEVELING
+  #endif
+
   #define Z_RAISE_BEFORE_HOMING 10    // (in mm) Raise Z before homing (G28) for Probe Clearance.
 
   #define XY_TRAVEL_SPEED 8000        // X and Y axis travel speed between probes, in mm/min.
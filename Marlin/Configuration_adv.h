@@ -55,6 +55,16 @@
   #endif
 #endif
 
+#if ENABLED(PIDTEMP) || ENABLED(PIDTEMPBED)
+  // M303 heats once at full power and fits a first order plus dead time model
+  // to the rise instead of running relay cycles. See HeaterModel.h.
+  #define PID_AUTOTUNE_FOPDT
+  #if ENABLED(PID_AUTOTUNE_FOPDT)
+    #define PID_FOPDT_INTERVAL     750   // ms between samples of a hot end, so a step takes at most 90s
+    #define PID_FOPDT_BED_INTERVAL 4000  // ms between samples of the bed, so at most 8 minutes
+  #endif
+#endif
+
 /**
  * Automatic Temperature:
  * The hotend target temperature is calculated by all the buffered lines of gcode.
@@ -132,6 +142,31 @@
   #define PNEUMATIC_HYSTERESIS 20
   #define PNEUMATIC_HYSTERESIS_PSI PNEUMATIC_HYSTERESIS/10
   #define PNEUMATIC_CHECK_INTERVAL 1100 // in ms
+
+  // Filtering of the pressure readings, applied in the temperature ISR to
+  // each OVERSAMPLENR sum: 0 = none, 1 = first-order IIR, 2 = median.
+  // M249 reports the spread of the unfiltered readings.
+  #define PNEUMATIC_FILTER     1
+  #define REGULATOR_FILTER     2      // The regulator loop is hurt more by lag than by noise
+  #define PRESSURE_IIR_SHIFT   2      // Weight of a new reading is 1/2^shift
+  #define PRESSURE_MEDIAN_LEN  3      // Readings, odd
+
+  // Proportional pump: PNEUMATIC_PUMP_PIN is driven with PWM from a model of
+  // the tank instead of being switched around PNEUMATIC_HYSTERESIS. The duty
+  // is chosen so the predicted tank pressure reaches its target within
+  // PUMP_HORIZON ms, with the air being drawn estimated from how the tank
+  // actually moves. The target is raised ahead of planned moves whose
+  // regulator setpoint needs more than M125 asked for (pre-charge).
+  #define PNEUMATIC_PUMP_PWM
+  #if ENABLED(PNEUMATIC_PUMP_PWM)
+    #define PNEUMATIC_TANK_VOLUME   500   // ml
+    #define PUMP_FLOW               300   // ml/s of free air at full duty into an empty tank
+    #define PUMP_STALL_PSI          80    // psi the pump cannot pump against
+    #define PUMP_MIN_DUTY           80    // PWM below which the motor stalls (0-255)
+    #define PUMP_HORIZON            2000  // ms
+    #define PUMP_UPDATE_INTERVAL    250   // ms
+    #define PUMP_PRECHARGE_MARGIN   3     // psi above a planned setpoint plus hysteresis
+  #endif
 #endif
 
 #if ENABLED(E_REGULATOR)
@@ -141,6 +176,32 @@
   // In this case, a tank setpoint is no longer required and if a setpoint
   // exist, it is not considered when calculating available pressures
   #define HOUSE_AIR_THRESH    42 // 42 psi
+
+  // Closed-loop output pressure: every new reading of the regulator's
+  // feedback sensor (from manage_heater) trims the DAC with a PI term on top
+  // of the nominal psi to DAC conversion. The integral is clamped and frozen
+  // while the DAC is saturated (anti-windup). M236 V reports the settling
+  // time and steady-state error of the last setpoint change.
+  #define REGULATOR_CLOSED_LOOP
+  #if ENABLED(REGULATOR_CLOSED_LOOP)
+    #define REGULATOR_KP             0.2  // psi per psi of error
+    #define REGULATOR_KI             0.5  // psi per psi of error per second
+    #define REGULATOR_INTEGRAL_MAX  10.0  // psi, the most the nominal conversion can be off by
+    #define REGULATOR_SETTLE_BAND   0.25  // psi, settled once this close for
+    #define REGULATOR_SETTLE_SAMPLES   3  // this many readings in a row
+  #endif
+
+  // Pressure advance: viscous inks lag the regulator, so while a solenoid is
+  // open the DAC is driven with the speed the head will have
+  // PRESSURE_ADVANCE_LEAD ms from now, read off the planned trapezoids:
+  //   pressure = setpoint * (1 - GAIN + GAIN * speed / nominal speed of the move)
+  // GAIN 0 keeps the M236 pressure fixed. M246 L<ms> K<gain> tunes it per ink.
+  #define PRESSURE_ADVANCE
+  #if ENABLED(PRESSURE_ADVANCE)
+    #define PRESSURE_ADVANCE_LEAD      50  // ms, about the response time of the ink
+    #define PRESSURE_ADVANCE_GAIN     0.0  // 0 to 1, 0 until tuned for the ink
+    #define PRESSURE_ADVANCE_INTERVAL  10  // ms between DAC updates
+  #endif
 #endif
 
 //===========================================================================
@@ -280,6 +341,19 @@
 // If defined the movements slow down when the look ahead buffer is only half full
 // #define SLOWDOWN
 
+// Runs of short, nearly collinear G0/G1 moves with the same feed rate and E per
+// mm are merged into one planner block, as long as no point of the run is
+// further than SEGMENT_MERGE_TOLERANCE from the merged line. A move is only
+// held back while the planner has SEGMENT_MERGE_MIN_BLOCKS queued.
+#define SEGMENT_MERGE
+#if ENABLED(SEGMENT_MERGE)
+  #define SEGMENT_MERGE_MAX_ANGLE    5     // degrees the direction may turn between merged moves
+  #define SEGMENT_MERGE_TOLERANCE    0.01  // mm of chord error
+  #define SEGMENT_MERGE_E_TOLERANCE  0.02  // relative difference in E per mm
+  #define SEGMENT_MERGE_MAX_POINTS   8     // moves merged into one block at most
+  #define SEGMENT_MERGE_MIN_BLOCKS   4     // planner blocks queued before a move is held back
+#endif
+
 // Frequency limit
 // See nophead's blog for more info
 // Not working O
@@ -462,6 +536,33 @@ const unsigned int dropsegments=5; //everything with less than this number of st
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+// Queued commands are packed into a ring of this many bytes, each taking its
+// own length plus 2, so short G1 lines queue several times deeper than BUFSIZE.
+#define CMD_RING_SIZE (BUFSIZE * MAX_CMD_SIZE)
+
+// Status queries and stops from the host (M105, M114, M236 V, M410) skip the
+// queued commands. The queries run as soon as the current command waits, e.g.
+// for the planner, M410 once it has finished. M112 is always run as soon as
+// it is read.
+#define PRIORITY_COMMANDS
+#if ENABLED(PRIORITY_COMMANDS)
+  #define PRIORITY_RING_SIZE 64 // Bytes, two queries with line number and checksum
+#endif
+
+// Bytes received and not yet read by get_command(), a power of 2 up to 256.
+// Bytes that arrive while it is full are dropped and counted, see M255.
+#define RX_BUFFER_SIZE 256
+
+// Serial output is queued in a ring of this many bytes (a power of 2, at most
+// 256) and sent from the USART data register empty interrupt, so replies don't
+// hold up the main loop for ~40us a character. 0 waits on the UART for each byte.
+#define TX_BUFFER_SIZE 128
+#if TX_BUFFER_SIZE > 0
+  // Drop output while the ring is full instead of waiting for room, for very
+  // chatty debug runs. M255 reports the bytes queued and dropped.
+  //#define TX_BUFFER_DROP
+#endif
+
 // Bad Serial-connections can miss a received command by sending an 'ok'
 // Therefore some clients abort after 30 seconds in a timeout.
 // Some other clients start sending commands while receiving a 'wait'.
@@ -469,8 +570,34 @@ const unsigned int dropsegments=5; //everything with less than this number of st
 //#define NO_TIMEOUTS 1000 // Milliseconds
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
+// Every ok then reads: ok N<last line> P<free planner blocks> B<longest line the queue takes now>
+// B is in bytes, as Q of BATCHED_OK, not a count of free commands: the queue is
+// packed, so the number of lines it takes depends on their length.
 //#define ADVANCED_OK
 
+// Flow control by credits, for hosts that keep several numbered lines in flight.
+// After M256 S1 each line is acked as soon as it is queued, and one ok covers
+// all the lines queued in a pass of the main loop:
+//   ok N<last line queued> Q<longest line the queue takes now> P<free planner blocks>
+// The host may send up to RX_BUFFER_SIZE - 1 bytes past line N. Other replies
+// that start with ok, like M105's, carry no N. M256 S0 goes back to one ok per
+// command as it completes.
+#define BATCHED_OK
+
+// Binary framed protocol with CRC16 and windowed acks, for streaming dense paths.
+// The host switches to it with M254 S1 and back with M254 S0. See BinaryProtocol.h.
+#define BINARY_PROTOCOL
+
+// Temperatures and pressures pushed to the host from idle() instead of being
+// polled with M105 and M236 V. M155 S<seconds> C<channels> starts it, S0 stops it.
+// See Telemetry.h for the channel bits and the report format.
+#define TELEMETRY
+#if ENABLED(TELEMETRY)
+  #define TELEMETRY_INTERVAL      0     // ms at power on, 0 = off until M155
+  #define TELEMETRY_MIN_INTERVAL  50    // ms, a report line is ~60 bytes
+  #define TELEMETRY_CHANNELS      0x1F  // Hotends 1, bed 2, tank 4, regulator 8, laser 16
+#endif
+
 // @section fwretract
 
 // Firmware based and LCD controlled retract
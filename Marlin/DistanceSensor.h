@@ -37,4 +37,8 @@ uint16_t get_dist_SingleEnded(uint8_t channel);
 
 uint16_t get_dist_Differential(uint8_t first_channel, uint8_t second_channel);
 
+// The formula is linear, so the distance of an averaged raw value is the
+// average distance
+uint16_t get_dist_from_raw(uint16_t val_raw);
+
 #endif
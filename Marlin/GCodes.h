@@ -18,6 +18,10 @@
 #include "GCodeUtility.h"
 #include "planner.h"
 
+#if ENABLED(BINARY_PROTOCOL)
+  #include "BinaryProtocol.h"
+#endif
+
 //===========================================================================
 //================================ GCode List ===============================
 //===========================================================================
@@ -40,6 +44,8 @@
  * M253 - Queries cartridge to see if 24 volts are present or not.
           FFF: Returns whether hot end is active
           Pneumatics: Returns whether solenoid is active
+ * M254 - Select serial protocol: S0 ASCII lines, S1 binary frames
+ * M255 - Serial port statistics: RX bytes lost to overflow, TX bytes sent and dropped
  * M272 - Set axis steps-per-unit for one or more axes, X, Y, Z, and E using
  *        the default ball-bar units
 */
@@ -277,4 +283,44 @@ inline void gcode_M248() {
     }
 }
 
+#if ENABLED(BINARY_PROTOCOL)
+/*
+* M254 - Select serial protocol
+*   S0 - ASCII lines (default). Sent from binary mode as a line frame, the
+*        "ok" comes back as text once the port has switched.
+*   S1 - Binary frames, see BinaryProtocol.h. Start sending frames, from
+*        sequence number 0, after this command's "ok".
+*/
+inline void gcode_M254() {
+  if (code_seen('S')) {
+    BinaryProtocol__SetEnabled(code_value() > 0);
+  }
+  else {
+    SERIAL_PROTOCOLPGM("Protocol: ");
+    SERIAL_PROTOCOLLN(BinaryProtocol__Enabled() ? 1 : 0);
+  }
+}
+#endif
+
+/*
+* M255 - Serial port statistics since power on
+*   RX overflows: bytes dropped because the RX ring was full, which the
+*   host sees as checksum errors and resends.
+*   TX queued/dropped: bytes written to the TX ring, and those of them
+*   dropped because it was full (TX_BUFFER_DROP).
+*/
+inline void gcode_M255() {
+  uint16_t overflows = MYSERIAL.rxOverflows();
+  SERIAL_PROTOCOLPGM("RX overflows:");
+  SERIAL_PROTOCOL(overflows);
+  #if TX_BUFFER_SIZE > 0
+    uint32_t queued = MYSERIAL.txQueued(), dropped = MYSERIAL.txDropped();
+    SERIAL_PROTOCOLPGM(" TX queued:");
+    SERIAL_PROTOCOL(queued);
+    SERIAL_PROTOCOLPGM(" dropped:");
+    SERIAL_PROTOCOL(dropped);
+  #endif
+  SERIAL_EOL;
+}
+
 #endif  // G_CODES_H_
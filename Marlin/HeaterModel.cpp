@@ -0,0 +1,81 @@
+/**
+ * HeaterModel.cpp - First order plus dead time model of a heater, fitted to
+ * a heating step. See HeaterModel.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "HeaterModel.h"
+
+#if ENABLED(PID_AUTOTUNE_FOPDT)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+bool HeaterModel__Fit(const float *samples, uint8_t count, float interval, float power, HeaterModel *model) {
+  float base = samples[0];
+
+  uint8_t first = 1;
+  while (first < count && samples[first] - base < HEATER_MODEL_MIN_RISE) first++;
+
+  // Line through (y[k], y[k+1]) from the first sample that responds
+  float sx = 0, sy = 0, sxx = 0, sxy = 0;
+  uint8_t n = 0;
+  for (uint8_t i = first; i + 1 < count; i++) {
+    float x = samples[i] - base, y = samples[i + 1] - base;
+    sx += x; sy += y; sxx += x * x; sxy += x * y;
+    n++;
+  }
+  if (n < 4) return false;
+  float det = n * sxx - sx * sx;
+  if (det <= 0) return false;
+  float a = (n * sxy - sx * sy) / det,
+        c = (sy - a * sx) / n;
+  // A rise that is not slowing down, or not rising, is no first order step
+  if (a <= 0 || a >= 1 || c <= 0) return false;
+
+  float rise = c / (1 - a);
+  model->tau = -interval / log(a);
+  model->gain = rise / power;
+  model->used = n + 1;
+
+  // Where the samples sit on the curve rise * (1 - e^(-(t - dead_time) / tau))
+  float delay = 0;
+  uint8_t m = 0;
+  for (uint8_t i = first; i < count; i++) {
+    float y = samples[i] - base;
+    if (y >= 0.95 * rise) break; // Too flat to place
+    delay += i * interval + model->tau * log(1 - y / rise);
+    m++;
+  }
+  if (m == 0) return false;
+  model->dead_time = max(delay / m, 0);
+
+  float sq = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    float t = i * interval - model->dead_time,
+          y = t > 0 ? rise * (1 - exp(-t / model->tau)) : 0,
+          e = samples[i] - base - y;
+    sq += e * e;
+  }
+  model->rms = sqrt(sq / count);
+  return true;
+}
+
+/**
+ * SIMC PID for a first order plus dead time process with the closed-loop
+ * time constant equal to the dead time: the proportional gain settles the
+ * process in about twice the dead time, the integral time is capped for
+ * slow heaters so they still reject drafts, and the derivative covers half
+ * the dead time. The dead time is taken as at least a second, the lag of the
+ * sensor and the derivative smoothing.
+ */
+void HeaterModel__Gains(const HeaterModel *model, float *kp, float *ki, float *kd) {
+  float theta = max(model->dead_time, 1.0),
+        ti = min(model->tau, 8 * theta);
+  *kp = model->tau / (model->gain * 2 * theta);
+  *ki = *kp / ti;
+  *kd = *kp * theta / 2;
+}
+
+#endif // PID_AUTOTUNE_FOPDT
@@ -0,0 +1,60 @@
+/**
+ * HeaterModel.h - First order plus dead time model of a heater, fitted to a
+ * heating step, and the PID gains that follow from it.
+ * Copyright (C) 2016 Voxel8
+ *
+ * After the dead time the rise of a heater at constant power follows
+ * y[k+1] = a * y[k] + c, so a least squares line through the pairs of
+ * successive samples gives the time constant (from a) and the steady state
+ * rise (c / (1 - a)) without waiting for the heater to settle. The dead time
+ * is then the mean delay of the samples behind that curve. The gains are
+ * Skogestad's SIMC rules for the model, with the closed-loop time constant
+ * set to the dead time.
+ */
+
+#ifndef MARLIN_HEATER_MODEL_H_
+#define MARLIN_HEATER_MODEL_H_
+
+#include "Marlin.h"
+
+#if ENABLED(PID_AUTOTUNE_FOPDT)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// Samples one step can hold, 4 bytes each in a static buffer of the autotune
+#define HEATER_MODEL_MAX_SAMPLES  120
+
+// Rise above the first sample from which the heater counts as responding
+#define HEATER_MODEL_MIN_RISE     2.0   // C
+
+typedef struct {
+  float gain;       // Steady state rise per PID output count
+  float tau;        // Time constant, s
+  float dead_time;  // s
+  float rms;        // Of the samples from the model curve, C
+  uint8_t used;     // Samples the line was fitted to
+} HeaterModel;
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Fits the model to a heating step.
+ * @param samples   Temperatures every interval seconds. The first is taken
+ *                  with the heater at rest, and power applies from then on.
+ * @param power     PID output count of the step
+ * @returns         false if the samples do not describe a first order rise
+ */
+bool HeaterModel__Fit(const float *samples, uint8_t count, float interval, float power, HeaterModel *model);
+
+/**
+ * @param kp, ki, kd  Unscaled gains, as M301 and M304 take them
+ */
+void HeaterModel__Gains(const HeaterModel *model, float *kp, float *ki, float *kd);
+
+#endif // PID_AUTOTUNE_FOPDT
+
+#endif  // MARLIN_HEATER_MODEL_H_
@@ -2,7 +2,7 @@
 #include "MCP4725.h"
 
 #include "Arduino.h"
-#include <Wire.h>
+#include "TwiQueue.h"
 
 /*================================================================================*/
 /* DAC Write Function */
@@ -16,11 +16,9 @@ void DAC_write(uint8_t address, uint16_t data_val) {
 	uint8_t byte_a = data_val >> 4;
 	uint8_t byte_b = (data_val & 0x0F) << 4;
 
-	Wire.beginTransmission(address);
-	Wire.write(config);
-	Wire.write(byte_a);
-	Wire.write(byte_b);
-	Wire.endTransmission();
+	// Queued, the TWI interrupt sends it
+	uint8_t packet[3] = { config, byte_a, byte_b };
+	TwiQueue__Write(address, packet, sizeof(packet));
 }
 
 /*================================================================================*/
@@ -35,11 +33,8 @@ void DAC_write_EEPROM(uint8_t address, uint16_t data_val) {
 	uint8_t byte_b = (data_val & 0x0F) << 4;
 
 	// Send the data over I2C
-	Wire.beginTransmission(address);
-	Wire.write(config);
-	Wire.write(byte_a);
-	Wire.write(byte_b);
-	Wire.endTransmission();
+	uint8_t packet[3] = { config, byte_a, byte_b };
+	TwiQueue__Write(address, packet, sizeof(packet));
 }
 
 /*================================================================================*/
@@ -57,7 +52,7 @@ void DAC_read(uint8_t address) {
 /* DAC I2C initialization */
 /*================================================================================*/
 void DAC_i2c_init(void) {
-	Wire.begin();
+	TwiQueue__Init();
 	// Set inital output to 0
 	DAC_write(MCP4725_I2C_ADDRESS, 0);
 }
@@ -8,7 +8,6 @@
 #define MCP4725_H
 
 #include "Arduino.h"
-#include <Wire.h>
 
 /*================================================================================*/
 /* I2C ADDRESS */
@@ -362,9 +362,15 @@ extern uint8_t active_extruder;
 #endif
 
 #if ENABLED(PNEUMATICS)
+  extern uint8_t solenoid_state; // Solenoids open from the next planned move on, bit per tool
   void disable_all_solenoids(void);
 #endif
 
+#if ENABLED(E_REGULATOR)
+  extern float regulator_setpoint; // Regulator pressure from the next planned move on (psi)
+  void set_regulator_setpoint(float psi);
+#endif
+
 extern void calculate_volumetric_multipliers();
 
 #endif //MARLIN_H
@@ -29,11 +29,14 @@
 #if defined(UBRRH) || defined(UBRR0H) || defined(UBRR1H) || defined(UBRR2H) || defined(UBRR3H)
 
 #if UART_PRESENT(SERIAL_PORT)
-  ring_buffer rx_buffer  =  { { 0 }, 0, 0 };
+  ring_buffer rx_buffer  =  { { 0 }, 0, 0, 0 };
+  #if TX_BUFFER_SIZE > 0
+    tx_ring_buffer tx_buffer = { { 0 }, 0, 0 };
+  #endif
 #endif
 
 FORCE_INLINE void store_char(unsigned char c) {
-  int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
+  uint8_t i = (rx_buffer.head + 1) & (RX_BUFFER_SIZE - 1);
 
   // if we should be storing the received character into the location
   // just before the tail (meaning that the head would advance to the
@@ -43,6 +46,8 @@ FORCE_INLINE void store_char(unsigned char c) {
     rx_buffer.buffer[rx_buffer.head] = c;
     rx_buffer.head = i;
   }
+  else
+    rx_buffer.overflows++;
 }
 
 
@@ -56,6 +61,20 @@ FORCE_INLINE void store_char(unsigned char c) {
   }
 #endif
 
+#if TX_BUFFER_SIZE > 0
+  // Sends the next queued byte, and stops the interrupt once none is left
+  FORCE_INLINE void _tx_udr_empty_irq(void) {
+    uint8_t t = tx_buffer.tail;
+    M_UDRx = tx_buffer.buffer[t];
+    tx_buffer.tail = t = (t + 1) & (TX_BUFFER_SIZE - 1);
+    if (t == tx_buffer.head) cbi(M_UCSRxB, M_UDRIEx);
+  }
+
+  ISR(M_USARTx_UDRE_vect) {
+    _tx_udr_empty_irq();
+  }
+#endif
+
 // Constructors ////////////////////////////////////////////////////////////////
 
 MarlinSerial::MarlinSerial() { }
@@ -96,8 +115,53 @@ void MarlinSerial::end() {
   cbi(M_UCSRxB, M_RXENx);
   cbi(M_UCSRxB, M_TXENx);
   cbi(M_UCSRxB, M_RXCIEx);  
+  #if TX_BUFFER_SIZE > 0
+    cbi(M_UCSRxB, M_UDRIEx);
+    tx_buffer.head = tx_buffer.tail;
+  #endif
 }
 
+#if TX_BUFFER_SIZE > 0
+
+  /**
+   * Sends or queues one byte. Safe from an ISR: each attempt runs with
+   * interrupts off, so a write from an ISR can't take the ring slot of one it
+   * interrupted. Messages are only locked a byte at a time, so the bytes of
+   * one from an ISR can still land between those of a main loop message.
+   * While the ring is full the UDRE interrupt gets in between attempts, or
+   * with interrupts off (kill(), inside an ISR) is fed from here since it
+   * can't run.
+   */
+  void MarlinSerial::write(uint8_t c) {
+    for (;;) {
+      bool done = true;
+      CRITICAL_SECTION_START;
+        uint8_t h = tx_buffer.head, i = (h + 1) & (TX_BUFFER_SIZE - 1);
+        // Straight to the UART while nothing is waiting for it
+        if (h == tx_buffer.tail && TEST(M_UCSRxA, M_UDREx)) {
+          M_UDRx = c;
+          tx_queued++;
+        }
+        else if (i != tx_buffer.tail) {
+          tx_buffer.buffer[h] = c;
+          tx_buffer.head = i;
+          sbi(M_UCSRxB, M_UDRIEx);
+          tx_queued++;
+        }
+        #if ENABLED(TX_BUFFER_DROP)
+          else if (TEST(_sreg, SREG_I))
+            tx_dropped++;
+        #endif
+        else
+          done = false;
+      CRITICAL_SECTION_END;
+      if (done) return;
+      if (!TEST(SREG, SREG_I) && TEST(M_UCSRxA, M_UDREx)) _tx_udr_empty_irq();
+    }
+  }
+
+#endif // TX_BUFFER_SIZE > 0
+
 
 int MarlinSerial::peek(void) {
   if (rx_buffer.head == rx_buffer.tail) {
@@ -114,11 +178,18 @@ int MarlinSerial::read(void) {
   }
   else {
     unsigned char c = rx_buffer.buffer[rx_buffer.tail];
-    rx_buffer.tail = (unsigned int)(rx_buffer.tail + 1) % RX_BUFFER_SIZE;
+    rx_buffer.tail = (rx_buffer.tail + 1) & (RX_BUFFER_SIZE - 1);
     return c;
   }
 }
 
+uint16_t MarlinSerial::rxOverflows(void) {
+  CRITICAL_SECTION_START;
+    uint16_t overflows = rx_buffer.overflows;
+  CRITICAL_SECTION_END;
+  return overflows;
+}
+
 void MarlinSerial::flush() {
   // don't reverse this or there may be problems if the RX interrupt
   // occurs after reading the value of rx_buffer_head but before writing
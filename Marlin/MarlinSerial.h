@@ -54,6 +54,8 @@
 #define M_UBRRxL SERIAL_REGNAME(UBRR,SERIAL_PORT,L)
 #define M_RXCx SERIAL_REGNAME(RXC,SERIAL_PORT,)
 #define M_USARTx_RX_vect SERIAL_REGNAME(USART,SERIAL_PORT,_RX_vect)
+#define M_UDRIEx SERIAL_REGNAME(UDRIE,SERIAL_PORT,)
+#define M_USARTx_UDRE_vect SERIAL_REGNAME(USART,SERIAL_PORT,_UDRE_vect)
 #define M_U2Xx SERIAL_REGNAME(U2X,SERIAL_PORT,)
 
 
@@ -68,20 +70,35 @@
 // Define constants and variables for buffering incoming serial data.  We're
 // using a ring buffer (I think), in which rx_buffer_head is the index of the
 // location to which to write the next incoming character and rx_buffer_tail
-// is the index of the location from which to read.
-#define RX_BUFFER_SIZE 128
-
+// is the index of the location from which to read. RX_BUFFER_SIZE is set in
+// Configuration_adv.h, a power of 2 so the indexes wrap with a mask.
 
 struct ring_buffer {
   unsigned char buffer[RX_BUFFER_SIZE];
-  int head;
-  int tail;
+  volatile uint8_t head;
+  volatile uint8_t tail;
+  uint16_t overflows; // Bytes dropped because the ring was full
 };
 
 #if UART_PRESENT(SERIAL_PORT)
   extern ring_buffer rx_buffer;
 #endif
 
+#if TX_BUFFER_SIZE > 0
+  // Output waiting for the UART. write() moves the head with interrupts off.
+  // The tail is moved by the UDRE interrupt, or by write() feeding the UART
+  // itself while interrupts are off, so it never has two movers at once.
+  struct tx_ring_buffer {
+    unsigned char buffer[TX_BUFFER_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+  };
+
+  #if UART_PRESENT(SERIAL_PORT)
+    extern tx_ring_buffer tx_buffer;
+  #endif
+#endif
+
 class MarlinSerial { //: public Stream
 
   public:
@@ -93,20 +110,31 @@ class MarlinSerial { //: public Stream
     void flush(void);
 
     FORCE_INLINE int available(void) {
-      return (unsigned int)(RX_BUFFER_SIZE + rx_buffer.head - rx_buffer.tail) % RX_BUFFER_SIZE;
+      return (uint8_t)(rx_buffer.head - rx_buffer.tail) & (RX_BUFFER_SIZE - 1);
     }
 
-    FORCE_INLINE void write(uint8_t c) {
-      while (!TEST(M_UCSRxA, M_UDREx))
-        ;
+    // Bytes dropped since power on because the RX ring was full
+    uint16_t rxOverflows(void);
 
-      M_UDRx = c;
-    }
+    #if TX_BUFFER_SIZE > 0
+      void write(uint8_t c);
+
+      // Bytes sent or queued, and dropped by TX_BUFFER_DROP, since power on
+      FORCE_INLINE uint32_t txQueued(void) { return tx_queued; }
+      FORCE_INLINE uint32_t txDropped(void) { return tx_dropped; }
+    #else
+      FORCE_INLINE void write(uint8_t c) {
+        while (!TEST(M_UCSRxA, M_UDREx))
+          ;
+
+        M_UDRx = c;
+      }
+    #endif
 
     FORCE_INLINE void checkRx(void) {
       if (TEST(M_UCSRxA, M_RXCx)) {
         unsigned char c  =  M_UDRx;
-        int i = (unsigned int)(rx_buffer.head + 1) % RX_BUFFER_SIZE;
+        uint8_t i = (rx_buffer.head + 1) & (RX_BUFFER_SIZE - 1);
 
         // if we should be storing the received character into the location
         // just before the tail (meaning that the head would advance to the
@@ -116,6 +144,8 @@ class MarlinSerial { //: public Stream
           rx_buffer.buffer[rx_buffer.head] = c;
           rx_buffer.head = i;
         }
+        else
+          rx_buffer.overflows++;
       }
     }
 
@@ -123,6 +153,11 @@ class MarlinSerial { //: public Stream
     void printNumber(unsigned long, uint8_t);
     void printFloat(double, uint8_t);
 
+    #if TX_BUFFER_SIZE > 0
+      uint32_t tx_queued;
+      uint32_t tx_dropped;
+    #endif
+
   public:
     FORCE_INLINE void write(const char *str) { while (*str) write(*str++); }
     FORCE_INLINE void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
@@ -51,7 +51,7 @@
 #include "pins_arduino.h"
 #include "math.h"
 #include "buzzer.h"
-#include "Wire.h"
+#include "TwiQueue.h"
 #include "Cartridge.h"
 #include "Voxel8_I2C_Commands.h"
 #include "HeatedBed.h"
@@ -61,6 +61,18 @@
   #include "ADC.h"
 #endif
 
+#if ENABLED(LASER_BED_SCAN)
+  #include "BedScan.h"
+#endif
+
+#if ENABLED(PRESSURE_ADVANCE)
+  #include "PressureAdvance.h"
+#endif
+
+#if ENABLED(PNEUMATIC_PUMP_PWM)
+  #include "PneumaticPump.h"
+#endif
+
 #if ENABLED(DAC_I2C)
   #include "MCP4725.h"
 #endif
@@ -69,6 +81,20 @@
   #include "Regulator.h"
 #endif
 
+#if ENABLED(BINARY_PROTOCOL)
+  #include "BinaryProtocol.h"
+#endif
+
+#include "CommandRing.h"
+
+#if ENABLED(TELEMETRY)
+  #include "Telemetry.h"
+#endif
+
+#if ENABLED(SEGMENT_MERGE)
+  #include "SegmentMerge.h"
+#endif
+
 #if ENABLED(BLINKM)
   #include "blinkm.h"
 #endif
@@ -108,6 +134,8 @@
  * G11 - retract recover filament according to settings of M208
  * G28 - Home one or more axes
  * G29 - Detailed Z probe, probes the bed at 3 or more points.  Will fail if you haven't homed yet.
+ *        S1 scans the whole bed with the laser while moving (LASER_BED_SCAN) and,
+ *           with LASER_MESH_LEVELING, compensates with the scanned mesh.
  * G30 - Single Z probe, probes bed at current XY location.
  * G31 - Dock sled (Z_PROBE_SLED only)
  * G32 - Undock sled (Z_PROBE_SLED only)
@@ -172,6 +200,7 @@
  * M140 - Set bed target temp
  * M145 - Set the heatup state H<hotend> B<bed> F<fan speed> for S<material> (0=PLA, 1=ABS)
  * M150 - Set BlinkM Color Output R: Red<0-255> U(!): Green<0-255> B: Blue<0-255> over i2c, G for green does not work.
+ * M155 - Telemetry: report every S<seconds> the channels of mask C, S0 stops (TELEMETRY)
  * M190 - Sxxx Wait for bed current temp to reach target temp. Waits only when heating
  *        Rxxx Wait for bed current temp to reach target temp. Waits when heating and cooling
  * M200 - set filament diameter and set E axis units to cubic millimeters (use S0 to set back to millimeters).:D<millimeters>-
@@ -191,23 +220,26 @@
  * M226 - Wait until the specified pin reaches the state required: P<pin number> S<pin state>
  * M234 - Output raw external ADC value (or averaged value over S samples if an S parameter is given)
  * M235 - Output distance sensor data (or averaged value over S samples if an S parameter is given)
- * M236 - Set output target pressure by writing to DAC
+ * M236 - Set output target pressure by writing to DAC when the next move starts
  * M237 - Custom, more precise auto bed leveling
  * M238 - Return ADC value from laser sensor (get distance)
  * M239 - Homing and bed leveling combination
  * M240 - Trigger a camera to take a photograph
  * M241 - Dwell for a given amount of time in milliseconds (500 by default)
  * M242 - General I2C Message Interface A<address> P<command> S<value>
+ * M246 - Pressure advance: L<lead time ms> K<gain 0-1> (PRESSURE_ADVANCE)
  * M247 - UV S<value> 0/255 to enable/disable 
+ * M249 - Pressure sensor statistics since the last M249 R (PNEUMATICS)
  * M250 - Set LCD contrast C<contrast value> (value 0..63)
+ * M256 - Batched ok with queue credits: S1 on, S0 one ok per command (BATCHED_OK)
  * M280 - Set servo position absolute. P: servo index, S: angle or microseconds
  * M300 - Play beep sound S<frequency Hz> P<duration ms>
  * M301 - Set PID parameters P I and D
  * M302 - Allow cold extrudes, or set the minimum extrude S<temperature>.
- * M303 - PID relay autotune S<temperature> sets the target temperature. (default target temperature = 150C)
+ * M303 - PID autotune S<temperature> sets the target temperature. (default target temperature = 150C) U1 stores the step autotune gains
  * M304 - Set bed PID parameters P I and D
- * M380 - Activate solenoid on active extruder
- * M381 - Disable all solenoids
+ * M380 - Activate solenoid on active extruder when the next move starts
+ * M381 - Disable all solenoids when the next move starts
  * M399 - Pause command
  * M400 - Finish all moves
  * M401 - Lower Z probe if present
@@ -217,7 +249,7 @@
  * M406 - Turn off Filament Sensor extrusion control
  * M407 - Display measured filament diameter
  * M410 - Quickstop. Abort all the planned moves
- * M420 - Enable/Disable Mesh Leveling (with current values) S1=enable S0=disable
+ * M420 - Enable/Disable Mesh Leveling (with current values) S1=enable S0=disable. Also the laser scan mesh (LASER_MESH_LEVELING)
  * M421 - Set a single Z coordinate in the Mesh Leveling grid. X<mm> Y<mm> Z<mm>
  * M428 - Set the home_offset logically based on the current_position
  * M500 - Store parameters in EEPROM
@@ -287,7 +319,7 @@ uint8_t marlin_debug_flags = DEBUG_INFO|DEBUG_ERRORS;
 static float feedrate = 1500.0, saved_feedrate;
 float current_position[NUM_AXIS] = { 0.0 };
 static float destination[NUM_AXIS] = { 0.0 };
-static uint16_t bedlevelprobes[9] = { 0.0 };
+static uint16_t bedlevelprobes[9] = { 0 };
 bool axis_known_position[3] = { false };
 bool min_software_endstops_enabled[Z_AXIS + 1] = { false };
 bool max_software_endstops_enabled[Z_AXIS + 1] = { false };
@@ -295,10 +327,62 @@ bool max_software_endstops_enabled[Z_AXIS + 1] = { false };
 static long gcode_N, gcode_LastN, Stopped_gcode_LastN = 0;
 
 static char *current_command, *current_command_args;
-static int cmd_queue_index_r = 0;
-static int cmd_queue_index_w = 0;
-static int commands_in_queue = 0;
-static char command_queue[BUFSIZE][MAX_CMD_SIZE];
+static uint8_t current_command_flags; ///< CMD_FROM_SD, or the binary frame type the command came in
+
+// Flags of queued commands, next to the BINARY_FRAME_* type
+#define CMD_FRAME_MASK 0x0F
+#define CMD_ACKED      0x40 // Acked as it was queued (BATCHED_OK)
+#define CMD_FROM_SD    0x80
+
+#if ENABLED(BATCHED_OK)
+  static bool batched_ok = false;         // M256 S1
+  static bool batched_ok_pending = false; // Lines queued since the last ok
+#endif
+
+// Queued commands, byte-packed; see CommandRing.h
+static char command_buffer[CMD_RING_SIZE];
+static CommandRing command_queue = { command_buffer, CMD_RING_SIZE, 0, 0, 0 };
+
+#if ENABLED(PRIORITY_COMMANDS)
+  // Status queries and stops from the serial port, run ahead of the queue
+  static char priority_buffer[PRIORITY_RING_SIZE];
+  static CommandRing priority_lane = { priority_buffer, PRIORITY_RING_SIZE, 0, 0, 0 };
+#endif
+
+// The line being read from the serial port or SD card, or the binary frame.
+// Once complete it waits here until it fits in the queue, and nothing more
+// is read meanwhile.
+static char serial_line[MAX_CMD_SIZE];
+static uint8_t serial_line_length = 0; ///< Bytes of a complete line waiting for room, 0 if none
+static uint8_t serial_line_flags;
+static uint8_t serial_checksum;        ///< XOR of the serial line up to its first '*', kept as it is read
+static int serial_checksum_end;        ///< Index of that '*', -1 until there is one
+
+/**
+ * Parameters of the running command, parsed once when it starts so that
+ * code_seen() and code_value() don't have to scan the string again.
+ * Parameters are kept sorted by letter; a letter's index is the number of
+ * lower letters present, counted from the 'seen' mask.
+ */
+#define MAX_CMD_PARAMS 8
+#define CMD_PARAMS_UNPARSED 0xFF // More parameters than fit; code_seen() scans the string
+
+typedef struct {
+  uint8_t command;                ///< Offset of the G, M or T code, past any line number
+  uint8_t args;                   ///< Offset of the first parameter
+  uint8_t count;                  ///< Number of parameters, or CMD_PARAMS_UNPARSED
+  uint32_t seen;                  ///< Bit (letter - 'A') set for each parameter letter present
+  uint8_t offset[MAX_CMD_PARAMS]; ///< Offset of each parameter letter
+  float value[MAX_CMD_PARAMS];    ///< Value of each parameter, as code_value() would read it
+} command_params_t;
+
+static command_params_t command_params;
+#if ENABLED(PRIORITY_COMMANDS)
+  static command_params_t priority_params;
+#endif
+static command_params_t *current_params = &command_params;
+static float seen_value;       ///< Value of the parameter found by code_seen()
+static bool seen_value_parsed; ///< seen_value is valid for seen_pointer
 
 const float homing_feedrate[] = HOMING_FEEDRATE;
 bool axis_relative_modes[] = AXIS_RELATIVE_MODES;
@@ -347,6 +431,10 @@ bool target_direction;
   float z_endstop_adj = 0;
 #endif
 
+#if ENABLED(PNEUMATICS)
+  uint8_t solenoid_state = 0;
+#endif
+
 #if ENABLED(E_REGULATOR)
   float regulator_setpoint = 0;
 #endif
@@ -465,10 +553,6 @@ bool target_direction;
    static bool filrunoutEnqueued = false;
 #endif
 
-#if ENABLED(SDSUPPORT)
-  static bool fromsd[BUFSIZE];
-#endif
-
 #if HAS_SERVOS
   Servo servo[NUM_SERVOS];
 #endif
@@ -488,6 +572,10 @@ bool target_direction;
 
 void process_next_command();
 
+#if ENABLED(PRIORITY_COMMANDS)
+  void process_priority_commands(bool between_commands);
+#endif
+
 void plan_arc(float target[NUM_AXIS], float *offset, uint8_t clockwise);
 
 bool setTargetedHotend(int code);
@@ -505,6 +593,8 @@ void serial_echopair_P(const char *s_P, unsigned long v) { serialprintPGM(s_P);
 #if ENABLED(SDSUPPORT)
   #include "SdFatUtil.h"
   int freeMemory() { return SdFatUtil::FreeRam(); }
+#elif defined(UNIT_TEST)
+  int freeMemory() { return 0; } // The host has no AVR heap layout to measure
 #else
   extern "C" {
     extern unsigned int __bss_end;
@@ -524,6 +614,56 @@ void serial_echopair_P(const char *s_P, unsigned long v) { serialprintPGM(s_P);
   }
 #endif //!SDSUPPORT
 
+/**
+ * Parse a command once as it starts, so process_command(), code_seen() and
+ * code_value() don't have to scan it again:
+ *  - Skip leading spaces and N[-0-9]*[ ]*
+ *  - Find the first parameter
+ *  - Record the first occurrence of each parameter letter up to '*'
+ * Values are read like the old code_value(): strtod, cut off at the next 'E'.
+ */
+static void parse_command_params(char *command, command_params_t &params) {
+
+  char *p = command;
+  while (*p == ' ') ++p;
+  if (*p == 'N' && ((p[1] >= '0' && p[1] <= '9') || p[1] == '-')) {
+    p += 2; // skip N[-0-9]
+    while (*p >= '0' && *p <= '9') ++p; // skip [0-9]*
+    while (*p == ' ') ++p; // skip [ ]*
+  }
+  params.command = p - command;
+  while (*p && *p != ' ' && *p != '*') ++p;
+  while (*p == ' ') ++p;
+  params.args = p - command;
+
+  params.count = 0;
+  params.seen = 0;
+  for (; *p && *p != '*'; ++p) {
+    if (*p < 'A' || *p > 'Z') continue;
+    uint32_t bit = 1UL << (*p - 'A');
+    if (params.seen & bit) continue; // code_seen() only ever finds the first one
+    if (params.count == MAX_CMD_PARAMS) {
+      params.count = CMD_PARAMS_UNPARSED;
+      return;
+    }
+
+    char *e = strchr(p, 'E');
+    if (e) *e = '\0';
+    float value = strtod(p + 1, NULL);
+    if (e) *e = 'E';
+
+    // Insert sorted by letter
+    uint8_t i = params.count++;
+    for (; i && command[params.offset[i - 1]] > *p; i--) {
+      params.offset[i] = params.offset[i - 1];
+      params.value[i] = params.value[i - 1];
+    }
+    params.offset[i] = p - command;
+    params.value[i] = value;
+    params.seen |= bit;
+  }
+}
+
 /**
  * Inject the next command from the command queue, when possible
  * Return false only if no command was pending
@@ -568,17 +708,13 @@ void enqueuecommands_P(const char* pgcode) {
  */
 bool enqueuecommand(const char *cmd) {
 
-  if (*cmd == ';' || commands_in_queue >= BUFSIZE) return false;
+  size_t length = strlen(cmd) + 1;
+  if (*cmd == ';' || length > MAX_CMD_SIZE || !CommandRing__Push(&command_queue, cmd, length, 0)) return false;
 
-  // This is dangerous if a mixing of serial and this happens
-  char *command = command_queue[cmd_queue_index_w];
-  strcpy(command, cmd);
   SERIAL_ECHO_START;
   SERIAL_ECHOPGM(MSG_Enqueueing);
-  SERIAL_ECHO(command);
+  SERIAL_ECHO(cmd);
   SERIAL_ECHOLNPGM("\"");
-  cmd_queue_index_w = (cmd_queue_index_w + 1) % BUFSIZE;
-  commands_in_queue++;
   return true;
 }
 
@@ -809,10 +945,6 @@ void setup() {
   SERIAL_ECHOPGM(MSG_PLANNER_BUFFER_BYTES);
   SERIAL_ECHOLN((int)sizeof(block_t)*BLOCK_BUFFER_SIZE);
 
-  #if ENABLED(SDSUPPORT)
-    for (int8_t i = 0; i < BUFSIZE; i++) fromsd[i] = false;
-  #endif
-
   // loads data from EEPROM if available else uses defaults (and resets step acceleration rate)
   Config_RetrieveSettings();
 
@@ -873,6 +1005,24 @@ void setup() {
   }
 }
 
+#if ENABLED(BATCHED_OK)
+
+  /**
+   * One ok for every line queued since the last, with the room left for more.
+   * See BATCHED_OK in Configuration_adv.h.
+   */
+  static void send_batched_ok() {
+    if (!batched_ok_pending) return;
+    batched_ok_pending = false;
+    SERIAL_PROTOCOLPGM(MSG_OK);
+    SERIAL_PROTOCOLPGM(" N"); SERIAL_PROTOCOL(gcode_LastN);
+    SERIAL_PROTOCOLPGM(" Q"); SERIAL_PROTOCOL((int)CommandRing__Room(&command_queue));
+    SERIAL_PROTOCOLPGM(" P"); SERIAL_PROTOCOL(int(BLOCK_BUFFER_SIZE - movesplanned() - 1));
+    SERIAL_EOL;
+  }
+
+#endif // BATCHED_OK
+
 /**
  * The main Marlin program loop
  *
@@ -884,18 +1034,26 @@ void setup() {
  *  - Call LCD update
  */
 void loop() {
-  if (commands_in_queue < BUFSIZE - 1) get_command();
+  get_command();
+
+  #if ENABLED(BATCHED_OK)
+    send_batched_ok();
+  #endif
 
   #if ENABLED(SDSUPPORT)
     card.checkautostart(false);
   #endif
 
-  if (commands_in_queue) {
+  #if ENABLED(PRIORITY_COMMANDS)
+    process_priority_commands(true);
+  #endif
+
+  if (CommandRing__Count(&command_queue)) {
 
     #if ENABLED(SDSUPPORT)
 
       if (card.saving) {
-        char *command = command_queue[cmd_queue_index_r];
+        char *command = CommandRing__Front(&command_queue, NULL);
         if (strstr_P(command, PSTR("M29"))) {
           // M29 closes the file
           card.closefile();
@@ -919,8 +1077,7 @@ void loop() {
 
     #endif // SDSUPPORT
 
-    commands_in_queue--;
-    cmd_queue_index_r = (cmd_queue_index_r + 1) % BUFSIZE;
+    CommandRing__Pop(&command_queue);
   }
   checkHitEndstops();
   idle();
@@ -931,10 +1088,128 @@ void gcode_line_error(const char *err, bool doFlush=true) {
   serialprintPGM(err);
   SERIAL_ERRORLN(gcode_LastN);
   //Serial.println(gcode_N);
+
+  // Bytes lost to a full RX ring are the usual cause of a burst of these
+  static uint16_t reported_overflows = 0;
+  uint16_t overflows = MYSERIAL.rxOverflows();
+  if (overflows != reported_overflows) {
+    SERIAL_ECHO_START;
+    SERIAL_ECHOPGM(MSG_RX_OVERFLOW);
+    SERIAL_ECHOLN((uint16_t)(overflows - reported_overflows));
+    reported_overflows = overflows;
+  }
+
   if (doFlush) FlushSerialRequestResend();
   serial_count = 0;
 }
 
+#if ENABLED(PRIORITY_COMMANDS)
+
+  /**
+   * M code of a command line, after an optional line number
+   * @param args  Set to the text after the code
+   * @returns     -1 if it isn't an M code
+   */
+  static int command_m_code(const char *command, char **args) {
+    while (*command == ' ') ++command;
+    if (*command == 'N') {
+      ++command;
+      while (*command == '-' || (*command >= '0' && *command <= '9')) ++command;
+      while (*command == ' ') ++command;
+    }
+    if (*command != 'M') return -1;
+    return strtol(command + 1, args, 10);
+  }
+
+  /**
+   * Status queries and stops, which are safe to run ahead of queued moves:
+   * M105, M114, M236 V and M410. The queries also run while another command
+   * is running, M410 only between commands.
+   */
+  static bool is_priority_command(const char *command) {
+    char *args;
+    switch (command_m_code(command, &args)) {
+      case 105: case 114: case 410:
+        return true;
+      case 236:
+        return !strchr(args, 'S') && (strchr(args, 'V') || strchr(args, 'v'));
+    }
+    return false;
+  }
+
+#endif // PRIORITY_COMMANDS
+
+/**
+ * Moves the complete line in serial_line to the command queue, or to the
+ * priority lane if it is a status query from the host.
+ * @returns  false if it has to wait for room in the queue
+ */
+static bool queue_serial_line() {
+  bool queued = false;
+  #if ENABLED(PRIORITY_COMMANDS)
+    // Only text from the host. A query too long for the lane takes its turn in the queue.
+    bool from_host = !(serial_line_flags & CMD_FROM_SD);
+    #if ENABLED(BINARY_PROTOCOL)
+      if (serial_line_flags == BINARY_FRAME_MOVE) from_host = false;
+    #endif
+    queued = from_host && is_priority_command(serial_line)
+             && CommandRing__Push(&priority_lane, serial_line, serial_line_length, serial_line_flags);
+  #endif
+  if (!queued && !CommandRing__Push(&command_queue, serial_line, serial_line_length, serial_line_flags)) return false;
+  #if ENABLED(BATCHED_OK)
+    if (serial_line_flags & CMD_ACKED) batched_ok_pending = true;
+  #endif
+  serial_line_length = 0;
+  return true;
+}
+
+#if ENABLED(BINARY_PROTOCOL)
+
+  /**
+   * Add binary frames from the serial port to the command queue.
+   * Line frames are queued as text; move frames keep their raw payload and
+   * are executed by gcode_binary_move(). One ack covers the whole batch.
+   */
+  inline void get_binary_commands() {
+    uint8_t type;
+    while ((type = BinaryProtocol__Read(serial_line)) != BINARY_FRAME_NONE) {
+      if (type == BINARY_FRAME_MOVE && IsStopped()) {
+        SERIAL_ERRORLNPGM(MSG_ERR_STOPPED);
+        LCD_MESSAGEPGM(MSG_STOPPED);
+      }
+
+      if (type == BINARY_FRAME_LINE) {
+        // If command was e-stop process now
+        if (strcmp(serial_line, "M112") == 0) kill(PSTR(MSG_KILLED));
+        serial_line_length = strlen(serial_line) + 1;
+      }
+      else
+        serial_line_length = BinaryProtocol__FrameLength();
+
+      serial_line_flags = type;
+      if (!queue_serial_line()) break;
+    }
+    BinaryProtocol__SendAck(CommandRing__Slots(&command_queue, BINARY_MOVE_MAX_LENGTH));
+  }
+
+#endif // BINARY_PROTOCOL
+
+/**
+ * Stores a character of the line being read from the serial port, adding it
+ * to the checksum until the '*' that ends it.
+ */
+FORCE_INLINE void store_serial_char(char c) {
+  if (!serial_count) {
+    serial_checksum = 0;
+    serial_checksum_end = -1;
+  }
+  if (serial_checksum_end < 0) {
+    if (c == '*') serial_checksum_end = serial_count;
+    else serial_checksum ^= c;
+  }
+  serial_line[serial_count++] = c;
+}
+
 /**
  * Add to the circular command queue the next command from:
  *  - The command-injection queue (queued_commands_P)
@@ -945,20 +1220,28 @@ void get_command() {
 
   if (drain_queued_commands_P()) return; // priority is given to non-serial commands
 
+  // A complete line that did not fit holds up the rest
+  if (serial_line_length && !queue_serial_line()) return;
+
   #if ENABLED(NO_TIMEOUTS)
     static millis_t last_command_time = 0;
     millis_t ms = millis();
 
-    if (!MYSERIAL.available() && commands_in_queue == 0 && ms - last_command_time > NO_TIMEOUTS) {
+    if (!MYSERIAL.available() && !CommandRing__Count(&command_queue) && ms - last_command_time > NO_TIMEOUTS) {
       SERIAL_ECHOLNPGM(MSG_WAIT);
       last_command_time = ms;
     }
   #endif
 
+  #if ENABLED(BINARY_PROTOCOL)
+    if (BinaryProtocol__Enabled()) get_binary_commands();
+    else
+  #endif
+
   //
-  // Loop while serial characters are incoming and the queue is not full
+  // Loop while serial characters are incoming and the lines fit in the queue
   //
-  while (commands_in_queue < BUFSIZE && MYSERIAL.available() > 0) {
+  while (MYSERIAL.available() > 0) {
 
     #if ENABLED(NO_TIMEOUTS)
       last_command_time = ms;
@@ -976,16 +1259,11 @@ void get_command() {
 
       if (!serial_count) return; // empty lines just exit
 
-      char *command = command_queue[cmd_queue_index_w];
+      char *command = serial_line;
       command[serial_count] = 0; // terminate string
 
-      // this item in the queue is not from sd
-      #if ENABLED(SDSUPPORT)
-        fromsd[cmd_queue_index_w] = false;
-      #endif
-
       char *npos = strchr(command, 'N');
-      char *apos = strchr(command, '*');
+      char *apos = serial_checksum_end < 0 ? NULL : command + serial_checksum_end;
       if (npos) {
 
         boolean M110 = strstr_P(command, PSTR("M110")) != NULL;
@@ -1003,10 +1281,7 @@ void get_command() {
         }
 
         if (apos) {
-          byte checksum = 0, count = 0;
-          while (command[count] != '*') checksum ^= command[count++];
-
-          if (strtol(apos + 1, NULL, 10) != checksum) {
+          if (strtol(apos + 1, NULL, 10) != serial_checksum) {
             gcode_line_error(PSTR(MSG_ERR_CHECKSUM_MISMATCH));
             return;
           }
@@ -1045,22 +1320,25 @@ void get_command() {
       // If command was e-stop process now
       if (strcmp(command, "M112") == 0) kill(PSTR(MSG_KILLED));
 
-      cmd_queue_index_w = (cmd_queue_index_w + 1) % BUFSIZE;
-      commands_in_queue += 1;
-
+      serial_line_length = serial_count + 1;
+      serial_line_flags = 0;
+      #if ENABLED(BATCHED_OK)
+        if (batched_ok) serial_line_flags = CMD_ACKED;
+      #endif
       serial_count = 0; //clear buffer
+      if (!queue_serial_line()) return;
     }
     else if (serial_char == '\\') {  // Handle escapes
-      if (MYSERIAL.available() > 0 && commands_in_queue < BUFSIZE) {
+      if (MYSERIAL.available() > 0) {
         // if we have one more character, copy it over
         serial_char = MYSERIAL.read();
-        command_queue[cmd_queue_index_w][serial_count++] = serial_char;
+        store_serial_char(serial_char);
       }
       // otherwise do nothing
     }
     else { // its not a newline, carriage return or escape char
       if (serial_char == ';') comment_mode = true;
-      if (!comment_mode) command_queue[cmd_queue_index_w][serial_count++] = serial_char;
+      if (!comment_mode) store_serial_char(serial_char);
     }
   }
 
@@ -1073,9 +1351,9 @@ void get_command() {
     // this character _can_ occur in serial com, due to checksums. however, no checksums are used in SD printing
 
     static bool stop_buffering = false;
-    if (commands_in_queue == 0) stop_buffering = false;
+    if (!CommandRing__Count(&command_queue)) stop_buffering = false;
 
-    while (!card.eof() && commands_in_queue < BUFSIZE && !stop_buffering) {
+    while (!card.eof() && !stop_buffering) {
       int16_t n = card.get();
       serial_char = (char)n;
       if (serial_char == '\n' || serial_char == '\r' ||
@@ -1101,18 +1379,16 @@ void get_command() {
           comment_mode = false; //for new command
           return; //if empty line
         }
-        command_queue[cmd_queue_index_w][serial_count] = 0; //terminate string
-        // if (!comment_mode) {
-        fromsd[cmd_queue_index_w] = true;
-        commands_in_queue += 1;
-        cmd_queue_index_w = (cmd_queue_index_w + 1) % BUFSIZE;
-        // }
+        serial_line[serial_count] = 0; //terminate string
+        serial_line_length = serial_count + 1;
+        serial_line_flags = CMD_FROM_SD;
         comment_mode = false; //for new command
         serial_count = 0; //clear buffer
+        if (!queue_serial_line()) return;
       }
       else {
         if (serial_char == ';') comment_mode = true;
-        if (!comment_mode) command_queue[cmd_queue_index_w][serial_count++] = serial_char;
+        if (!comment_mode) serial_line[serial_count++] = serial_char;
       }
     }
 
@@ -1128,6 +1404,7 @@ bool code_has_value() {
 }
 
 float code_value() {
+  if (seen_value_parsed) return seen_value;
   float ret;
   char *e = strchr(seen_pointer, 'E');
   if (e) {
@@ -1145,6 +1422,22 @@ long code_value_long() { return strtol(seen_pointer + 1, NULL, 10); }
 int16_t code_value_short() { return (int16_t)strtol(seen_pointer + 1, NULL, 10); }
 
 bool code_seen(char code) {
+  const command_params_t &params = *current_params;
+  if (params.count != CMD_PARAMS_UNPARSED && code >= 'A' && code <= 'Z') {
+    uint32_t bit = 1UL << (code - 'A');
+    if (!(params.seen & bit)) {
+      seen_pointer = NULL;
+      return false;
+    }
+    // Index among the sorted parameters = number of lower letters seen
+    uint8_t i = 0;
+    for (uint32_t lower = params.seen & (bit - 1); lower; lower &= lower - 1) i++;
+    seen_pointer = current_command - params.command + params.offset[i];
+    seen_value = params.value[i];
+    seen_value_parsed = true;
+    return true;
+  }
+  seen_value_parsed = false;
   seen_pointer = strchr(current_command_args, code);
   return (seen_pointer != NULL); // Return TRUE if the code-letter was found
 }
@@ -1661,6 +1954,73 @@ static void setup_for_endstop_move() {
     }
   #endif
 
+  #if ENABLED(LASER_BED_SCAN)
+    /**
+     * Sweep the laser over the scan grid, one row at a time in alternating
+     * directions. Samples are binned while the head moves (see BedScan.h).
+     * Each row starts and ends half a grid spacing outside the grid so the
+     * end cells are covered as well as the inner ones.
+     * Returns false if no samples were collected.
+     */
+    static bool bed_scan_raster(int verbose_level) {
+      float oldFeedRate = feedrate;
+      float left = max(LEFT_SCAN_BED_POSITION - X_PROBE_OFFSET_FROM_EXTRUDER - SCAN_X_DIST / 2, X_MIN_POS),
+            right = min(RIGHT_SCAN_BED_POSITION - X_PROBE_OFFSET_FROM_EXTRUDER + SCAN_X_DIST / 2, X_MAX_POS);
+
+      BedScan__Start();
+      for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++) {
+        bool reverse = j & 1;
+        do_blocking_move_to_xy(reverse ? right : left, FRONT_SCAN_BED_POSITION - Y_PROBE_OFFSET_FROM_EXTRUDER + j * SCAN_Y_DIST);
+
+        BedScan__BeginRow(j);
+        feedrate = SCAN_FEEDRATE;
+        current_position[X_AXIS] = reverse ? left : right;
+        line_to_current_position();
+        st_synchronize();
+        uint8_t empty = BedScan__EndRow();
+
+        if (verbose_level > 2 && empty) {
+          SERIAL_PROTOCOLPGM("Scan row ");
+          SERIAL_PROTOCOL((int)j);
+          SERIAL_PROTOCOLPGM(": ");
+          SERIAL_PROTOCOL((int)empty);
+          SERIAL_PROTOCOLLNPGM(" cells without samples");
+        }
+      }
+      feedrate = oldFeedRate;
+
+      if (!BedScan__Finish()) {
+        SERIAL_ERROR_START;
+        SERIAL_ERRORLNPGM("Laser bed scan got no samples");
+        return false;
+      }
+
+      if (verbose_level > 1) {
+        SERIAL_PROTOCOLLNPGM("Bed scan heights (mm), back to front:");
+        for (int8_t j = SCAN_GRID_POINTS - 1; j >= 0; j--) {
+          for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++) {
+            SERIAL_PROTOCOL_F(BedScan__Height(i, j), 3);
+            SERIAL_PROTOCOLCHAR(' ');
+          }
+          SERIAL_EOL;
+        }
+      }
+      return true;
+    }
+
+    #if ENABLED(LASER_MESH_LEVELING)
+      /**
+       * Turn the laser mesh on or off, keeping the head where it is
+       */
+      static void set_laser_mesh_active(bool value) {
+        st_synchronize();
+        if (BedScan__MeshActive()) current_position[Z_AXIS] += BedScan__MeshZ(current_position[X_AXIS], current_position[Y_AXIS]);
+        if (BedScan__SetMeshActive(value)) current_position[Z_AXIS] -= BedScan__MeshZ(current_position[X_AXIS], current_position[Y_AXIS]);
+        sync_plan_position();
+      }
+    #endif
+  #endif
+
   static void clean_up_after_endstop_move() {
     #if ENABLED(ENDSTOPS_ONLY_FOR_HOMING)
       #if ENABLED(DEBUG_LEVELING_FEATURE)
@@ -2419,6 +2779,28 @@ inline void gcode_G0_G1() {
   }
 }
 
+#if ENABLED(BINARY_PROTOCOL)
+
+  /**
+   * Binary move frame: G0/G1 with the values already decoded
+   */
+  inline void gcode_binary_move() {
+    if (IsRunning()) {
+      float values[BINARY_MOVE_FIELDS];
+      uint8_t fields = BinaryProtocol__DecodeMove(current_command, values);
+      for (int i = 0; i < NUM_AXIS; i++) {
+        if (TEST(fields, i))
+          destination[i] = values[i] + (axis_relative_modes[i] || relative_mode ? current_position[i] : 0);
+        else
+          destination[i] = current_position[i];
+      }
+      if (TEST(fields, BINARY_MOVE_F) && values[BINARY_MOVE_F] > 0.0) feedrate = values[BINARY_MOVE_F];
+      prepare_move();
+    }
+  }
+
+#endif // BINARY_PROTOCOL
+
 /**
  * G2: Clockwise Arc
  * G3: Counterclockwise Arc
@@ -2523,6 +2905,9 @@ inline void gcode_G28() {
       #if ENABLED(DELTA)
         reset_bed_level();
       #endif
+      #if ENABLED(LASER_MESH_LEVELING)
+        set_laser_mesh_active(false);
+      #endif
     #endif
   
     // For manual bed leveling deactivate the matrix temporarily
@@ -2888,6 +3273,7 @@ inline void gcode_G28() {
 #if ENABLED(AUTO_BED_LEVELING_FEATURE) && ENABLED(EXT_ADC)
   /*
   * G29 - Custom, more precise auto bed leveling
+  *       S1 - Scan the bed with the laser while moving instead of probing 3 points
   */
   inline void gcode_G29() {
     if (HeatedBed__PresentCheck()) {
@@ -2909,6 +3295,9 @@ inline void gcode_G28() {
     
       if (!dryrun) {
         plan_bed_level_matrix.set_to_identity();
+        #if ENABLED(LASER_MESH_LEVELING)
+          BedScan__SetMeshActive(false);
+        #endif
         #ifdef DELTA
           reset_bed_level();
         #else
@@ -2923,13 +3312,42 @@ inline void gcode_G28() {
       setup_for_endstop_move();
       feedrate = homing_feedrate[Z_AXIS];
 
-      float levelProbe_1 = bed_level_probe_pt(ABL_PROBE_PT_1_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_1_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level),
-            levelProbe_2 = bed_level_probe_pt(ABL_PROBE_PT_2_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_2_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level),
-            levelProbe_3 = bed_level_probe_pt(ABL_PROBE_PT_3_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_3_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level);
-      
-      levelProbe_1 = (levelProbe_1 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
-      levelProbe_2 = (levelProbe_2 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
-      levelProbe_3 = (levelProbe_3 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
+      float levelProbe_1, levelProbe_2, levelProbe_3;
+
+      #if ENABLED(LASER_BED_SCAN)
+        // S1 - Scan the bed while moving and use the plane through the whole
+        // grid, or the grid itself with LASER_MESH_LEVELING
+        if (code_seen('S') && code_value_short() == 1) {
+          #if ENABLED(LASER_MESH_LEVELING)
+            // Scan on uncorrected coordinates. A dry run keeps the stored
+            // mesh and puts it back as it was.
+            bool mesh_was_active = BedScan__MeshActive();
+            set_laser_mesh_active(false);
+            bool scanned = bed_scan_raster(verbose_level);
+            clean_up_after_endstop_move();
+            if (scanned && !dryrun) BedScan__StoreMesh();
+            set_laser_mesh_active(dryrun ? mesh_was_active : scanned);
+            return;
+          #endif
+          if (!bed_scan_raster(verbose_level)) {
+            clean_up_after_endstop_move();
+            return;
+          }
+          levelProbe_1 = BedScan__PlaneHeight(ABL_PROBE_PT_1_X, ABL_PROBE_PT_1_Y);
+          levelProbe_2 = BedScan__PlaneHeight(ABL_PROBE_PT_2_X, ABL_PROBE_PT_2_Y);
+          levelProbe_3 = BedScan__PlaneHeight(ABL_PROBE_PT_3_X, ABL_PROBE_PT_3_Y);
+        }
+        else
+      #endif
+      {
+        levelProbe_1 = bed_level_probe_pt(ABL_PROBE_PT_1_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_1_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level);
+        levelProbe_2 = bed_level_probe_pt(ABL_PROBE_PT_2_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_2_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level);
+        levelProbe_3 = bed_level_probe_pt(ABL_PROBE_PT_3_X - X_PROBE_OFFSET_FROM_EXTRUDER, ABL_PROBE_PT_3_Y - Y_PROBE_OFFSET_FROM_EXTRUDER, current_position[Z_AXIS], verbose_level);
+
+        levelProbe_1 = (levelProbe_1 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
+        levelProbe_2 = (levelProbe_2 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
+        levelProbe_3 = (levelProbe_3 - LDIST_OFFSET)/LDIST_UNIT_DIVISOR;
+      }
       if (verbose_level > 2) {
         SERIAL_PROTOCOLPGM("probe 1: ");
         SERIAL_PROTOCOL_F(levelProbe_1, 5);
@@ -4212,6 +4630,26 @@ inline void gcode_M121() { enable_endstops(false); }
 
 #endif // BLINKM
 
+#if ENABLED(TELEMETRY)
+
+  /**
+   * M155: Telemetry - S<seconds> between reports (S0 stops them),
+   *       C<mask> of TELEMETRY_* channels. Reports the settings.
+   */
+  inline void gcode_M155() {
+    uint16_t interval = Telemetry__GetInterval();
+    uint8_t channels = Telemetry__GetChannels();
+    if (code_seen('S')) interval = constrain(code_value() * 1000, 0, 65535);
+    if (code_seen('C')) channels = code_value_short();
+    Telemetry__Configure(interval, channels);
+    SERIAL_PROTOCOLPGM("Telemetry S");
+    SERIAL_PROTOCOL_F(Telemetry__GetInterval() / 1000.0, 3);
+    SERIAL_PROTOCOLPGM(" C");
+    SERIAL_PROTOCOLLN((int)Telemetry__GetChannels());
+  }
+
+#endif // TELEMETRY
+
 /**
  * M200: Set filament diameter and set E axis units to cubic millimeters
  *
@@ -4659,37 +5097,41 @@ inline void gcode_M226() {
 }
 
 #if ENABLED(EXT_ADC)
+  /**
+   * Average of 2^power fresh conversions of EXT_ADC_RAW_0 from the background
+   * sampler. Waits in idle(), so heaters and the command buffer are serviced.
+   */
+  static uint16_t ext_adc_average(uint8_t power) {
+    // Value must be less than max sample power
+    if(power > ADC_SAMPLE_POWER) {
+      power = ADC_SAMPLE_POWER;
+    }
+    uint16_t num_samples = 1U << power;
+
+    // Drop a conversion that was started before this call
+    uint16_t start = ADC_sampler_count();
+    while (ADC_sampler_busy() && ADC_sampler_count() == start && !ADC_sampler_failed()) idle();
+
+    start = ADC_sampler_count();
+    uint32_t sample_sum = ADC_sampler_sum(); // must be 32 bit unsigned int!
+    while ((uint16_t)(ADC_sampler_count() - start) < num_samples) {
+      if (ADC_sampler_failed()) return 0;
+      idle();
+    }
+
+    // Take average of sample readings
+    return (ADC_sampler_sum() - sample_sum) >> power;
+  }
+
   /**
    * M234 - Return raw external ADC value
    */
   inline void gcode_M234() {
     // Check for S parameter
-    if(code_seen('S')) {
-
-      uint8_t power = code_value();
-      uint16_t num_samples = 0x0001 << power;
-      uint16_t i = 0;
-      uint32_t sample_sum = 0; // must be 32 bit unsigned int!
-      uint16_t sample_avg = 0;
-
-      // Value must be less than max sample power
-      if(power > ADC_SAMPLE_POWER) {
-        power = ADC_SAMPLE_POWER;
-      }
-      // Take specified amount of readings
-      for(i = 0; i < num_samples; i++) {
-        sample_sum += EXT_ADC_RAW_0;
-      }
-      // Take average of sample readings
-      sample_avg = sample_sum >> power;
+    uint8_t power = code_seen('S') ? code_value() : 0;
 
-      SERIAL_PROTOCOLPGM("ok ");
-      SERIAL_PROTOCOL(sample_avg);
-    }
-    else {
     SERIAL_PROTOCOLPGM("ok ");
-    SERIAL_PROTOCOL(EXT_ADC_RAW_0);
-    }
+    SERIAL_PROTOCOL(ext_adc_average(power));
     SERIAL_EOL;
   }
 
@@ -4708,6 +5150,19 @@ inline void gcode_M226() {
   }
 #endif
  
+#if ENABLED(E_REGULATOR)
+  /**
+   * Sets the regulator pressure for the next planned move on. The stepper ISR
+   * picks it up when that move starts (or right away if the planner is empty)
+   * and idle() writes it to the DAC.
+   */
+  void set_regulator_setpoint(float psi) {
+    CRITICAL_SECTION_START;
+    regulator_setpoint = psi;
+    CRITICAL_SECTION_END;
+  }
+#endif
+
 #if (ENABLED(E_REGULATOR) && ENABLED(PNEUMATICS))
   /**
    * M236 - Send Value to ADC w/ no EEPROM write
@@ -4734,6 +5189,11 @@ inline void gcode_M226() {
       else if (current_tank_target < current_tank) {
         available_output_pressure = (current_tank_target - PNEUMATIC_HYSTERESIS_PSI);
       }
+      #if ENABLED(PNEUMATIC_PUMP_PWM)
+        // The pump pre-charges the tank before the moves with this setpoint,
+        // as far as it can against the air being drawn
+        if (available_output_pressure) NOLESS(available_output_pressure, (uint16_t)PneumaticPump__GetMaxOutput());
+      #endif
     }
     // Desired pressure value given
     if(code_seen('S')) {
@@ -4748,14 +5208,12 @@ inline void gcode_M226() {
       }
       // Desired pressure is available
       else if(psi <= available_output_pressure) {
-        regulator_setpoint = psi;
-        Regulator__SetOutputPressure(regulator_setpoint);
+        set_regulator_setpoint(psi);
       }
       // Tank pressure is near zero, can set output to near zero
       else if( (psi == 0) && !(house_air) ) {
         if( (current_tank <= REGULATOR_LOW_P) || (current_tank_target <= REGULATOR_LOW_P) ) {
-          regulator_setpoint = psi;
-          Regulator__SetOutputPressure(regulator_setpoint);
+          set_regulator_setpoint(psi);
         }
       }
       // Desired pressure NOT available
@@ -4784,12 +5242,40 @@ inline void gcode_M226() {
       SERIAL_PROTOCOLPGM("Available Tank Pressure: ");
       SERIAL_PROTOCOL(available_output_pressure);
       SERIAL_PROTOCOLLNPGM(" psi");
+      #if ENABLED(PNEUMATIC_PUMP_PWM)
+        // Display what the pump is working towards
+        SERIAL_PROTOCOLPGM("Tank Pressure Demand: ");
+        SERIAL_PROTOCOL(PneumaticPump__GetDemand());
+        SERIAL_PROTOCOLLNPGM(" psi");
+        SERIAL_PROTOCOLPGM("Pump Duty: ");
+        SERIAL_PROTOCOL((int)PneumaticPump__GetDuty());
+        SERIAL_PROTOCOLLNPGM("/255");
+        SERIAL_PROTOCOLPGM("Air Draw: ");
+        SERIAL_PROTOCOL(PneumaticPump__GetDraw());
+        SERIAL_PROTOCOLLNPGM(" psi/s");
+      #endif
       // Display current output pressure set point
       SERIAL_PROTOCOLPGM("Output Pressure Set Point: ");
       SERIAL_PROTOCOLLN(regulator_setpoint);
       // Display current output pressure actual
       SERIAL_PROTOCOLPGM("Actual Output Pressure: ");
       SERIAL_PROTOCOL(actual_output_pressure);
+      #if ENABLED(REGULATOR_CLOSED_LOOP)
+        // Display how the loop handled the last set point change
+        SERIAL_EOL;
+        SERIAL_PROTOCOLPGM("Settling Time: ");
+        long settling_time = Regulator__GetSettlingTime();
+        if (settling_time < 0) {
+          SERIAL_PROTOCOLLNPGM("settling");
+        }
+        else {
+          SERIAL_PROTOCOL(settling_time);
+          SERIAL_PROTOCOLLNPGM(" ms");
+        }
+        SERIAL_PROTOCOLPGM("Steady State Error: ");
+        SERIAL_PROTOCOL(Regulator__GetSteadyStateError());
+        SERIAL_PROTOCOLPGM(" psi");
+      #endif
     }
     // Return current output pressure if no desired pressure given
     else {
@@ -4799,29 +5285,72 @@ inline void gcode_M226() {
   }
 #endif // E_REGULATOR && PNEUMATICS
 
+#if ENABLED(PNEUMATICS)
+  static void print_pressure_stats(const char *name, const PressureStats &stats) {
+    serialprintPGM(name);
+    SERIAL_PROTOCOLPGM(" n:");
+    SERIAL_PROTOCOL(stats.count);
+    if (stats.count) {
+      SERIAL_PROTOCOLPGM(" min:");
+      SERIAL_PROTOCOL(stats.min);
+      SERIAL_PROTOCOLPGM(" max:");
+      SERIAL_PROTOCOL(stats.max);
+      SERIAL_PROTOCOLPGM(" mean:");
+      SERIAL_PROTOCOL(stats.mean);
+      SERIAL_PROTOCOLPGM(" sd:");
+      SERIAL_PROTOCOL_F(PressureSensor__StatsStdDev(&stats), 3);
+    }
+    SERIAL_PROTOCOLLNPGM(" psi");
+  }
+
+  /**
+   * M249 - Pressure sensor statistics: count, min, max, mean and standard
+   *        deviation of the unfiltered readings. R starts over afterwards.
+   */
+  inline void gcode_M249() {
+    print_pressure_stats(PSTR("Tank"), pneumatic_stats);
+    #if ENABLED(E_REGULATOR)
+      print_pressure_stats(PSTR("Regulator"), regulator_stats);
+    #endif
+    if (code_seen('R')) reset_pressure_stats();
+  }
+#endif
+
+#if ENABLED(PRESSURE_ADVANCE)
+  /**
+   * M246 - Pressure advance: L<lead ms> K<gain 0-1>, reports the settings
+   */
+  inline void gcode_M246() {
+    if (code_seen('L')) PressureAdvance__SetLead(max(code_value_short(), 0));
+    if (code_seen('K')) PressureAdvance__SetGain(code_value());
+    SERIAL_PROTOCOLPGM("Pressure advance L");
+    SERIAL_PROTOCOL(PressureAdvance__GetLead());
+    SERIAL_PROTOCOLPGM(" K");
+    SERIAL_PROTOCOLLN(PressureAdvance__GetGain());
+  }
+#endif
+
+#if ENABLED(BATCHED_OK)
+  /**
+   * M256 - Batched ok: S1 acks lines as they are queued, S0 once each command
+   *        completes. Reports the mode and W, the bytes the host may send past
+   *        the last line acked. Wait for this command's ok before streaming.
+   */
+  inline void gcode_M256() {
+    if (code_seen('S')) batched_ok = code_value() > 0;
+    SERIAL_PROTOCOLPGM("Batched ok S");
+    SERIAL_PROTOCOL(batched_ok ? 1 : 0);
+    SERIAL_PROTOCOLPGM(" W");
+    SERIAL_PROTOCOLLN(RX_BUFFER_SIZE - 1);
+  }
+#endif
+
 #if ENABLED(EXT_ADC)
   /*
   * M238 - Return ADC value from laser sensor (get distance)
   */
   uint16_t gcode_M238(uint8_t power) {
-    uint16_t num_samples = 0x0001 << power;
-    uint16_t i = 0;
-    uint32_t sample_sum = 0; // must be 32 bit unsigned int!
-    uint16_t sample_avg = 0;
-
-    // Value must be less than max sample power
-    // (This value was just taken from M234 for simplicity)
-    if(power > ADC_SAMPLE_POWER) {
-      power = ADC_SAMPLE_POWER;
-    }
-    // Take specified amount of readings
-    for(i = 0; i < num_samples; i++) {
-      sample_sum += EXT_ADC_READ_0;
-    }
-    // Take average of sample readings
-    sample_avg = sample_sum >> power;
-
-    return sample_avg;
+    return get_dist_from_raw(ext_adc_average(power));
   }
 #endif
 
@@ -5018,6 +5547,8 @@ inline void gcode_M244() {
 /*
 * M245 - Cartridge Diagnostics Readout
 *   C - 0 - 1   Cartridge Address (0 or 1)
+*   Served from the metadata read when the cartridge was inserted, once
+*   that read has completed.
 */
 inline void gcode_M245() {
   uint8_t i2c_address = 0xFF;
@@ -5049,13 +5580,7 @@ inline void gcode_M245() {
     return;
   }
 
-  I2C__GetSerial(i2c_address);
-  I2C__GetProgrammerStation(i2c_address);
-  I2C__GetPeripheralType(i2c_address);
-  I2C__GetSize(i2c_address);
-  I2C__GetMaterial(i2c_address);
-  I2C__GetFirmwareVersion(i2c_address);
-
+  I2C__PrintDiagnostics(i2c_address);
 }
 
 /**
@@ -5293,15 +5818,25 @@ void gcode_M241(long num_milliseconds) {
 #endif // PREVENT_DANGEROUS_EXTRUDE
 
 /**
- * M303: PID relay autotune
+ * M303: PID autotune
  *       S<temperature> sets the target temperature. (default target temperature = 150C)
  *       E<extruder> (-1 for the bed)
- *       C<cycles>
+ *       C<cycles> of the relay
+ *
+ * With PID_AUTOTUNE_FOPDT one heating step up to S is fitted instead of
+ * relay cycles, unless C is given.
+ *       U1 applies the gains and stores them to EEPROM
  */
 inline void gcode_M303() {
   int e = code_seen('E') ? code_value_short() : 0;
-  int c = code_seen('C') ? code_value_short() : 5;
   float temp = code_seen('S') ? code_value() : (e < 0 ? 70.0 : 150.0);
+  #if ENABLED(PID_AUTOTUNE_FOPDT)
+    if (!code_seen('C')) {
+      PID_autotune_step(temp, e, code_seen('U') && code_value_short() == 1);
+      return;
+    }
+  #endif
+  int c = code_seen('C') ? code_value_short() : 5;
   PID_autotune(temp, e, c);
 }
 
@@ -5410,43 +5945,31 @@ inline void gcode_M303() {
   } // end ensure_solenoid
 
   /*
-   * Enables the specified solenoid if it exists.
+   * Enables the specified solenoid if it exists. The stepper ISR opens it
+   * when the next planned move starts, or right away if the planner is empty.
    * @param   tool  Tool number of the solenoid to enable.
    */
   static void enable_solenoid(uint8_t tool) {
     // Check that solenoid exists (assumed that uC pin count < 128)
-    int8_t solenoid_pin = ensure_solenoid(tool);
-    // If solenoid exists, enable it
-    if (solenoid_pin >= 0) {
-      pinMode(solenoid_pin, OUTPUT);
-      digitalWrite(solenoid_pin, HIGH);
-    }
+    if (ensure_solenoid(tool) >= 0) solenoid_state |= BIT(tool);
   } // end enable_solenoid
 
   /*
-   * Disables the specified solenoid if it exists.
+   * Disables the specified solenoid if it exists, with the next planned move.
    * @param   tool  Tool number of the solenoid to disable.
    */
   static void disable_solenoid(uint8_t tool) {
     // Check that solenoid exists
-    int8_t solenoid_pin = ensure_solenoid(tool);
-    // If solenoid exists, disable it
-    if (solenoid_pin >= 0) {
-      pinMode(solenoid_pin, OUTPUT);
-      digitalWrite(solenoid_pin, LOW);
-    }
+    if (ensure_solenoid(tool) >= 0) solenoid_state &= ~BIT(tool);
   } // end disable solenoid
 
   /*
-   * Disables all solenoids that exist
+   * Disables all solenoids that exist, immediately, and keeps the queued
+   * moves from opening them again. Used on errors; M381 queues the change
+   * with the moves instead.
    */
   void disable_all_solenoids() {
-    #if HAS_SOLENOID_0
-      OUT_WRITE(SOL0_PIN, LOW);
-    #endif
-    #if HAS_SOLENOID_1
-      OUT_WRITE(SOL1_PIN, LOW);
-    #endif
+    st_close_solenoids();
   } // end disabe_all_solenoids
 
   static void report_solenoid_status(uint8_t tool) {
@@ -5501,7 +6024,7 @@ inline void gcode_M303() {
       disable_solenoid(code_value());
     }
     else {
-      disable_all_solenoids();
+      solenoid_state = 0;
     }
     // Verbosity Handling
     if (code_seen('V')) {
@@ -5740,6 +6263,18 @@ inline void gcode_M410() { quickStop(); }
     if (!err) mbl.set_z(mbl.select_x_index(x), mbl.select_y_index(y), z);
   }
 
+#elif ENABLED(LASER_MESH_LEVELING)
+
+  /**
+   * M420: Enable/Disable the laser scan mesh from the last G29 S1
+   */
+  inline void gcode_M420() {
+    if (code_seen('S') && code_has_value()) set_laser_mesh_active(!!code_value_short());
+    SERIAL_PROTOCOLPGM("Laser mesh ");
+    serialprintPGM(BedScan__MeshActive() ? PSTR("on") : PSTR("off"));
+    SERIAL_EOL;
+  }
+
 #endif
 
 /**
@@ -6276,9 +6811,9 @@ inline void gcode_T(uint8_t tmp_extruder) {
       }
 
       #if ENABLED(EXT_SOLENOID)
-        st_synchronize();
-        disable_all_solenoids();
-        enable_solenoid_on_active_extruder();
+        // Hand over to the new tool's solenoid with the next move
+        solenoid_state = 0;
+        enable_solenoid(active_extruder);
       #endif // EXT_SOLENOID
 
     #endif // EXTRUDERS > 1
@@ -6290,26 +6825,30 @@ inline void gcode_T(uint8_t tmp_extruder) {
 
 /**
  * Process a single command and dispatch it to its handler
- * This is called from the main loop()
+ * @param command  Text, or the payload of a binary move frame, with its
+ *                 flags in current_command_flags
  */
-void process_next_command() {
-  current_command = command_queue[cmd_queue_index_r];
+static void process_command(char *command) {
+  #if ENABLED(BINARY_PROTOCOL)
+    if ((current_command_flags & CMD_FRAME_MASK) == BINARY_FRAME_MOVE) {
+      current_command = command;
+      gcode_binary_move();
+      ok_to_send();
+      return;
+    }
+  #endif
+
+  command_params_t &params = *current_params;
+  parse_command_params(command, params);
 
   if ((marlin_debug_flags & DEBUG_ECHO)) {
     SERIAL_ECHO_START;
-    SERIAL_ECHOLN(current_command);
+    SERIAL_ECHOLN(command);
   }
 
-  // Sanitize the current command:
-  //  - Skip leading spaces
-  //  - Bypass N[0-9][0-9]*[ ]*
-  //  - Overwrite * with nul to mark the end
-  while (*current_command == ' ') ++current_command;
-  if (*current_command == 'N' && ((current_command[1] >= '0' && current_command[1] <= '9') || current_command[1] == '-')) {
-    current_command += 2; // skip N[-0-9]
-    while (*current_command >= '0' && *current_command <= '9') ++current_command; // skip [0-9]*
-    while (*current_command == ' ') ++current_command; // skip [ ]*
-  }
+  // The line number was skipped by parse_command_params().
+  // Overwrite * with nul to mark the end.
+  current_command = command + params.command;
   char *starpos = strchr(current_command, '*');  // * should always be the last parameter
   if (starpos) while (*starpos == ' ' || *starpos == '*') *starpos-- = '\0'; // nullify '*' and ' '
 
@@ -6324,16 +6863,20 @@ void process_next_command() {
   // Bail early if there's no code
   if (!code_is_good) goto ExitUnknownCommand;
 
-  // Args pointer optimizes code_seen, especially those taking XYZEF
-  // This wastes a little cpu on commands that expect no arguments.
-  current_command_args = current_command;
-  while (*current_command_args && *current_command_args != ' ') ++current_command_args;
-  while (*current_command_args == ' ') ++current_command_args;
+  current_command_args = command + params.args;
 
   // Interpret the code int
+  seen_value_parsed = false;
   seen_pointer = current_command;
   codenum = code_value_short();
 
+  #if ENABLED(SEGMENT_MERGE)
+    // Other commands expect every move before them in the planner. Priority
+    // commands only report or stop, so they leave a held move alone.
+    if (current_params == &command_params && !(command_code == 'G' && codenum <= 1))
+      SegmentMerge__Flush();
+  #endif
+
   // Handle a known G, M, or T
   switch(command_code) {
     case 'G': switch (codenum) {
@@ -6610,6 +7153,12 @@ void process_next_command() {
 
       #endif //BLINKM
 
+      #if ENABLED(TELEMETRY)
+        case 155: // M155 - Telemetry interval and channels
+          gcode_M155();
+          break;
+      #endif
+
       case 200: // M200 D<millimeters> set filament diameter and set E axis units to cubic millimeters (use S0 to set back to millimeters).
         gcode_M200();
         break;
@@ -6701,6 +7250,18 @@ void process_next_command() {
           break;
       #endif // E_REGULATOR
 
+      #if ENABLED(PRESSURE_ADVANCE)
+        case 246: // M246 - Pressure advance lead time and gain
+          gcode_M246();
+          break;
+      #endif
+
+      #if ENABLED(PNEUMATICS)
+        case 249: // M249 - Pressure sensor statistics
+          gcode_M249();
+          break;
+      #endif
+
       #if ENABLED(EXT_ADC)
         case 238: // M238 - Return ADC value from laser sensor (get distance)
           gcode_M238();
@@ -6747,6 +7308,22 @@ void process_next_command() {
       case 253: // I2C Query Voltage Sense:
         gcode_M253();
         break;
+
+      #if ENABLED(BINARY_PROTOCOL)
+        case 254: // M254 - Select serial protocol
+          gcode_M254();
+          break;
+      #endif
+
+      case 255: // M255 - Serial port statistics
+        gcode_M255();
+        break;
+
+      #if ENABLED(BATCHED_OK)
+        case 256: // M256 - Batched ok with queue credits
+          gcode_M256();
+          break;
+      #endif
         
       case 272:
         gcode_M272();
@@ -6895,6 +7472,10 @@ void process_next_command() {
         case 421: // M421 Set a Mesh Bed Leveling Z coordinate
           gcode_M421();
           break;
+      #elif ENABLED(LASER_MESH_LEVELING)
+        case 420: // M420 Enable/Disable the laser scan mesh
+          gcode_M420();
+          break;
       #endif
 
       case 428: // M428 Apply current_position to home_offset
@@ -6989,24 +7570,93 @@ ExitUnknownCommand:
   ok_to_send();
 }
 
+/**
+ * Process the command at the front of the queue
+ * This is called from the main loop()
+ */
+void process_next_command() {
+  current_params = &command_params;
+  process_command(CommandRing__Front(&command_queue, &current_command_flags));
+}
+
+#if ENABLED(PRIORITY_COMMANDS)
+
+  /**
+   * Runs the commands of the priority lane. Called from loop() and idle(),
+   * so they also run while a queued command waits, e.g. for room in the
+   * planner; the parser state of that command is put back afterwards.
+   * @param between_commands  false when called from idle(). The lane then
+   *                          stops at an M410, which would flush the planner
+   *                          under a command that is still queueing moves.
+   */
+  void process_priority_commands(bool between_commands) {
+    static bool running = false;
+    if (running || !CommandRing__Count(&priority_lane)) return;
+    running = true;
+
+    char *command = current_command, *args = current_command_args, *pointer = seen_pointer;
+    uint8_t flags = current_command_flags;
+    command_params_t *params = current_params;
+    float value = seen_value;
+    bool value_parsed = seen_value_parsed;
+    uint8_t extruder = target_extruder;
+
+    current_params = &priority_params;
+    char *priority;
+    while ((priority = CommandRing__Front(&priority_lane, &current_command_flags))) {
+      if (!between_commands && command_m_code(priority, NULL) == 410) break;
+      process_command(priority);
+      CommandRing__Pop(&priority_lane);
+    }
+
+    current_command = command;
+    current_command_args = args;
+    seen_pointer = pointer;
+    current_command_flags = flags;
+    current_params = params;
+    seen_value = value;
+    seen_value_parsed = value_parsed;
+    target_extruder = extruder;
+    running = false;
+  }
+
+#endif // PRIORITY_COMMANDS
+
 void FlushSerialRequestResend() {
   //char command_queue[cmd_queue_index_r][100]="Resend:";
   MYSERIAL.flush();
   SERIAL_PROTOCOLPGM(MSG_RESEND);
   SERIAL_PROTOCOLLN(gcode_LastN + 1);
+  #if ENABLED(BATCHED_OK)
+    // The next ok tells the host where it stands again
+    if (batched_ok) {
+      batched_ok_pending = true;
+      return;
+    }
+  #endif
   ok_to_send();
 }
 
 void ok_to_send() {
   refresh_cmd_timeout();
   #if ENABLED(SDSUPPORT)
-    if (fromsd[cmd_queue_index_r]) return;
+    if (current_command_flags & CMD_FROM_SD) return;
+  #endif
+  #if ENABLED(BATCHED_OK)
+    if (current_command_flags & CMD_ACKED) return; // By send_batched_ok() as it was queued
+  #endif
+  #if ENABLED(BINARY_PROTOCOL)
+    // Framed commands are acked in batches. M254 S0 gets a plain "ok" once the port is back to text.
+    if ((current_command_flags & CMD_FRAME_MASK) != BINARY_FRAME_NONE && BinaryProtocol__Enabled()) {
+      BinaryProtocol__CommandDone();
+      return;
+    }
   #endif
   SERIAL_PROTOCOLPGM(MSG_OK);
   #if ENABLED(ADVANCED_OK)
     SERIAL_PROTOCOLPGM(" N"); SERIAL_PROTOCOL(gcode_LastN);
     SERIAL_PROTOCOLPGM(" P"); SERIAL_PROTOCOL(int(BLOCK_BUFFER_SIZE - movesplanned() - 1));
-    SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL(BUFSIZE - commands_in_queue);
+    SERIAL_PROTOCOLPGM(" B"); SERIAL_PROTOCOL((int)CommandRing__Room(&command_queue));
   #endif
   SERIAL_EOL;
 }
@@ -7194,6 +7844,44 @@ void mesh_plan_buffer_line(float x, float y, float z, const float e, float feed_
 }
 #endif  // MESH_BED_LEVELING
 
+#if ENABLED(LASER_MESH_LEVELING)
+
+/**
+ * Split a move from current_position where it crosses grid lines of the laser
+ * mesh, so the planner only interpolates the bed height within one cell per
+ * segment. Crossings are visited in order along the move by taking whichever
+ * of the next X and Y grid lines comes first, so any grid size works.
+ */
+void laser_mesh_buffer_line(const float target[NUM_AXIS], float feed_rate, const uint8_t extruder) {
+  uint8_t cx = BedScan__CellX(current_position[X_AXIS]),
+          cy = BedScan__CellY(current_position[Y_AXIS]);
+  const uint8_t tx = BedScan__CellX(target[X_AXIS]),
+                ty = BedScan__CellY(target[Y_AXIS]);
+  float delta[NUM_AXIS];
+  for (uint8_t i = 0; i < NUM_AXIS; i++) delta[i] = target[i] - current_position[i];
+
+  while (cx != tx || cy != ty) {
+    // Fraction of the move at the next grid line in X and in Y (2 = none)
+    float t_x = 2, t_y = 2;
+    if (cx != tx) t_x = (BedScan__GridX(tx > cx ? cx + 1 : cx) - current_position[X_AXIS]) / delta[X_AXIS];
+    if (cy != ty) t_y = (BedScan__GridY(ty > cy ? cy + 1 : cy) - current_position[Y_AXIS]) / delta[Y_AXIS];
+
+    float t = min(t_x, t_y);
+    if (t_x == t) cx += tx > cx ? 1 : -1;
+    if (t_y == t) cy += ty > cy ? 1 : -1;
+
+    if (t > 0 && t < 1)
+      plan_buffer_line(current_position[X_AXIS] + delta[X_AXIS] * t,
+                       current_position[Y_AXIS] + delta[Y_AXIS] * t,
+                       current_position[Z_AXIS] + delta[Z_AXIS] * t,
+                       current_position[E_AXIS] + delta[E_AXIS] * t,
+                       feed_rate, extruder);
+  }
+  plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], feed_rate, extruder);
+}
+
+#endif // LASER_MESH_LEVELING
+
 #if ENABLED(PREVENT_DANGEROUS_EXTRUDE)
 
   inline void prevent_dangerous_extrude(float &curr_e, float &dest_e) {
@@ -7268,6 +7956,9 @@ void mesh_plan_buffer_line(float x, float y, float z, const float e, float feed_
 
   inline bool prepare_move_dual_x_carriage() {
     if (active_extruder_parked) {
+      #if ENABLED(SEGMENT_MERGE)
+        SegmentMerge__Flush();
+      #endif
       if (dual_x_carriage_mode == DXC_DUPLICATION_MODE && active_extruder == 0) {
         // move duplicate extruder into correct duplication position.
         plan_set_position(inactive_extruder_x_pos, current_position[Y_AXIS], current_position[Z_AXIS], current_position[E_AXIS]);
@@ -7305,17 +7996,44 @@ void mesh_plan_buffer_line(float x, float y, float z, const float e, float feed_
 
 #if DISABLED(DELTA) && DISABLED(SCARA)
 
+  /**
+   * Plan an XY move to the destination, merged with its neighbours if
+   * SEGMENT_MERGE allows
+   */
+  inline void xy_line_to_destination(float mm_m) {
+    #if ENABLED(SEGMENT_MERGE)
+      SegmentMerge__Line(current_position, destination, mm_m / 60, active_extruder);
+    #else
+      line_to_destination(mm_m);
+    #endif
+  }
+
   inline bool prepare_move_cartesian() {
     // Do not use feedrate_multiplier for E or Z only moves
     if (current_position[X_AXIS] == destination[X_AXIS] && current_position[Y_AXIS] == destination[Y_AXIS]) {
+      #if ENABLED(SEGMENT_MERGE)
+        SegmentMerge__Flush();
+      #endif
       line_to_destination();
     }
     else {
       #if ENABLED(MESH_BED_LEVELING)
+        #if ENABLED(SEGMENT_MERGE)
+          SegmentMerge__Flush();
+        #endif
         mesh_plan_buffer_line(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS], (feedrate/60)*(feedrate_multiplier/100.0), active_extruder);
         return false;
+      #elif ENABLED(LASER_MESH_LEVELING)
+        if (BedScan__MeshActive()) {
+          #if ENABLED(SEGMENT_MERGE)
+            SegmentMerge__Flush();
+          #endif
+          laser_mesh_buffer_line(destination, (feedrate/60)*(feedrate_multiplier/100.0), active_extruder);
+        }
+        else
+          xy_line_to_destination(feedrate * feedrate_multiplier / 100.0);
       #else
-        line_to_destination(feedrate * feedrate_multiplier / 100.0);
+        xy_line_to_destination(feedrate * feedrate_multiplier / 100.0);
       #endif
     }
     return true;
@@ -7661,6 +8379,30 @@ void idle() {
   manage_heater();
   manage_inactivity();
   lcd_update();
+  TwiQueue__Update();
+  I2C__UpdateCartridgeInfo();
+  #if ENABLED(EXT_ADC)
+    ADC_sampler_update();
+  #endif
+  #if ENABLED(LASER_BED_SCAN)
+    BedScan__Update();
+  #endif
+  #if ENABLED(E_REGULATOR)
+    float psi;
+    if (st_regulator_setpoint_changed(psi)) Regulator__SetOutputPressure(psi);
+  #endif
+  #if ENABLED(PRESSURE_ADVANCE)
+    PressureAdvance__Update();
+  #endif
+  #if ENABLED(TELEMETRY)
+    Telemetry__Update();
+  #endif
+  #if ENABLED(SEGMENT_MERGE)
+    SegmentMerge__Update();
+  #endif
+  #if ENABLED(PRIORITY_COMMANDS)
+    process_priority_commands(false);
+  #endif
 }
 
 /**
@@ -7682,7 +8424,7 @@ void manage_inactivity(bool ignore_stepper_queue/*=false*/) {
       filrunout();
   #endif
 
-  if (commands_in_queue < BUFSIZE - 1) get_command();
+  get_command();
 
   millis_t ms = millis();
 
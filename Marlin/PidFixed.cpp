@@ -0,0 +1,67 @@
+/**
+ * PidFixed.cpp - Q16.16 fixed-point PID for the hot ends and the bed.
+ * See PidFixed.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "PidFixed.h"
+
+#if ENABLED(PID_FIXED_POINT)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void PidFixed__SetGains(PidFixed *pid, float kp, float ki, float kd, float k1, float i_max, float out_max) {
+  pid->kp = PID_FIXED(kp);
+  pid->ki = PID_FIXED(ki);
+  pid->kd = PID_FIXED(kd * (1.0 - k1));
+  pid->k1 = PID_FIXED(k1);
+  pid->i_max = PID_FIXED(i_max);
+  pid->out_max = PID_FIXED(out_max);
+}
+
+void PidFixed__ResetIntegral(PidFixed *pid) {
+  pid->i_term = 0;
+}
+
+void PidFixed__Track(PidFixed *pid, pid_fixed_t input) {
+  // A sensor glitch must not overflow the product
+  pid_fixed_t delta = input - pid->last_input;
+  delta = constrain(delta, -64 * PID_FIXED_ONE, 64 * PID_FIXED_ONE);
+  pid->d_term = PidFixed__Multiply(pid->kd, delta) + PidFixed__Multiply(pid->k1, pid->d_term);
+  pid->last_input = input;
+}
+
+pid_fixed_t PidFixed__Output(PidFixed *pid, pid_fixed_t error, pid_fixed_t feedforward) {
+  pid_fixed_t i_step = PidFixed__Multiply(pid->ki, error);
+  pid->p_term = PidFixed__Multiply(pid->kp, error);
+  pid->i_term = constrain(pid->i_term + i_step, 0, pid->i_max);
+
+  pid_fixed_t output = pid->p_term + pid->i_term - pid->d_term + feedforward;
+  if (output > pid->out_max) {
+    if (error > 0) pid->i_term -= i_step; // conditional un-integration
+    output = pid->out_max;
+  }
+  else if (output < 0) {
+    if (error < 0) pid->i_term -= i_step; // conditional un-integration
+    output = 0;
+  }
+  return output;
+}
+
+/**
+ * Four 16x16 products instead of one 32x32 into 64 bits, which avr-gcc
+ * does in software. With a = ah * 2^16 + al (al unsigned, ah signed):
+ * a * b / 2^16 = ah * bh * 2^16 + ah * bl + al * bh + al * bl / 2^16
+ */
+pid_fixed_t PidFixed__Multiply(pid_fixed_t a, pid_fixed_t b) {
+  int16_t ah = a >> 16, bh = b >> 16;
+  uint16_t al = a & 0xFFFF, bl = b & 0xFFFF;
+  int32_t hi = (int32_t)ah * bh;
+  int32_t mid = (int32_t)ah * bl + (int32_t)bh * al;
+  uint32_t lo = (uint32_t)al * bl;
+  return (int32_t)((uint32_t)hi << 16) + mid + (int32_t)(lo >> 16);
+}
+
+#endif // PID_FIXED_POINT
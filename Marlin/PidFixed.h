@@ -0,0 +1,80 @@
+/**
+ * PidFixed.h - Q16.16 fixed-point PID for the hot ends and the bed.
+ * Copyright (C) 2016 Voxel8
+ *
+ * The same controller as the float one in temperature.cpp: a proportional
+ * term, an integral clamped to the drive limit and un-integrated while the
+ * output saturates, and a derivative on the input smoothed with K1. The
+ * integral is kept as its contribution to the output rather than as a sum of
+ * errors, so it stays in range whatever Ki is, and the products are 16x16
+ * multiplies, which the AVR does in hardware, instead of soft-float ones.
+ */
+
+#ifndef MARLIN_PID_FIXED_H_
+#define MARLIN_PID_FIXED_H_
+
+#include "Marlin.h"
+
+#if ENABLED(PID_FIXED_POINT)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// 16 integer bits and 16 fractional ones, so -32768 to 32767.99998
+typedef int32_t pid_fixed_t;
+
+#define PID_FIXED_ONE           65536L
+#define PID_FIXED(f)            ((pid_fixed_t)((f) * (float)PID_FIXED_ONE + ((f) < 0 ? -0.5 : 0.5)))
+#define PID_FIXED_TO_FLOAT(q)   ((q) / (float)PID_FIXED_ONE)
+
+typedef struct {
+  pid_fixed_t kp;
+  pid_fixed_t ki;          // Per sample, as Ki is kept scaled by PID_dT
+  pid_fixed_t kd;          // Per sample and times (1 - K1)
+  pid_fixed_t k1;
+  pid_fixed_t i_max;       // Limit of the integral term, in output units
+  pid_fixed_t out_max;
+  pid_fixed_t p_term;
+  pid_fixed_t i_term;
+  pid_fixed_t d_term;
+  pid_fixed_t last_input;
+} PidFixed;
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Loads gains in the units temperature.cpp keeps them in. The terms are
+ * kept, as they are when M301 changes the float gains.
+ * @param ki       Scaled by PID_dT, see scalePID_i()
+ * @param kd       Scaled by PID_dT, see scalePID_d()
+ * @param i_max    Limit of the integral term, e.g. PID_INTEGRAL_DRIVE_MAX
+ * @param out_max  Limit of the output, e.g. PID_MAX
+ */
+void PidFixed__SetGains(PidFixed *pid, float kp, float ki, float kd, float k1, float i_max, float out_max);
+
+// Clears the integral term, for re-entering PID_FUNCTIONAL_RANGE
+void PidFixed__ResetIntegral(PidFixed *pid);
+
+/**
+ * Smooths the derivative with the new input. Runs every sample, also
+ * outside PID_FUNCTIONAL_RANGE, so it is current when the PID takes over.
+ */
+void PidFixed__Track(PidFixed *pid, pid_fixed_t input);
+
+/**
+ * @param error        Target minus input
+ * @param feedforward  Added to the output before it is limited, e.g. the
+ *                     PID_ADD_EXTRUSION_RATE term
+ * @returns            The output, from 0 to out_max
+ */
+pid_fixed_t PidFixed__Output(PidFixed *pid, pid_fixed_t error, pid_fixed_t feedforward);
+
+// a * b, rounded down
+pid_fixed_t PidFixed__Multiply(pid_fixed_t a, pid_fixed_t b);
+
+#endif // PID_FIXED_POINT
+
+#endif  // MARLIN_PID_FIXED_H_
@@ -0,0 +1,114 @@
+/**
+ * PneumaticPump.cpp - Proportional pump control from a model of the tank.
+ * See PneumaticPump.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "PneumaticPump.h"
+
+#if ENABLED(PNEUMATIC_PUMP_PWM)
+
+#include "planner.h"
+#include "temperature.h"
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define ATMOSPHERE_PSI 14.7
+
+// Weight of a new draw sample; the derivative of a 0.1 psi reading is noisy
+#define PUMP_DRAW_FILTER 0.05
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static uint8_t duty = 0;
+static float draw = 0;          // psi/s
+static float demand = 0;        // psi
+static float lastTank = -1;     // psi, -1 before the first update
+static millis_t lastUpdate = 0;
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static float _fill_rate(float tank);
+static void _set_duty(uint8_t value);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void PneumaticPump__Update(float tank) {
+  millis_t ms = millis();
+  if (lastTank >= 0 && ms - lastUpdate < PUMP_UPDATE_INTERVAL) return;
+  float dt = (ms - lastUpdate) * 0.001;
+  lastUpdate = ms;
+
+  // Whatever the pump did not account for went out of the tank. A long gap
+  // (pump stopped by an error) says nothing about the duty in between.
+  if (lastTank >= 0 && dt < PUMP_UPDATE_INTERVAL * 0.004) {
+    float sample = duty / 255.0 * _fill_rate(lastTank) - (tank - lastTank) / dt;
+    draw += (sample - draw) * PUMP_DRAW_FILTER;
+    NOLESS(draw, 0);
+  }
+  lastTank = tank;
+
+  // M125 S0 turns the pump off; otherwise pre-charge for the planned moves
+  demand = targetPneumatic();
+  #if ENABLED(E_REGULATOR)
+    if (demand > 0)
+      NOLESS(demand, plan_max_regulator_setpoint() + PNEUMATIC_HYSTERESIS_PSI + PUMP_PRECHARGE_MARGIN);
+  #endif
+  NOMORE(demand, PUMP_MAX_TANK_PSI);
+
+  // Duty that brings the predicted pressure to the demand within the horizon
+  float u = 0;
+  float fill = _fill_rate(tank);
+  if (demand > 0 && fill > 0 &&
+      tank > PNEUMATIC_MIN / 10.0 && tank < PNEUMATIC_MAX / 10.0)
+    u = ((demand - tank) / (PUMP_HORIZON * 0.001) + draw) / fill;
+
+  // Below PUMP_MIN_DUTY the motor stalls, so round to off or to the minimum
+  float pwm = u * 255;
+  if (pwm < PUMP_MIN_DUTY / 2)
+    _set_duty(0);
+  else
+    _set_duty(constrain(pwm, PUMP_MIN_DUTY, 255));
+}
+
+void PneumaticPump__Off(void) { _set_duty(0); }
+
+uint8_t PneumaticPump__GetDuty(void) { return duty; }
+float PneumaticPump__GetDraw(void) { return draw; }
+float PneumaticPump__GetDemand(void) { return demand; }
+
+/**
+ * At full duty the tank settles where the fill rate falls to the draw.
+ */
+float PneumaticPump__GetMaxOutput(void) {
+  float tank = PUMP_STALL_PSI * (1 - draw / _fill_rate(0));
+  NOMORE(tank, PUMP_MAX_TANK_PSI);
+  return max(tank - PNEUMATIC_HYSTERESIS_PSI - PUMP_PRECHARGE_MARGIN, 0);
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * @returns  psi/s the pump adds at full duty against the tank pressure
+ */
+static float _fill_rate(float tank) {
+  float rate = PUMP_FLOW * ATMOSPHERE_PSI / PNEUMATIC_TANK_VOLUME * (1 - tank / PUMP_STALL_PSI);
+  return max(rate, 0);
+}
+
+static void _set_duty(uint8_t value) {
+  duty = value;
+  analogWrite(PNEUMATIC_PUMP_PIN, value);
+}
+
+#endif // PNEUMATIC_PUMP_PWM
@@ -0,0 +1,73 @@
+/**
+ * PneumaticPump.h - Proportional pump control from a model of the tank.
+ * Copyright (C) 2016 Voxel8
+ *
+ * The tank is filled by a pump whose flow falls off linearly towards
+ * PUMP_STALL_PSI, and emptied by the regulator, the solenoids and leaks:
+ *   dP/dt = duty * fill(P) - draw
+ *   fill(P) = PUMP_FLOW * 14.7 / PNEUMATIC_TANK_VOLUME * (1 - P / PUMP_STALL_PSI)
+ * The draw is estimated from how far the tank strays from what the model
+ * predicted. Every PUMP_UPDATE_INTERVAL ms the duty is set so the predicted
+ * pressure reaches the demand within PUMP_HORIZON ms. The demand is the M125
+ * target, raised to cover the highest regulator setpoint in the planner
+ * before those moves start.
+ */
+
+#ifndef MARLIN_PNEUMATIC_PUMP_H_
+#define MARLIN_PNEUMATIC_PUMP_H_
+
+#include "Marlin.h"
+
+#if ENABLED(PNEUMATIC_PUMP_PWM)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// Highest tank pressure the pump is asked for; it still has a quarter of its
+// flow left there
+#define PUMP_MAX_TANK_PSI (PUMP_STALL_PSI * 3 / 4)
+
+// Highest regulator setpoint the pump can pre-charge the tank for
+#define PUMP_MAX_OUTPUT_PSI (PUMP_MAX_TANK_PSI - PNEUMATIC_HYSTERESIS_PSI - PUMP_PRECHARGE_MARGIN)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Updates the draw estimate and the pump duty. Called from manage_heater()
+ * on each new reading; runs every PUMP_UPDATE_INTERVAL ms.
+ * @param tank  Tank pressure in psi
+ */
+void PneumaticPump__Update(float tank);
+
+/**
+ * Stops the pump until the next update. Safe to call from an ISR.
+ */
+void PneumaticPump__Off(void);
+
+/**
+ * @returns  PWM duty of the pump (0-255)
+ */
+uint8_t PneumaticPump__GetDuty(void);
+
+/**
+ * @returns  Estimated air draw from the tank in psi/s
+ */
+float PneumaticPump__GetDraw(void);
+
+/**
+ * @returns  Tank pressure (in psi) the pump is working towards
+ */
+float PneumaticPump__GetDemand(void);
+
+/**
+ * @returns  Highest regulator setpoint (in psi) the pump can pre-charge the
+ *           tank for against the estimated draw, at most PUMP_MAX_OUTPUT_PSI
+ */
+float PneumaticPump__GetMaxOutput(void);
+
+#endif // PNEUMATIC_PUMP_PWM
+
+#endif  // MARLIN_PNEUMATIC_PUMP_H_
@@ -0,0 +1,52 @@
+/**
+ * PressureAdvance.cpp - Regulator pressure led by the planned head speed.
+ * See PressureAdvance.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "PressureAdvance.h"
+
+#if ENABLED(PRESSURE_ADVANCE)
+
+#include "stepper.h"
+#include "Regulator.h"
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static uint16_t leadTime = PRESSURE_ADVANCE_LEAD;  // ms
+static float gain = PRESSURE_ADVANCE_GAIN;
+static millis_t nextUpdate = 0;
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Scales the M236 setpoint by the speed ratio lead ms ahead. Outside of
+ * dispensing moves and with the head standing still the setpoint is used
+ * as is, so the ink stays primed.
+ */
+void PressureAdvance__Update(void) {
+  millis_t ms = millis();
+  if ((long)(ms - nextUpdate) < 0) return;
+  nextUpdate = ms + PRESSURE_ADVANCE_INTERVAL;
+
+  float ratio = 1;
+  block_t *block;
+  float rate = st_rate_ahead(leadTime * 0.001, block);
+  if (block && block->solenoids && block->nominal_rate)
+    ratio = rate / block->nominal_rate;
+
+  // With gain 0 this writes the plain setpoint back once, then nothing
+  Regulator__AdvanceOutputPressure(Regulator__GetTargetPressure() * (1 - gain + gain * ratio));
+}
+
+void PressureAdvance__SetLead(uint16_t lead) { leadTime = lead; }
+uint16_t PressureAdvance__GetLead(void) { return leadTime; }
+
+void PressureAdvance__SetGain(float value) { gain = constrain(value, 0, 1); }
+float PressureAdvance__GetGain(void) { return gain; }
+
+#endif // PRESSURE_ADVANCE
@@ -0,0 +1,45 @@
+/**
+ * PressureAdvance.h - Regulator pressure led by the planned head speed.
+ * Copyright (C) 2016 Voxel8
+ *
+ * Viscous inks take tens of milliseconds to follow a pressure change, so a
+ * fixed M236 pressure over-deposits in corners and under-deposits while
+ * accelerating. While a solenoid is open, the regulator is driven with
+ *   setpoint * (1 - gain + gain * v(t + lead) / v_nominal)
+ * where v(t + lead) is the speed the head will have lead ms from now on the
+ * planned trapezoids and v_nominal the nominal speed of that move. Running
+ * out of planned moves counts as stopping.
+ */
+
+#ifndef MARLIN_PRESSURE_ADVANCE_H_
+#define MARLIN_PRESSURE_ADVANCE_H_
+
+#include "Marlin.h"
+
+#if ENABLED(PRESSURE_ADVANCE)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Writes the led pressure to the regulator every PRESSURE_ADVANCE_INTERVAL
+ * ms if it changed. Called from idle().
+ */
+void PressureAdvance__Update(void);
+
+/**
+ * @param lead  Look-ahead time in ms
+ */
+void PressureAdvance__SetLead(uint16_t lead);
+uint16_t PressureAdvance__GetLead(void);
+
+/**
+ * @param gain  0 (fixed pressure) to 1 (pressure proportional to speed)
+ */
+void PressureAdvance__SetGain(float gain);
+float PressureAdvance__GetGain(void);
+
+#endif // PRESSURE_ADVANCE
+
+#endif  // MARLIN_PRESSURE_ADVANCE_H_
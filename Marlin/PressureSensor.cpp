@@ -0,0 +1,96 @@
+/**
+ * PressureSensor.cpp - Conversion, filtering and statistics of the tank and
+ * regulator pressure readings. See PressureSensor.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "PressureSensor.h"
+
+#if ENABLED(PNEUMATICS)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void PressureSensor__BuildSegments(const short (*table)[2], uint8_t length, PressureSegment *segments) {
+  for (uint8_t i = 0; i < length; i++) {
+    short x0 = pgm_read_word(&table[i][0]),
+          y0 = pgm_read_word(&table[i][1]);
+    PressureSegment &s = segments[i];
+    s.raw = x0;
+    s.slope = 0;
+    if (i + 1 < length) {
+      short x1 = pgm_read_word(&table[i + 1][0]),
+            y1 = pgm_read_word(&table[i + 1][1]);
+      if (x1 != x0) s.slope = (float)(y1 - y0) / (x1 - x0);
+    }
+    s.offset = y0 - s.slope * x0;
+  }
+}
+
+/**
+ * Finds the last segment starting at or below raw. The first one also
+ * covers anything below it.
+ */
+float PressureSensor__Convert(const PressureSegment *segments, uint8_t length, int raw) {
+  uint8_t lo = 0, hi = length;
+  while (hi - lo > 1) {
+    uint8_t mid = (lo + hi) >> 1;
+    if (segments[mid].raw <= raw) lo = mid; else hi = mid;
+  }
+  return segments[lo].offset + segments[lo].slope * raw;
+}
+
+int PressureSensor__Filter(PressureFilter *filter, uint8_t type, int raw) {
+  // The filters start from the first sum instead of ramping up from 0
+  bool first = filter->count == 0;
+  if (filter->count < PRESSURE_MEDIAN_LEN) filter->count++;
+
+  switch (type) {
+    case PRESSURE_FILTER_IIR:
+      if (first) filter->iir = (long)raw << PRESSURE_IIR_SHIFT;
+      filter->iir += raw - (filter->iir >> PRESSURE_IIR_SHIFT);
+      return filter->iir >> PRESSURE_IIR_SHIFT;
+
+    case PRESSURE_FILTER_MEDIAN: {
+      filter->history[filter->index] = raw;
+      if (++filter->index >= PRESSURE_MEDIAN_LEN) filter->index = 0;
+      // Insertion sort of a copy; the history is only a few entries
+      int sorted[PRESSURE_MEDIAN_LEN];
+      uint8_t n = filter->count;
+      for (uint8_t i = 0; i < n; i++) {
+        int v = filter->history[i];
+        uint8_t j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = v;
+      }
+      return sorted[n >> 1];
+    }
+
+    default:
+      return raw;
+  }
+}
+
+void PressureSensor__StatsReset(PressureStats *stats) {
+  stats->count = 0;
+  stats->mean = stats->m2 = 0;
+}
+
+void PressureSensor__StatsAdd(PressureStats *stats, float value) {
+  if (stats->count == 0) stats->min = stats->max = value;
+  NOMORE(stats->min, value);
+  NOLESS(stats->max, value);
+  // Saturated, the mean and spread stay those of the first 65535 readings
+  if (stats->count == 0xFFFF) return;
+  stats->count++;
+  float delta = value - stats->mean;
+  stats->mean += delta / stats->count;
+  stats->m2 += delta * (value - stats->mean);
+}
+
+float PressureSensor__StatsStdDev(const PressureStats *stats) {
+  return stats->count > 1 ? sqrt(stats->m2 / (stats->count - 1)) : 0;
+}
+
+#endif // PNEUMATICS
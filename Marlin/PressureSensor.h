@@ -0,0 +1,83 @@
+/**
+ * PressureSensor.h - Conversion, filtering and statistics of the tank and
+ * regulator pressure readings.
+ * Copyright (C) 2016 Voxel8
+ *
+ * The PROGMEM lookup tables in thermistortables.h are turned into segments
+ * with a precomputed slope and offset once at start-up, so a conversion is a
+ * binary search and a multiply-add. The temperature ISR filters each
+ * OVERSAMPLENR sum before handing it over, and the statistics of the
+ * unfiltered readings show how much the sensors jitter.
+ */
+
+#ifndef MARLIN_PRESSURE_SENSOR_H_
+#define MARLIN_PRESSURE_SENSOR_H_
+
+#include "Marlin.h"
+
+#if ENABLED(PNEUMATICS)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// Filter types for PNEUMATIC_FILTER and REGULATOR_FILTER
+#define PRESSURE_FILTER_NONE    0
+#define PRESSURE_FILTER_IIR     1  // new = old + (raw - old) / 2^PRESSURE_IIR_SHIFT
+#define PRESSURE_FILTER_MEDIAN  2  // Median of the last PRESSURE_MEDIAN_LEN sums
+
+// A table entry and the line to the next one, in the units of the table
+typedef struct {
+  short raw;     // First raw value the segment applies to
+  float slope;   // Per raw count
+  float offset;  // Value at raw 0
+} PressureSegment;
+
+typedef struct {
+  long iir;                          // Filtered value << PRESSURE_IIR_SHIFT
+  int history[PRESSURE_MEDIAN_LEN];  // Ring of the last sums
+  uint8_t index;
+  uint8_t count;                     // Sums seen, up to PRESSURE_MEDIAN_LEN
+} PressureFilter;
+
+// Running statistics, updated with Welford's method
+typedef struct {
+  uint16_t count;
+  float min;
+  float max;
+  float mean;
+  float m2;      // Sum of squared differences from the mean
+} PressureStats;
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Precomputes one segment per table entry. Below the first entry the first
+ * segment is extended; from the last entry on the value is held.
+ * @param table     PROGMEM table of { raw, value } pairs, raw ascending
+ * @param segments  length segments to fill
+ */
+void PressureSensor__BuildSegments(const short (*table)[2], uint8_t length, PressureSegment *segments);
+
+/**
+ * @returns  The value of raw on the segmented table, as the linear scan of
+ *           the PROGMEM table gave it
+ */
+float PressureSensor__Convert(const PressureSegment *segments, uint8_t length, int raw);
+
+/**
+ * Filters one OVERSAMPLENR sum. Integer only, for the temperature ISR.
+ * @param type  One of PRESSURE_FILTER_*
+ * @returns     The filtered sum
+ */
+int PressureSensor__Filter(PressureFilter *filter, uint8_t type, int raw);
+
+void PressureSensor__StatsReset(PressureStats *stats);
+void PressureSensor__StatsAdd(PressureStats *stats, float value);
+float PressureSensor__StatsStdDev(const PressureStats *stats);
+
+#endif // PNEUMATICS
+
+#endif  // MARLIN_PRESSURE_SENSOR_H_
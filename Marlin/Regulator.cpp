@@ -21,6 +21,21 @@
 static float current_target_pressure = 0;
 static bool  regulator_active = false;
 static bool  protectionsActive = true;
+static uint16_t dac_value = 0;  // Last value written to the DAC
+static float commanded_pressure = 0;  // psi, what the output is driven to
+
+#if ENABLED(REGULATOR_CLOSED_LOOP)
+  static float integral = 0;            // psi
+  static float trim = 0;                // psi added to the commanded pressure
+  static millis_t last_control_ms = 0;
+  static millis_t step_ms = 0;          // When the target last changed
+  static millis_t band_entry_ms = 0;    // Start of the current in-band run
+  static uint8_t  settle_count = 0;     // In-band readings in a row
+  static long     settling_time = -1;   // ms, -1 while settling
+  static float    steady_state_error = 0;
+#else
+  static bool hysteresis_up = true;     // The output last moved up
+#endif
 //===========================================================================
 //====================== Private Functions Prototypes =======================
 //===========================================================================
@@ -28,6 +43,11 @@ static bool  protectionsActive = true;
 static void _regulator_leak_error();
 static void _regulator_runaway_error();
 static void pressure_protection(float pressure, float target_pressure);
+static uint16_t _pressure_to_dac(float desired_pressure);
+static bool _write_output(float pressure);
+#if ENABLED(REGULATOR_CLOSED_LOOP)
+  static void _track_settling(float error, millis_t ms);
+#endif
 
 //===========================================================================
 //============================= Public Functions ============================
@@ -39,29 +59,40 @@ static void pressure_protection(float pressure, float target_pressure);
  *                          reach.
  */
 void Regulator__SetOutputPressure(float desired_pressure) {
-    uint16_t digital_val = 0;
     regulator_active = true;
+    #if ENABLED(REGULATOR_CLOSED_LOOP)
+      if (desired_pressure != current_target_pressure) {
+        // The proportional term was for the old target
+        trim = integral;
+        step_ms = millis();
+        settle_count = 0;
+        settling_time = -1;
+      }
+    #endif
     // Set current pressure for Regulator__Update()
     current_target_pressure = desired_pressure;
-    // Set to zero
-    if (desired_pressure <= (REG_OFFSET + REG_HYSTERESIS)) {
-        digital_val = 0;
-    }
-    // Increasing pressure
-    else if (desired_pressure > pressureRegulator()) {
-        // Add hysteresis value to desired pressure
-        digital_val = (uint16_t)(BITS_PER_PSI *
-                                 (desired_pressure - REG_OFFSET + REG_HYSTERESIS));
-    }
-    // Decreasing pressure
-    else if (desired_pressure < pressureRegulator()) {
-        // Subtract hysteresis value from desired pressure
-        digital_val = (uint16_t)(BITS_PER_PSI *
-                                 (desired_pressure - REG_OFFSET - REG_HYSTERESIS));
-    }
-    
-    // Write value to DAC
-    DAC_write(MCP4725_I2C_ADDRESS, digital_val);
+    // Write value to DAC, even if unchanged
+    dac_value = 0xFFFF;
+    _write_output(desired_pressure);
+}
+
+/**
+ * @returns  The pressure (in psi) last set by Regulator__SetOutputPressure()
+ */
+float Regulator__GetTargetPressure() {
+  return current_target_pressure;
+}
+
+/**
+ * Drives the output towards a pressure without changing the target the
+ * protections check against. Nothing is done if the output is already
+ * driven to that pressure, and the DAC is only written if its value changes.
+ * @param pressure  The pressure to command, in psi
+ * @returns         true if the DAC was written
+ */
+bool Regulator__AdvanceOutputPressure(float pressure) {
+  if (pressure == commanded_pressure) return false;
+  return _write_output(pressure);
 }
 
 
@@ -82,10 +113,139 @@ void Regulator__Update() {
     protectionsActive = value;
   }
 
+#if ENABLED(REGULATOR_CLOSED_LOOP)
+/**
+ * Feed-forward plus PI: the commanded pressure goes through the nominal
+ * conversion and the PI terms trim it by what the sensor says is missing.
+ * The integral is clamped to REGULATOR_INTEGRAL_MAX and held while the DAC
+ * is pinned at the end the error pushes towards, or asks for more than the
+ * tank holds, so it does not wind up while the output cannot follow.
+ * @param pressure  The output pressure (in psi) read by the feedback sensor
+ */
+void Regulator__Control(float pressure) {
+  millis_t ms = millis();
+  float dt = (ms - last_control_ms) * 0.001;
+  last_control_ms = ms;
+
+  // Pressure advance leads the output off the target and back. That is fed
+  // forward on top of the trim, which is held until the output is back on
+  // the target, so the loop doesn't learn the lead and take it out again.
+  if (regulator_active && commanded_pressure != current_target_pressure) return;
+
+  // Vented: nothing to correct, and the next setpoint starts clean
+  if (!regulator_active || commanded_pressure <= REG_OFFSET) {
+    integral = trim = 0;
+    return;
+  }
+  // The first step after venting has no previous sample to go by
+  NOMORE(dt, REGULATOR_CHECK_INTERVAL * 0.001);
+
+  // Neither the DAC nor the tank can push the output any further
+  float error = commanded_pressure - pressure;
+  bool saturated = error > 0 ? (dac_value >= 4095 || commanded_pressure + trim >= pressurePneumatic())
+                             : dac_value == 0;
+  if (!saturated)
+    integral = constrain(integral + REGULATOR_KI * error * dt,
+                         -REGULATOR_INTEGRAL_MAX, REGULATOR_INTEGRAL_MAX);
+  trim = REGULATOR_KP * error + integral;
+  _write_output(commanded_pressure);
+
+  _track_settling(error, ms);
+}
+
+long Regulator__GetSettlingTime() {
+  return settling_time;
+}
+
+float Regulator__GetSteadyStateError() {
+  return steady_state_error;
+}
+#endif // REGULATOR_CLOSED_LOOP
+
 //===========================================================================
 //============================ Private Functions ============================
 //===========================================================================
 
+/**
+ * Drives the DAC towards a pressure (in psi). The DAC is only written if its
+ * value changes.
+ * @returns  true if the DAC was written
+ */
+static bool _write_output(float pressure) {
+  uint16_t digital_val = _pressure_to_dac(pressure);
+  commanded_pressure = pressure;
+  if (digital_val == dac_value) return false;
+  dac_value = digital_val;
+  DAC_write(MCP4725_I2C_ADDRESS, dac_value);
+  return true;
+}
+
+#if ENABLED(REGULATOR_CLOSED_LOOP)
+
+/**
+ * Converts a pressure (in psi) to a DAC value, plus the controller's trim.
+ * The loop takes out hysteresis and gain errors, so none are applied here.
+ */
+static uint16_t _pressure_to_dac(float desired_pressure) {
+  if (desired_pressure <= REG_OFFSET) return 0;
+  float digital_val = BITS_PER_PSI * (desired_pressure + trim - REG_OFFSET);
+  // 12-bit DAC
+  return (uint16_t)constrain(digital_val, 0, 4095);
+}
+
+/**
+ * Times how long the output takes to stay within REGULATOR_SETTLE_BAND after
+ * a target change, then averages the error that remains.
+ * @param error  Commanded minus measured pressure, in psi
+ */
+static void _track_settling(float error, millis_t ms) {
+  if (settling_time >= 0) {
+    steady_state_error += (error - steady_state_error) * 0.25;
+  }
+  else if (fabs(error) <= REGULATOR_SETTLE_BAND) {
+    if (settle_count++ == 0) band_entry_ms = ms;
+    if (settle_count >= REGULATOR_SETTLE_SAMPLES) {
+      settling_time = band_entry_ms - step_ms;
+      steady_state_error = error;
+    }
+  }
+  else {
+    settle_count = 0;
+  }
+}
+
+#else
+
+/**
+ * Converts a pressure (in psi) to a DAC value, with the hysteresis for the
+ * direction the output has to move in. The direction is taken from the
+ * pressure last commanded, not from the sensor, so that commanding the same
+ * pressure again gives the same value.
+ */
+static uint16_t _pressure_to_dac(float desired_pressure) {
+    float digital_val = 0;
+    // Set to zero
+    if (desired_pressure <= (REG_OFFSET + REG_HYSTERESIS)) {
+        hysteresis_up = true;
+        return 0;
+    }
+    if (desired_pressure != commanded_pressure) {
+        hysteresis_up = desired_pressure > commanded_pressure;
+    }
+    if (hysteresis_up) {
+        // Increasing pressure: add hysteresis value to desired pressure
+        digital_val = BITS_PER_PSI * (desired_pressure - REG_OFFSET + REG_HYSTERESIS);
+    }
+    else {
+        // Decreasing pressure: subtract hysteresis value from desired pressure
+        digital_val = BITS_PER_PSI * (desired_pressure - REG_OFFSET - REG_HYSTERESIS);
+    }
+    // 12-bit DAC
+    return (uint16_t)constrain(digital_val, 0, 4095);
+}
+
+#endif // REGULATOR_CLOSED_LOOP
+
 /** 
  * Error handler when marlin detects a missing pressure regulator
  * @param serial_msg  The message to be displayed when the error occurs
@@ -93,6 +253,7 @@ void Regulator__Update() {
  */
 static void _regulator_error_handler(const char *serial_msg, float pressure) {
     quickStop();
+    set_regulator_setpoint(0); // So the stepper ISR doesn't restore a planned setpoint
     Regulator__SetOutputPressure(0);
     disable_all_heaters();
     disable_all_steppers();
@@ -21,14 +21,19 @@
 // Filter analog input: 2
 // 
 // BITS_PER_PSI = (2^n/(PSI_MAX - PSI_MIN)) / (R2/(R1 + R2)) = 40.92
-// Empirically tuned to 43.00
+// Empirically tuned to 43.00 for open-loop use. With REGULATOR_CLOSED_LOOP
+// the nominal value is used and the controller takes up the difference.
 
 #if (E_REGULATOR_SENSOR == 1)     // SMC E-Reg
     #define BITS_PER_PSI    33.1
     #define REG_OFFSET      0.25  // psi
     #define REG_HYSTERESIS  0.2   // psi
 #elif (E_REGULATOR_SENSOR == 2)   // Metalworks E-Reg
+  #if ENABLED(REGULATOR_CLOSED_LOOP)
+    #define BITS_PER_PSI    40.92
+  #else
     #define BITS_PER_PSI    43.00
+  #endif
     #define REG_OFFSET      0.0   // psi
     #define REG_HYSTERESIS  0.0   // psi
 #endif // E_REGULATOR_SENSOR
@@ -60,11 +65,44 @@
  */
   void Regulator__SetOutputPressure(float pressure);
 
+/**
+ * @returns  The pressure (in psi) last set by Regulator__SetOutputPressure()
+ */
+  float Regulator__GetTargetPressure();
+
+/**
+ * Drives the output towards a pressure (in psi) without changing the target
+ * the protections check against. Used by pressure advance.
+ * @returns  true if the DAC was written
+ */
+  bool Regulator__AdvanceOutputPressure(float pressure);
+
 /**
  * Updates the protection function, called regularly in the main loop.
  */
   void Regulator__Update();
 
+#if ENABLED(REGULATOR_CLOSED_LOOP)
+/**
+ * Runs one step of the PI loop on the output pressure, called from
+ * manage_heater() every REGULATOR_CHECK_INTERVAL.
+ * @param pressure  The output pressure (in psi) read by the feedback sensor
+ */
+  void Regulator__Control(float pressure);
+
+/**
+ * @returns  ms from the last target change until the output stayed within
+ *           REGULATOR_SETTLE_BAND, or -1 while it has not settled
+ */
+  long Regulator__GetSettlingTime();
+
+/**
+ * @returns  Average commanded minus measured pressure (in psi) since the
+ *           output settled
+ */
+  float Regulator__GetSteadyStateError();
+#endif
+
  /** 
   * Enables or disables pressure protections
   * @value     true = enable, false = no check.
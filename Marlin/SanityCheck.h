@@ -43,6 +43,16 @@
     #endif
   #endif
 
+  /**
+   * Serial rings, indexed with a uint8_t and a mask
+   */
+  #if RX_BUFFER_SIZE < 2 || RX_BUFFER_SIZE > 256 || (RX_BUFFER_SIZE & (RX_BUFFER_SIZE - 1))
+    #error RX_BUFFER_SIZE must be a power of 2 from 2 to 256.
+  #endif
+  #if TX_BUFFER_SIZE > 256 || (TX_BUFFER_SIZE & (TX_BUFFER_SIZE - 1))
+    #error TX_BUFFER_SIZE must be 0 or a power of 2 no larger than 256.
+  #endif
+
   /**
    * Filament Change with Extruder Runout Prevention
    */
@@ -204,6 +214,27 @@
 
     #endif // !AUTO_BED_LEVELING_GRID
 
+    /**
+     * Laser bed scan
+     */
+    #if ENABLED(LASER_BED_SCAN)
+      #if DISABLED(EXT_ADC)
+        #error LASER_BED_SCAN requires EXT_ADC.
+      #elif SCAN_GRID_POINTS < 2
+        #error SCAN_GRID_POINTS must be at least 2.
+      #elif LEFT_SCAN_BED_POSITION >= RIGHT_SCAN_BED_POSITION
+        #error LEFT_SCAN_BED_POSITION must be less than RIGHT_SCAN_BED_POSITION.
+      #elif FRONT_SCAN_BED_POSITION >= BACK_SCAN_BED_POSITION
+        #error FRONT_SCAN_BED_POSITION must be less than BACK_SCAN_BED_POSITION.
+      #elif LEFT_SCAN_BED_POSITION < MIN_PROBE_X || RIGHT_SCAN_BED_POSITION > MAX_PROBE_X
+        #error "The given LEFT/RIGHT_SCAN_BED_POSITION can't be reached by the laser."
+      #elif FRONT_SCAN_BED_POSITION < MIN_PROBE_Y || BACK_SCAN_BED_POSITION > MAX_PROBE_Y
+        #error "The given FRONT/BACK_SCAN_BED_POSITION can't be reached by the laser."
+      #endif
+    #elif ENABLED(LASER_MESH_LEVELING)
+      #error LASER_MESH_LEVELING requires LASER_BED_SCAN.
+    #endif
+
   #endif // AUTO_BED_LEVELING_FEATURE
 
   /**
@@ -329,6 +360,31 @@
     #endif
 
   #endif // DISABLED(PNEUMATICS)
+
+  /**
+   * Pressure advance
+   */
+  #if ENABLED(PRESSURE_ADVANCE)
+    #if DISABLED(E_REGULATOR) || DISABLED(PNEUMATICS)
+      #error PRESSURE_ADVANCE requires E_REGULATOR and PNEUMATICS.
+    #endif
+  #endif
+
+  /**
+   * Proportional pump
+   */
+  #if ENABLED(PNEUMATIC_PUMP_PWM) && !HAS_PNEUMATIC_PUMP
+    #error PNEUMATIC_PUMP_PWM requires a PNEUMATIC_PUMP_PIN.
+  #endif
+
+  /**
+   * I2C LCDs drive the bus with the Wire library, whose TWI interrupt
+   * would clash with the one of TwiQueue
+   */
+  #if ENABLED(LCD_I2C_TYPE_PCF8575) || ENABLED(LCD_I2C_TYPE_MCP23017) || ENABLED(LCD_I2C_TYPE_MCP23008)
+    #error I2C LCDs are not supported, they need the Wire library.
+  #endif
+
   /**
    * Warnings for old configurations
    */
@@ -0,0 +1,131 @@
+/**
+ * SegmentMerge.cpp - Merges runs of short collinear moves before the planner.
+ * See SegmentMerge.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "SegmentMerge.h"
+
+#if ENABLED(SEGMENT_MERGE)
+
+#include "planner.h"
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static uint8_t held = 0;                  // Moves in the held one, 0 if none
+static float start[NUM_AXIS];             // Where the held move starts
+static float end[NUM_AXIS];               // Where it ends
+static float joints[SEGMENT_MERGE_MAX_POINTS - 1][2]; // XY where the merged moves met
+static float direction[2];                // Unit XY direction of the last merged move
+static float length;                      // mm of XY path merged
+static float heldFeedRate;
+static uint8_t heldExtruder;
+static const float minCosine = cos(RADIANS(SEGMENT_MERGE_MAX_ANGLE));
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static bool _extends(const float from[NUM_AXIS], const float target[NUM_AXIS], float feed_rate,
+                     uint8_t extruder, float dx, float dy, float distance);
+static float _distance_to_chord(const float point[2], const float target[NUM_AXIS]);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void SegmentMerge__Line(const float from[NUM_AXIS], const float target[NUM_AXIS], float feed_rate, uint8_t extruder) {
+  float dx = target[X_AXIS] - from[X_AXIS],
+        dy = target[Y_AXIS] - from[Y_AXIS],
+        distance = sqrt(sq(dx) + sq(dy));
+
+  if (held) {
+    if (_extends(from, target, feed_rate, extruder, dx, dy, distance)) {
+      joints[held - 1][X_AXIS] = end[X_AXIS];
+      joints[held - 1][Y_AXIS] = end[Y_AXIS];
+      held++;
+      memcpy(end, target, sizeof(end));
+      direction[X_AXIS] = dx / distance;
+      direction[Y_AXIS] = dy / distance;
+      length += distance;
+      return;
+    }
+    SegmentMerge__Flush();
+  }
+
+  if (distance == 0 || target[Z_AXIS] != from[Z_AXIS] || movesplanned() < SEGMENT_MERGE_MIN_BLOCKS) {
+    plan_buffer_line(target[X_AXIS], target[Y_AXIS], target[Z_AXIS], target[E_AXIS], feed_rate, extruder);
+    return;
+  }
+
+  held = 1;
+  memcpy(start, from, sizeof(start));
+  memcpy(end, target, sizeof(end));
+  direction[X_AXIS] = dx / distance;
+  direction[Y_AXIS] = dy / distance;
+  length = distance;
+  heldFeedRate = feed_rate;
+  heldExtruder = extruder;
+}
+
+void SegmentMerge__Flush(void) {
+  if (!held) return;
+  // Cleared first: plan_buffer_line() runs idle() while it waits for room
+  held = 0;
+  plan_buffer_line(end[X_AXIS], end[Y_AXIS], end[Z_AXIS], end[E_AXIS], heldFeedRate, heldExtruder);
+}
+
+void SegmentMerge__Discard(void) { held = 0; }
+
+void SegmentMerge__Update(void) {
+  if (held && movesplanned() < SEGMENT_MERGE_MIN_BLOCKS) SegmentMerge__Flush();
+}
+
+uint8_t SegmentMerge__Held(void) { return held; }
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * Checks whether a move can be merged into the held one
+ * @param dx, dy, distance  XY of the move
+ */
+static bool _extends(const float from[NUM_AXIS], const float target[NUM_AXIS], float feed_rate,
+                     uint8_t extruder, float dx, float dy, float distance) {
+  if (held >= SEGMENT_MERGE_MAX_POINTS || distance == 0) return false;
+  if (feed_rate != heldFeedRate || extruder != heldExtruder) return false;
+  for (uint8_t i = 0; i < NUM_AXIS; i++) if (from[i] != end[i]) return false;
+  if (target[Z_AXIS] != end[Z_AXIS]) return false;
+
+  // Direction change
+  if ((dx * direction[X_AXIS] + dy * direction[Y_AXIS]) / distance < minCosine) return false;
+
+  // Extrusion per mm, which also keeps travel and extruding moves apart
+  float heldRatio = (end[E_AXIS] - start[E_AXIS]) / length,
+        ratio = (target[E_AXIS] - from[E_AXIS]) / distance;
+  if (fabs(ratio - heldRatio) > SEGMENT_MERGE_E_TOLERANCE * fabs(heldRatio)) return false;
+
+  // Chord error of every point the merged move would cut off
+  if (_distance_to_chord(end, target) > SEGMENT_MERGE_TOLERANCE) return false;
+  for (uint8_t i = 0; i < held - 1; i++)
+    if (_distance_to_chord(joints[i], target) > SEGMENT_MERGE_TOLERANCE) return false;
+
+  return true;
+}
+
+/**
+ * @returns  XY distance in mm of a point from the line start to target,
+ *           or from the nearer end beyond it
+ */
+static float _distance_to_chord(const float point[2], const float target[NUM_AXIS]) {
+  float cx = target[X_AXIS] - start[X_AXIS], cy = target[Y_AXIS] - start[Y_AXIS],
+        px = point[X_AXIS] - start[X_AXIS], py = point[Y_AXIS] - start[Y_AXIS],
+        chord = sq(cx) + sq(cy),
+        t = chord ? constrain((px * cx + py * cy) / chord, 0, 1) : 0;
+  return sqrt(sq(px - t * cx) + sq(py - t * cy));
+}
+
+#endif // SEGMENT_MERGE
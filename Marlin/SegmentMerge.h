@@ -0,0 +1,62 @@
+/**
+ * SegmentMerge.h - Merges runs of short collinear moves before the planner.
+ * Copyright (C) 2016 Voxel8
+ *
+ * Slicers send curved traces as many short G1 segments, each of which would
+ * take a block of its own and a pass of planner_recalculate(). An XY move is
+ * held back here instead, and the next one extends it if
+ *  - it keeps the feed rate, the extruder and Z,
+ *  - its direction turns by less than SEGMENT_MERGE_MAX_ANGLE,
+ *  - its E per mm is within SEGMENT_MERGE_E_TOLERANCE of the held move's, and
+ *  - no end point of the merged moves is further than SEGMENT_MERGE_TOLERANCE
+ *    from the straight line that replaces them.
+ * A move is only held while the planner has SEGMENT_MERGE_MIN_BLOCKS queued,
+ * so the steppers never wait for it.
+ *
+ * Whatever needs the planner to hold every move so far (any command but
+ * G0/G1, E or Z only moves) calls SegmentMerge__Flush() first.
+ */
+
+#ifndef MARLIN_SEGMENT_MERGE_H_
+#define MARLIN_SEGMENT_MERGE_H_
+
+#include "Marlin.h"
+
+#if ENABLED(SEGMENT_MERGE)
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Takes an XY move in place of plan_buffer_line(). It is merged into the
+ * held move, held, or planned right away.
+ * @param from       Where the move starts, the end of the previous one
+ * @param target     Where it ends
+ * @param feed_rate  mm/s, as for plan_buffer_line()
+ */
+void SegmentMerge__Line(const float from[NUM_AXIS], const float target[NUM_AXIS], float feed_rate, uint8_t extruder);
+
+/**
+ * Plans the held move, if any
+ */
+void SegmentMerge__Flush(void);
+
+/**
+ * Drops the held move, for quickStop()
+ */
+void SegmentMerge__Discard(void);
+
+/**
+ * Plans the held move once the planner runs low. Called from idle().
+ */
+void SegmentMerge__Update(void);
+
+/**
+ * @returns  Moves merged into the held one so far, 0 if none is held
+ */
+uint8_t SegmentMerge__Held(void);
+
+#endif // SEGMENT_MERGE
+
+#endif  // MARLIN_SEGMENT_MERGE_H_
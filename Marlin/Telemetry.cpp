@@ -0,0 +1,204 @@
+/**
+ * Telemetry.cpp - Temperatures and pressures pushed to the host.
+ * See Telemetry.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "Telemetry.h"
+
+#if ENABLED(TELEMETRY)
+
+#include "temperature.h"
+
+#if ENABLED(EXT_ADC)
+  #include "ADC.h"
+  #include "DistanceSensor.h"
+#endif
+
+#if ENABLED(BINARY_PROTOCOL)
+  #include "BinaryProtocol.h"
+#endif
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// Channels this machine can report
+#if HAS_TEMP_BED
+  #define TELEMETRY_HAS_BED TELEMETRY_BED
+#else
+  #define TELEMETRY_HAS_BED 0
+#endif
+#if ENABLED(PNEUMATICS)
+  #define TELEMETRY_HAS_TANK TELEMETRY_TANK
+#else
+  #define TELEMETRY_HAS_TANK 0
+#endif
+#if ENABLED(E_REGULATOR)
+  #define TELEMETRY_HAS_REGULATOR TELEMETRY_REGULATOR
+#else
+  #define TELEMETRY_HAS_REGULATOR 0
+#endif
+#if ENABLED(EXT_ADC)
+  #define TELEMETRY_HAS_LASER TELEMETRY_LASER
+#else
+  #define TELEMETRY_HAS_LASER 0
+#endif
+#define TELEMETRY_AVAILABLE (TELEMETRY_HOTENDS | TELEMETRY_HAS_BED | TELEMETRY_HAS_TANK \
+                             | TELEMETRY_HAS_REGULATOR | TELEMETRY_HAS_LASER)
+
+// Mask, time stamp and at most EXTRUDERS + 5 values
+#define TELEMETRY_PAYLOAD_MAX (3 + 2 * (EXTRUDERS + 5))
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static uint16_t interval = TELEMETRY_INTERVAL;  // ms, 0 = off
+static uint8_t channels = TELEMETRY_CHANNELS & TELEMETRY_AVAILABLE;
+static millis_t nextReport = 0;
+
+#if ENABLED(BINARY_PROTOCOL)
+  static uint8_t frameSeq = 0;
+#endif
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static void _print_line(millis_t ms);
+#if ENABLED(BINARY_PROTOCOL)
+  static void _send_frame(millis_t ms);
+  static uint8_t *_put(uint8_t *payload, int16_t value);
+#endif
+#if ENABLED(EXT_ADC)
+  static uint16_t _laser_distance(void);
+#endif
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+void Telemetry__Configure(uint16_t value, uint8_t mask) {
+  interval = value ? max(value, TELEMETRY_MIN_INTERVAL) : 0;
+  channels = mask & TELEMETRY_AVAILABLE;
+  nextReport = millis();
+}
+
+uint16_t Telemetry__GetInterval(void) { return interval; }
+uint8_t Telemetry__GetChannels(void) { return channels; }
+
+/**
+ * Reports on a fixed schedule from the last M155, skipping reports that
+ * fell due while idle() was not called rather than sending them in a burst.
+ */
+void Telemetry__Update(void) {
+  if (!interval || !channels) return;
+  millis_t ms = millis();
+  if ((long)(ms - nextReport) < 0) return;
+  nextReport += interval;
+  if ((long)(ms - nextReport) >= 0) nextReport = ms + interval;
+
+  #if ENABLED(BINARY_PROTOCOL)
+    if (BinaryProtocol__Enabled()) {
+      _send_frame(ms);
+      return;
+    }
+  #endif
+  _print_line(ms);
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+static void _print_line(millis_t ms) {
+  SERIAL_PROTOCOLPGM("TM:");
+  SERIAL_PROTOCOL(ms);
+  if (channels & TELEMETRY_HOTENDS) {
+    for (uint8_t e = 0; e < EXTRUDERS; e++) {
+      SERIAL_PROTOCOLPGM(" T");
+      SERIAL_PROTOCOL((int)e);
+      SERIAL_PROTOCOLCHAR(':');
+      SERIAL_PROTOCOL_F(degHotend(e), 1);
+    }
+  }
+  #if HAS_TEMP_BED
+    if (channels & TELEMETRY_BED) {
+      SERIAL_PROTOCOLPGM(" B:");
+      SERIAL_PROTOCOL_F(degBed(), 1);
+    }
+  #endif
+  #if ENABLED(PNEUMATICS)
+    if (channels & TELEMETRY_TANK) {
+      SERIAL_PROTOCOLPGM(" P:");
+      SERIAL_PROTOCOL_F(pressurePneumatic(), 1);
+    }
+  #endif
+  #if ENABLED(E_REGULATOR)
+    if (channels & TELEMETRY_REGULATOR) {
+      SERIAL_PROTOCOLPGM(" R:");
+      SERIAL_PROTOCOL_F(pressureRegulator(), 1);
+      SERIAL_PROTOCOLCHAR('/');
+      SERIAL_PROTOCOL_F(regulator_setpoint, 1);
+    }
+  #endif
+  #if ENABLED(EXT_ADC)
+    if (channels & TELEMETRY_LASER) {
+      SERIAL_PROTOCOLPGM(" L:");
+      SERIAL_PROTOCOL(_laser_distance());
+    }
+  #endif
+  SERIAL_EOL;
+}
+
+#if ENABLED(BINARY_PROTOCOL)
+
+  static void _send_frame(millis_t ms) {
+    uint8_t payload[TELEMETRY_PAYLOAD_MAX], *p = payload;
+    *p++ = channels;
+    p = _put(p, (int16_t)ms);
+    if (channels & TELEMETRY_HOTENDS)
+      for (uint8_t e = 0; e < EXTRUDERS; e++) p = _put(p, lround(degHotend(e) * 10));
+    #if HAS_TEMP_BED
+      if (channels & TELEMETRY_BED) p = _put(p, lround(degBed() * 10));
+    #endif
+    #if ENABLED(PNEUMATICS)
+      if (channels & TELEMETRY_TANK) p = _put(p, lround(current_pneumatic));
+    #endif
+    #if ENABLED(E_REGULATOR)
+      if (channels & TELEMETRY_REGULATOR) {
+        p = _put(p, lround(current_regulator));
+        p = _put(p, lround(regulator_setpoint * 10));
+      }
+    #endif
+    #if ENABLED(EXT_ADC)
+      if (channels & TELEMETRY_LASER) p = _put(p, _laser_distance());
+    #endif
+    BinaryProtocol__SendFrame(frameSeq++, BINARY_FRAME_TELEMETRY, payload, p - payload);
+  }
+
+  static uint8_t *_put(uint8_t *payload, int16_t value) {
+    *payload++ = value & 0xFF;
+    *payload++ = value >> 8;
+    return payload;
+  }
+
+#endif // BINARY_PROTOCOL
+
+#if ENABLED(EXT_ADC)
+
+  /**
+   * Average of the background sampler, which this keeps running while the
+   * channel is reported. Never waits for a conversion; until the average has
+   * filled up it is the last conversion.
+   */
+  static uint16_t _laser_distance(void) {
+    uint16_t count = ADC_sampler_count();
+    if (!count) return 0;
+    return get_dist_from_raw(count < _BV(ADC_SAMPLER_RING_POWER) ? ADC_sampler_latest() : ADC_sampler_filtered());
+  }
+
+#endif // EXT_ADC
+
+#endif // TELEMETRY
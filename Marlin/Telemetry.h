@@ -0,0 +1,59 @@
+/**
+ * Telemetry.h - Temperatures and pressures pushed to the host.
+ * Copyright (C) 2016 Voxel8
+ *
+ * Instead of polling with M105 and M236 V, each poll taking a command slot
+ * and a round trip, the host sets an interval and a set of channels with
+ * M155 and the firmware reports them from idle(). In ASCII mode a report is
+ * one line,
+ *
+ *   TM:<ms> T0:<C> T1:<C> B:<C> P:<psi> R:<psi>/<setpoint psi> L:<um>
+ *
+ * holding only the selected channels, with the millis() of the reading. In
+ * binary mode (M254 S1) it is a TELEMETRY frame (see BinaryProtocol.h) whose
+ * payload is the channel mask, the low 16 bits of millis(), and then one
+ * little-endian int16 per value in the order above: tenths of a degree or
+ * psi, and unsigned microns for the laser. SEQ counts the frames, so the
+ * host can tell when one was lost.
+ */
+
+#ifndef MARLIN_TELEMETRY_H_
+#define MARLIN_TELEMETRY_H_
+
+#include "Marlin.h"
+
+#if ENABLED(TELEMETRY)
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+// Channels, bits of the M155 C mask
+#define TELEMETRY_HOTENDS    0x01  // Every extruder's temperature
+#define TELEMETRY_BED        0x02
+#define TELEMETRY_TANK       0x04  // Pneumatic tank pressure
+#define TELEMETRY_REGULATOR  0x08  // Regulator output pressure and setpoint
+#define TELEMETRY_LASER      0x10  // Laser distance sensor
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * @param interval  ms between reports, 0 to stop. Shorter intervals are
+ *                  raised to TELEMETRY_MIN_INTERVAL.
+ * @param channels  TELEMETRY_* bits. Channels this machine does not have
+ *                  are dropped.
+ */
+void Telemetry__Configure(uint16_t interval, uint8_t channels);
+uint16_t Telemetry__GetInterval(void);
+uint8_t Telemetry__GetChannels(void);
+
+/**
+ * Sends a report if one is due. Called from idle().
+ */
+void Telemetry__Update(void);
+
+#endif // TELEMETRY
+
+#endif  // MARLIN_TELEMETRY_H_
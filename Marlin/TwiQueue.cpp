@@ -0,0 +1,215 @@
+/**
+ * TwiQueue.cpp - Interrupt-driven I2C transactions.
+ * A ring of transactions serviced by the TWI interrupt. See TwiQueue.h.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "TwiQueue.h"
+#include <util/twi.h>
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define TWI_QUEUE_MASK (TWI_QUEUE_SIZE - 1)
+
+// TWCR values. Writing TWINT clears it, which starts the next bus action.
+#define TWCR_NEXT   (_BV(TWEN) | _BV(TWIE) | _BV(TWINT))
+#define TWCR_ACK    (TWCR_NEXT | _BV(TWEA))
+#define TWCR_START  (TWCR_NEXT | _BV(TWSTA))
+#define TWCR_STOP   (TWCR_NEXT | _BV(TWSTO))
+
+// Polls of TWSTO before a new START, ~50us at 16MHz
+#define TWI_STOP_WAIT 200
+
+typedef struct {
+  uint8_t address;
+  uint8_t txLength;
+  uint8_t rxLength;
+  uint8_t tx[TWI_TX_MAX];
+  uint8_t *rx;
+  volatile uint8_t *status;
+  twi_callback_t callback;
+} TwiTransaction;
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+static TwiTransaction queue[TWI_QUEUE_SIZE];
+static volatile uint8_t queueHead = 0;  // Next free slot, moved by the main loop
+static volatile uint8_t queueTail = 0;  // Running transaction, moved by the ISR
+static uint8_t byteIndex;               // Next byte of the running phase
+static volatile millis_t startedMs;     // When the running transaction started
+static bool initialized = false;
+
+//===========================================================================
+//====================== Private Functions Prototypes =======================
+//===========================================================================
+
+static void _finish(uint8_t status, uint8_t twcr);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Sets the SCL clock with a prescaler of 1 and enables the peripheral. SDA
+ * and SCL get the internal pull-ups, as the Wire library sets them.
+ */
+void TwiQueue__Init(void) {
+  if (initialized) return;
+  initialized = true;
+  WRITE(TWI_SDA_PIN, HIGH);
+  WRITE(TWI_SCL_PIN, HIGH);
+  TWSR &= ~(_BV(TWPS0) | _BV(TWPS1));
+  TWBR = ((F_CPU / TWI_FREQ) - 16) / 2;
+  TWCR = _BV(TWEN) | _BV(TWIE);
+}
+
+bool TwiQueue__Write(uint8_t address, const uint8_t *data, uint8_t length) {
+  return TwiQueue__Transfer(address, data, length, NULL, 0, NULL, NULL);
+}
+
+/**
+ * Copies the transaction into the ring and starts the bus if it was idle.
+ * One slot stays empty so that a full ring differs from an empty one.
+ */
+bool TwiQueue__Transfer(uint8_t address, const uint8_t *tx, uint8_t tx_length,
+                        uint8_t *rx, uint8_t rx_length,
+                        volatile uint8_t *status, twi_callback_t callback) {
+  if (tx_length > TWI_TX_MAX) return false;
+
+  uint8_t head = queueHead,
+          next = (head + 1) & TWI_QUEUE_MASK;
+  while (next == queueTail) TwiQueue__Update();
+
+  TwiTransaction &t = queue[head];
+  t.address = address;
+  t.txLength = tx_length;
+  for (uint8_t i = 0; i < tx_length; i++) t.tx[i] = tx[i];
+  t.rx = rx;
+  t.rxLength = rx_length;
+  t.status = status;
+  t.callback = callback;
+  if (status) *status = TWI_STATUS_PENDING;
+
+  // A START written while the STOP that ended the last transaction is still
+  // on the bus is lost. The STOP takes a few bit times; the bound only keeps
+  // a stuck bus from hanging here, TwiQueue__Update() times that out.
+  for (uint8_t i = TWI_STOP_WAIT; i && (TWCR & _BV(TWSTO)); i--) { /* wait */ }
+
+  CRITICAL_SECTION_START;
+    bool idle = (head == queueTail);
+    queueHead = next;
+    if (idle) {
+      startedMs = millis();
+      TWCR = TWCR_START;
+    }
+  CRITICAL_SECTION_END;
+  return true;
+}
+
+uint8_t TwiQueue__Wait(volatile uint8_t *status) {
+  while (*status == TWI_STATUS_PENDING) TwiQueue__Update();
+  return *status;
+}
+
+/**
+ * Disabling the peripheral drops the bus and clears its state machine. The
+ * running transaction is then completed with TWI_STATUS_TIMEOUT, which
+ * starts the next one.
+ */
+void TwiQueue__Update(void) {
+  CRITICAL_SECTION_START;
+    if (queueHead != queueTail && millis() - startedMs > TWI_TIMEOUT) {
+      TWCR = 0;
+      TWCR = _BV(TWEN) | _BV(TWIE);
+      _finish(TWI_STATUS_TIMEOUT, TWCR_START);
+    }
+  CRITICAL_SECTION_END;
+}
+
+bool TwiQueue__Busy(void) {
+  return queueHead != queueTail;
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * Reports the running transaction and moves on to the next one.
+ * @param twcr  TWCR value that starts the next transaction; the bus is
+ *              stopped if there is none
+ */
+static void _finish(uint8_t status, uint8_t twcr) {
+  TwiTransaction &t = queue[queueTail];
+  if (t.status) *t.status = status;
+  if (t.callback) t.callback(status);
+
+  queueTail = (queueTail + 1) & TWI_QUEUE_MASK;
+  if (queueTail != queueHead) {
+    startedMs = millis();
+    TWCR = twcr;
+  }
+  else {
+    TWCR = TWCR_STOP;
+  }
+}
+
+/**
+ * Master transmitter and receiver. A transaction sends SLA+W and its bytes,
+ * then a repeated start, SLA+R and its reads. The last byte read is not
+ * acknowledged, which tells the slave to release the bus.
+ */
+ISR(TWI_vect) {
+  TwiTransaction &t = queue[queueTail];
+
+  switch (TW_STATUS) {
+    case TW_START:
+    case TW_REP_START: {
+      bool reading = TW_STATUS == TW_REP_START || (!t.txLength && t.rxLength);
+      byteIndex = 0;
+      TWDR = (t.address << 1) | (reading ? TW_READ : TW_WRITE);
+      TWCR = TWCR_NEXT;
+    } break;
+
+    case TW_MT_SLA_ACK:
+    case TW_MT_DATA_ACK:
+      if (byteIndex < t.txLength) {
+        TWDR = t.tx[byteIndex++];
+        TWCR = TWCR_NEXT;
+      }
+      else if (t.rxLength) {
+        TWCR = TWCR_START;
+      }
+      else {
+        // A STOP followed by a START begins the next transaction
+        _finish(TWI_STATUS_OK, TWCR_STOP | _BV(TWSTA));
+      }
+      break;
+
+    case TW_MR_DATA_ACK:
+      t.rx[byteIndex++] = TWDR;
+      // fall through
+    case TW_MR_SLA_ACK:
+      TWCR = (byteIndex + 1 < t.rxLength) ? TWCR_ACK : TWCR_NEXT;
+      break;
+
+    case TW_MR_DATA_NACK:
+      t.rx[byteIndex] = TWDR;
+      _finish(TWI_STATUS_OK, TWCR_STOP | _BV(TWSTA));
+      break;
+
+    case TW_MT_SLA_NACK:
+    case TW_MT_DATA_NACK:
+    case TW_MR_SLA_NACK:
+      _finish(TWI_STATUS_NACK, TWCR_STOP | _BV(TWSTA));
+      break;
+
+    default:  // TW_BUS_ERROR, TW_MT_ARB_LOST
+      _finish(TWI_STATUS_ERROR, TWCR_STOP | _BV(TWSTA));
+      break;
+  }
+}
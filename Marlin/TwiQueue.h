@@ -0,0 +1,98 @@
+/**
+ * TwiQueue.h - Interrupt-driven I2C transactions.
+ * Copyright (C) 2016 Voxel8
+ *
+ * Replaces the blocking Wire library for the cartridges, the regulator DAC
+ * and the external ADC. Transactions are copied into a ring and run one
+ * after the other by the TWI interrupt, so queuing one never waits on the
+ * bus. A transaction writes up to TWI_TX_MAX bytes, then reads rx_length
+ * bytes after a repeated start; either phase may be empty.
+ *
+ * Completion is reported through an optional status byte, which reads
+ * TWI_STATUS_PENDING until the transaction is done, and an optional callback
+ * run from the interrupt. A transaction still running after TWI_TIMEOUT ms
+ * resets the peripheral and completes with TWI_STATUS_TIMEOUT, so a stuck
+ * cartridge can't hang the bus.
+ */
+
+#ifndef MARLIN_TWI_QUEUE_H_
+#define MARLIN_TWI_QUEUE_H_
+
+#include "Marlin.h"
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define TWI_QUEUE_SIZE      8         // Transactions queued or running, power of 2
+#define TWI_TX_MAX          5         // Bytes written by one transaction
+#define TWI_FREQ            100000L   // SCL clock (Hz), as the Wire library
+#define TWI_TIMEOUT         5         // (ms) Bus reset after this long
+
+// Completion status
+#define TWI_STATUS_OK       0
+#define TWI_STATUS_PENDING  1
+#define TWI_STATUS_NACK     2         // Address or data byte not acknowledged
+#define TWI_STATUS_ERROR    3         // Bus error or lost arbitration
+#define TWI_STATUS_TIMEOUT  4
+
+/**
+ * Called from the TWI interrupt when a transaction is done.
+ * @param status  TWI_STATUS_*
+ */
+typedef void (*twi_callback_t)(uint8_t status);
+
+//===========================================================================
+//============================= Public Functions ============================
+//===========================================================================
+
+/**
+ * Sets up the TWI peripheral. Only the first call has an effect.
+ */
+void TwiQueue__Init(void);
+
+/**
+ * Queues a write and returns without waiting for it.
+ * @param address  7-bit slave address
+ * @param data     Bytes to write, copied
+ * @param length   Up to TWI_TX_MAX
+ * @returns        false if length is too long
+ */
+bool TwiQueue__Write(uint8_t address, const uint8_t *data, uint8_t length);
+
+/**
+ * Queues a write followed by a read. Waits only if the queue is full.
+ * @param address    7-bit slave address
+ * @param tx         Bytes to write, copied
+ * @param tx_length  Up to TWI_TX_MAX
+ * @param rx         Buffer for the bytes read, which must stay valid until
+ *                   the transaction is done
+ * @param rx_length  Bytes to read
+ * @param status     Set to TWI_STATUS_PENDING now and to the result once
+ *                   done, or NULL
+ * @param callback   Run from the interrupt once done, or NULL
+ * @returns          false if tx_length is too long
+ */
+bool TwiQueue__Transfer(uint8_t address, const uint8_t *tx, uint8_t tx_length,
+                        uint8_t *rx, uint8_t rx_length,
+                        volatile uint8_t *status, twi_callback_t callback);
+
+/**
+ * Waits for a transaction queued with TwiQueue__Transfer(), at most
+ * TWI_TIMEOUT ms after it reached the bus.
+ * @returns  TWI_STATUS_*
+ */
+uint8_t TwiQueue__Wait(volatile uint8_t *status);
+
+/**
+ * Resets the bus if a transaction has been running for over TWI_TIMEOUT ms.
+ * Called from idle().
+ */
+void TwiQueue__Update(void);
+
+/**
+ * @returns  true while transactions are queued or running
+ */
+bool TwiQueue__Busy(void);
+
+#endif  // MARLIN_TWI_QUEUE_H_
@@ -9,7 +9,8 @@
 
 #include "Marlin.h"
 #include "Voxel8_I2C_Commands.h"
-#include <Wire.h>
+#include "Cartridge.h"
+#include "TwiQueue.h"
 
 //===========================================================================
 //=============================== Definitions ===============================
@@ -24,6 +25,9 @@
 // fine for those wired in series (Gen 3D, and beyond).
 #define MAX_FAN_DUTY (255)
 
+// Longest reply read by requestAndPrintPacket()
+#define MAX_PACKET_LENGTH (4)
+
 // Defines for use with requesting serial number from Cartridges
 #define CARTRIDGE_SERIAL_LENGTH (4)
 #define CARTRIDGE_SERIAL_PROGRAMMER_STATION (0)
@@ -31,10 +35,40 @@
 #define CARTRIDGE_SERIAL_NUMBER_0 (2)
 #define CARTRIDGE_SERIAL_NUMBER_1 (3)
 
+// Metadata cache states
+#define INFO_ABSENT     (0)
+#define INFO_REQUESTED  (1)
+#define INFO_RETRY      (2)   // Requested again after a failed read
+#define INFO_READING    (3)
+#define INFO_VALID      (4)
+#define NO_CARTRIDGE    (0xFF)
+
+// Commands read into the metadata cache, with the length of their reply.
+// The same reads, in the same order, as M245 makes without the cache.
+#define INFO_READ_STEPS (6)
+
 //===========================================================================
 //============================ Private Variables ============================
 //===========================================================================
 
+static const uint8_t infoCommand[INFO_READ_STEPS] = {
+  EEPROM_READ_SERIAL, EEPROM_READ_PRGMR, EEPROM_READ_TYPE,
+  EEPROM_READ_SIZE, EEPROM_READ_MTRL, EEPROM_READ_FRMWRE
+};
+static const uint8_t infoLength[INFO_READ_STEPS] = {
+  CARTRIDGE_SERIAL_LENGTH, 1, 1, 1, 1, 1
+};
+
+static CartridgeInfo cartridgeInfo[NUMBER_OF_CARTRIDGES];
+static volatile uint8_t infoState[NUMBER_OF_CARTRIDGES];
+static millis_t infoRetryMs[NUMBER_OF_CARTRIDGES];  // For INFO_RETRY
+
+// The read in progress, one reply at a time
+static uint8_t infoCart = NO_CARTRIDGE;
+static uint8_t infoStep;
+static volatile uint8_t infoStatus = TWI_STATUS_OK;
+static uint8_t infoReply[CARTRIDGE_SERIAL_LENGTH];
+
 //===========================================================================
 //====================== Private Functions Prototypes =======================
 //===========================================================================
@@ -45,7 +79,15 @@ void requestAndPrintPacket(uint8_t I2C_target_address, uint8_t bytes);
 
 void requestAndPrintSerial(uint8_t I2C_target_address);
 
+void printSerial(uint8_t type, uint8_t programmerStation, uint16_t number);
+
 void printPrecedingZero(int number, uint8_t precision);
+
+static uint8_t cartridgeNumber(uint8_t I2C_target_address);
+
+static void queueInfoStep(void);
+
+static void storeInfoStep(void);
 //===========================================================================
 //============================ Public Functions =============================
 //===========================================================================
@@ -147,6 +189,12 @@ void I2C__EEPROMWrite(uint8_t I2C_target_address, uint8_t eeprom_address, uint8_
   // Send message
   writeThreeBytePacket(I2C_target_address, EEPROM_WRITE, eeprom_address, data);
 
+  // The cached metadata may have changed
+  uint8_t cartNumber = cartridgeNumber(I2C_target_address);
+  if (cartNumber != NO_CARTRIDGE && infoState[cartNumber] != INFO_ABSENT) {
+    I2C__RequestCartridgeInfo(cartNumber);
+  }
+
   // Send information to Octoprint
   SERIAL_PROTOCOLLNPGM("Command: 'EEPROM Write' Sent");
   SERIAL_PROTOCOLPGM("Value = ");
@@ -345,6 +393,131 @@ void I2C__ClearError(uint8_t I2C_target_address) {
   SERIAL_EOL;
 }
 
+/**
+ * Prints the M245 diagnostics of a cartridge from the metadata cache, or
+ * reads them from the target if they are not cached.
+ * @param I2C_target_address           Address of the target (cartridge or holder)
+ */
+void I2C__PrintDiagnostics(uint8_t I2C_target_address) {
+  const CartridgeInfo *info = I2C__GetCartridgeInfo(cartridgeNumber(I2C_target_address));
+  if (!info) {
+    I2C__GetSerial(I2C_target_address);
+    I2C__GetProgrammerStation(I2C_target_address);
+    I2C__GetPeripheralType(I2C_target_address);
+    I2C__GetSize(I2C_target_address);
+    I2C__GetMaterial(I2C_target_address);
+    I2C__GetFirmwareVersion(I2C_target_address);
+    return;
+  }
+
+  // Same output as the reads above
+  SERIAL_PROTOCOLPGM("Serial Number = ");
+  printSerial(info->serialType, info->serialProgrammerStation, info->serialNumber);
+  SERIAL_EOL;
+  SERIAL_PROTOCOLPGM("Programmer Station = ");
+  SERIAL_PROTOCOL((int)info->programmerStation);
+  SERIAL_EOL;
+  SERIAL_PROTOCOLPGM("I2C_target_address Type = ");
+  SERIAL_PROTOCOL((int)info->type);
+  SERIAL_EOL;
+  SERIAL_PROTOCOLPGM("Cartridge Size = ");
+  SERIAL_PROTOCOL((int)info->size);
+  SERIAL_EOL;
+  SERIAL_PROTOCOLPGM("Cartridge Material = ");
+  SERIAL_PROTOCOL((int)info->material);
+  SERIAL_EOL;
+  SERIAL_PROTOCOLPGM("Cartridge Firmware Version = ");
+  SERIAL_PROTOCOL((int)info->firmwareVersion);
+  SERIAL_EOL;
+}
+
+/**
+ * Schedules a background read of the metadata of a cartridge. Safe to call
+ * from an interrupt.
+ * @param cartNumber                   0 or 1
+ */
+void I2C__RequestCartridgeInfo(uint8_t cartNumber) {
+  if (cartNumber < NUMBER_OF_CARTRIDGES) {
+    infoState[cartNumber] = INFO_REQUESTED;
+  }
+}
+
+/**
+ * Drops the cached metadata of a cartridge. Safe to call from an interrupt.
+ * @param cartNumber                   0 or 1
+ */
+void I2C__InvalidateCartridgeInfo(uint8_t cartNumber) {
+  if (cartNumber < NUMBER_OF_CARTRIDGES) {
+    infoState[cartNumber] = INFO_ABSENT;
+  }
+}
+
+/**
+ * Steps the background reads of cartridge metadata. Each step queues one
+ * command and its reply, and the next step picks up the reply once the TWI
+ * interrupt is done with it. A failed reply puts the cartridge back in line
+ * for a read after CARTRIDGE_INFO_RETRY ms, since a cartridge that was just
+ * inserted may still be booting.
+ */
+void I2C__UpdateCartridgeInfo(void) {
+  if (infoStatus == TWI_STATUS_PENDING) {
+    return;
+  }
+
+  if (infoCart != NO_CARTRIDGE) {
+    bool done = false;
+    CRITICAL_SECTION_START;
+      if (infoState[infoCart] != INFO_READING) {
+        // Removed or requested again while reading
+        done = true;
+      } else if (infoStatus != TWI_STATUS_OK) {
+        infoRetryMs[infoCart] = millis() + CARTRIDGE_INFO_RETRY;
+        infoState[infoCart] = INFO_RETRY;
+        done = true;
+      } else {
+        storeInfoStep();
+        if (++infoStep == INFO_READ_STEPS) {
+          infoState[infoCart] = INFO_VALID;
+          done = true;
+        }
+      }
+    CRITICAL_SECTION_END;
+
+    if (!done) {
+      queueInfoStep();
+      return;
+    }
+    infoCart = NO_CARTRIDGE;
+  }
+
+  millis_t ms = millis();
+  for (uint8_t i = 0; i < NUMBER_OF_CARTRIDGES && infoCart == NO_CARTRIDGE; i++) {
+    CRITICAL_SECTION_START;
+      if (infoState[i] == INFO_REQUESTED ||
+          (infoState[i] == INFO_RETRY && (long)(ms - infoRetryMs[i]) >= 0)) {
+        infoState[i] = INFO_READING;
+        infoCart = i;
+        infoStep = 0;
+      }
+    CRITICAL_SECTION_END;
+  }
+  if (infoCart != NO_CARTRIDGE) {
+    queueInfoStep();
+  }
+}
+
+/**
+ * @param cartNumber                   0 or 1
+ * @returns                            The cached metadata, or NULL until a
+ *                                     read has completed
+ */
+const CartridgeInfo *I2C__GetCartridgeInfo(uint8_t cartNumber) {
+  if (cartNumber >= NUMBER_OF_CARTRIDGES || infoState[cartNumber] != INFO_VALID) {
+    return NULL;
+  }
+  return &cartridgeInfo[cartNumber];
+}
+
 //===========================================================================
 //============================ Private Functions ============================
 //===========================================================================
@@ -357,52 +530,59 @@ void I2C__ClearError(uint8_t I2C_target_address) {
  * #define I2C_ADDRESS         2
 */
 
+// Queued, returns before the packet is on the bus
 void writeThreeBytePacket(uint8_t I2C_target_address, uint8_t command,
                           uint8_t address, uint8_t data) {
-  Wire.beginTransmission((uint8_t)I2C_target_address);
-  Wire.write(command);
-  Wire.write(data);
-  Wire.write(address);
-  Wire.endTransmission();
+  uint8_t packet[3] = { command, data, address };
+  TwiQueue__Write(I2C_target_address, packet, sizeof(packet));
 }
 
+// Waits for the reply, which follows the packets queued before it
 void requestAndPrintPacket(uint8_t I2C_target_address, uint8_t bytes) {
+  uint8_t buffer[MAX_PACKET_LENGTH];
+  volatile uint8_t status;
+  bytes = min(bytes, MAX_PACKET_LENGTH);
+
   // Read from I2C_target_address and report
-  Wire.requestFrom(I2C_target_address, bytes);
-  if (!Wire.available()) {
-    SERIAL_PROTOCOLPGM(" No Packet Available ");
-  } else {
-    while (Wire.available()) {
-      SERIAL_PROTOCOL(Wire.read());
-      if (Wire.twi_getTimeoutFlag()) {
-        SERIAL_PROTOCOLPGM(" I2C Timeout occurred ");
-        SERIAL_PROTOCOL(Wire.twi_getTimeoutFlag());
-        Wire.twi_resetTimeoutFlag();
+  TwiQueue__Transfer(I2C_target_address, NULL, 0, buffer, bytes, &status, NULL);
+  switch (TwiQueue__Wait(&status)) {
+    case TWI_STATUS_OK:
+      for (uint8_t i = 0; i < bytes; i++) {
+        SERIAL_PROTOCOL((int)buffer[i]);
       }
-    }
+      break;
+    case TWI_STATUS_TIMEOUT:
+      SERIAL_PROTOCOLPGM(" I2C Timeout occurred ");
+      break;
+    default:
+      SERIAL_PROTOCOLPGM(" No Packet Available ");
+      break;
   }
 }
 
 void requestAndPrintSerial(uint8_t I2C_target_address) {
-  int buffer[CARTRIDGE_SERIAL_LENGTH] = {};
-  uint8_t index = 0;
+  uint8_t buffer[CARTRIDGE_SERIAL_LENGTH] = {};
+  volatile uint8_t status;
   uint16_t serialNumberSum = 0;
-  Wire.requestFrom(I2C_target_address, uint8_t(CARTRIDGE_SERIAL_LENGTH));
-  while (Wire.available()) {
-    buffer[index] = Wire.read();
-    if (index < CARTRIDGE_SERIAL_LENGTH) {
-      index++;
-    }
+  TwiQueue__Transfer(I2C_target_address, NULL, 0, buffer,
+                     CARTRIDGE_SERIAL_LENGTH, &status, NULL);
+  if (TwiQueue__Wait(&status) != TWI_STATUS_OK) {
+    memset(buffer, 0, sizeof(buffer));
   }
 
-  SERIAL_PROTOCOL(buffer[CARTRIDGE_SERIAL_TYPE]);
-  SERIAL_PROTOCOL(buffer[CARTRIDGE_SERIAL_PROGRAMMER_STATION]);
-
   serialNumberSum = (buffer[CARTRIDGE_SERIAL_NUMBER_0] * 255) +
                     buffer[CARTRIDGE_SERIAL_NUMBER_1];
 
-  printPrecedingZero(serialNumberSum, 4);
-  SERIAL_PROTOCOL(serialNumberSum);
+  printSerial(buffer[CARTRIDGE_SERIAL_TYPE],
+              buffer[CARTRIDGE_SERIAL_PROGRAMMER_STATION], serialNumberSum);
+}
+
+void printSerial(uint8_t type, uint8_t programmerStation, uint16_t number) {
+  SERIAL_PROTOCOL((int)type);
+  SERIAL_PROTOCOL((int)programmerStation);
+
+  printPrecedingZero(number, 4);
+  SERIAL_PROTOCOL(number);
 
   SERIAL_EOL;
 }
@@ -419,3 +599,51 @@ void printPrecedingZero(int number, uint8_t precision) {
     decimalLimit = decimalLimit * 10;
   }
 }
+
+static uint8_t cartridgeNumber(uint8_t I2C_target_address) {
+  switch (I2C_target_address) {
+    case CART0_ADDR:
+      return 0;
+    case CART1_ADDR:
+      return 1;
+    default:
+      return NO_CARTRIDGE;
+  }
+}
+
+// Queues the command of the current step of infoCart and the read of its reply
+static void queueInfoStep(void) {
+  uint8_t address = infoCart == 0 ? CART0_ADDR : CART1_ADDR;
+  writeThreeBytePacket(address, infoCommand[infoStep], I2C_EMPTY_ADDRESS,
+                       I2C_EMPTY_DATA);
+  TwiQueue__Transfer(address, NULL, 0, infoReply, infoLength[infoStep],
+                     &infoStatus, NULL);
+}
+
+// Copies the reply of the current step into the cache of infoCart
+static void storeInfoStep(void) {
+  CartridgeInfo &info = cartridgeInfo[infoCart];
+  switch (infoCommand[infoStep]) {
+    case EEPROM_READ_SERIAL:
+      info.serialProgrammerStation = infoReply[CARTRIDGE_SERIAL_PROGRAMMER_STATION];
+      info.serialType = infoReply[CARTRIDGE_SERIAL_TYPE];
+      info.serialNumber = (infoReply[CARTRIDGE_SERIAL_NUMBER_0] * 255) +
+                          infoReply[CARTRIDGE_SERIAL_NUMBER_1];
+      break;
+    case EEPROM_READ_PRGMR:
+      info.programmerStation = infoReply[0];
+      break;
+    case EEPROM_READ_TYPE:
+      info.type = infoReply[0];
+      break;
+    case EEPROM_READ_SIZE:
+      info.size = infoReply[0];
+      break;
+    case EEPROM_READ_MTRL:
+      info.material = infoReply[0];
+      break;
+    case EEPROM_READ_FRMWRE:
+      info.firmwareVersion = infoReply[0];
+      break;
+  }
+}
@@ -10,6 +10,8 @@
 #ifndef MARLIN_VOXEL8_I2C_COMMANDS_H_
 #define MARLIN_VOXEL8_I2C_COMMANDS_H_
 
+#include <stdint.h>
+
 //===========================================================================
 //=============================== Definitions ===============================
 //===========================================================================
@@ -49,6 +51,24 @@
 #define GET_GPIO_V_SENSE        0x20
 #define GET_GPIO_SWITCH         0x21
 
+/* Cartridge metadata cache */
+// Read in the background after a cartridge is inserted, dropped when it is
+// removed. A failed read is retried after CARTRIDGE_INFO_RETRY ms.
+#define CARTRIDGE_INFO_RETRY    1000
+
+typedef struct {
+  // The EEPROM_READ_SERIAL reply, which M245 prints as the serial number
+  uint8_t serialType;
+  uint8_t serialProgrammerStation;
+  uint16_t serialNumber;
+  // Replies to the commands of their own
+  uint8_t programmerStation;
+  uint8_t type;
+  uint8_t size;
+  uint8_t material;
+  uint8_t firmwareVersion;
+} CartridgeInfo;
+
 //===========================================================================
 //============================= Public Functions ============================
 //===========================================================================
@@ -160,4 +180,37 @@ void I2C__GetGpioSwitch(uint8_t I2C_target_address);
  */
 void I2C__ClearError(uint8_t I2C_target_address);
 
+/**
+ * Prints the M245 diagnostics of a cartridge from the metadata cache, or
+ * reads them from the target if they are not cached.
+ * @param I2C_target_address           Address of the target (cartridge or holder)
+ */
+void I2C__PrintDiagnostics(uint8_t I2C_target_address);
+
+/**
+ * Schedules a background read of the metadata of a cartridge. Safe to call
+ * from an interrupt.
+ * @param cartNumber                   0 or 1
+ */
+void I2C__RequestCartridgeInfo(uint8_t cartNumber);
+
+/**
+ * Drops the cached metadata of a cartridge. Safe to call from an interrupt.
+ * @param cartNumber                   0 or 1
+ */
+void I2C__InvalidateCartridgeInfo(uint8_t cartNumber);
+
+/**
+ * Steps the background reads of cartridge metadata without waiting on the
+ * bus. Called from idle().
+ */
+void I2C__UpdateCartridgeInfo(void);
+
+/**
+ * @param cartNumber                   0 or 1
+ * @returns                            The cached metadata, or NULL until a
+ *                                     read has completed
+ */
+const CartridgeInfo *I2C__GetCartridgeInfo(uint8_t cartNumber);
+
 #endif  // MARLIN_VOXEL8_I2C_COMMANDS_H_
@@ -9,14 +9,10 @@
 #include "blinkm.h"
 
 void SendColors(byte red, byte grn, byte blu) {
-  Wire.begin(); 
-  Wire.beginTransmission(0x09);
-  Wire.write('o');                    //to disable ongoing script, only needs to be used once
-  Wire.write('n');
-  Wire.write(red);
-  Wire.write(grn);
-  Wire.write(blu);
-  Wire.endTransmission();
+  // 'o' disables the ongoing script, only needs to be used once
+  uint8_t packet[5] = { 'o', 'n', red, grn, blu };
+  TwiQueue__Init();
+  TwiQueue__Write(0x09, packet, sizeof(packet));
 }
 
 #endif //BLINKM
@@ -4,6 +4,6 @@
  */
 
 #include "Arduino.h"
-#include "Wire.h"
+#include "TwiQueue.h"
 
 void SendColors(byte red, byte grn, byte blu);
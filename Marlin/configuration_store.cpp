@@ -538,14 +538,18 @@ void Config_ResetDefault() {
 
   #if ENABLED(PIDTEMP)
     #if ENABLED(PID_PARAMS_PER_EXTRUDER)
+      const float default_Kp[] = ARRAY_BY_EXTRUDERS(DEFAULT_Kp, DEFAULT_Kp_E1, DEFAULT_Kp_E2, DEFAULT_Kp_E3),
+                  default_Ki[] = ARRAY_BY_EXTRUDERS(DEFAULT_Ki, DEFAULT_Ki_E1, DEFAULT_Ki_E2, DEFAULT_Ki_E3),
+                  default_Kd[] = ARRAY_BY_EXTRUDERS(DEFAULT_Kd, DEFAULT_Kd_E1, DEFAULT_Kd_E2, DEFAULT_Kd_E3);
       for (int e = 0; e < EXTRUDERS; e++)
     #else
+      const float default_Kp[] = { DEFAULT_Kp }, default_Ki[] = { DEFAULT_Ki }, default_Kd[] = { DEFAULT_Kd };
       int e = 0; // only need to write once
     #endif
     {
-      PID_PARAM(Kp, e) = DEFAULT_Kp;
-      PID_PARAM(Ki, e) = scalePID_i(DEFAULT_Ki);
-      PID_PARAM(Kd, e) = scalePID_d(DEFAULT_Kd);
+      PID_PARAM(Kp, e) = default_Kp[e];
+      PID_PARAM(Ki, e) = scalePID_i(default_Ki[e]);
+      PID_PARAM(Kd, e) = scalePID_d(default_Kd[e]);
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         PID_PARAM(Kc, e) = DEFAULT_Kc;
       #endif
@@ -553,8 +557,6 @@ void Config_ResetDefault() {
     #if ENABLED(PID_ADD_EXTRUSION_RATE)
       lpq_len = 20; // default last-position-queue size
     #endif
-    // call updatePID (similar to when we have processed M301)
-    updatePID();
   #endif // PIDTEMP
 
   #if ENABLED(PIDTEMPBED)
@@ -563,6 +565,11 @@ void Config_ResetDefault() {
     bedKd = scalePID_d(DEFAULT_bedKd);
   #endif
 
+  #if ENABLED(PIDTEMP) || ENABLED(PIDTEMPBED)
+    // call updatePID (similar to when we have processed M301 and M304)
+    updatePID();
+  #endif
+
   #if ENABLED(FWRETRACT)
     autoretract_enabled = false;
     retract_length = RETRACT_LENGTH;
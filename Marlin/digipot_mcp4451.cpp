@@ -2,9 +2,7 @@
 
 #if ENABLED(DIGIPOT_I2C)
 
-#include "Stream.h"
-#include "utility/twi.h"
-#include "Wire.h"
+#include "TwiQueue.h"
 
 // Settings for the I2C based DIGIPOT (MCP4451) on Azteeg X3 Pro
 #if MB(5DPRINT)
@@ -20,10 +18,8 @@ static byte current_to_wiper(float current) {
 }
 
 static void i2c_send(byte addr, byte a, byte b) {
-  Wire.beginTransmission(addr);
-  Wire.write(a);
-  Wire.write(b);
-  Wire.endTransmission();
+  uint8_t packet[2] = { a, b };
+  TwiQueue__Write(addr, packet, sizeof(packet));
 }
 
 // This is for the MCP4451 I2C based digipot
@@ -48,7 +44,7 @@ void digipot_i2c_set_current(int channel, float current) {
 
 void digipot_i2c_init() {
   const float digipot_motor_current[] = DIGIPOT_I2C_MOTOR_CURRENTS;
-  Wire.begin();
+  TwiQueue__Init();
   // setup initial currents as defined in Configuration_adv.h
   for(int i = 0; i < COUNT(digipot_motor_current); i++) {
     digipot_i2c_set_current(i, digipot_motor_current[i]);
@@ -100,6 +100,7 @@
 
 #define MSG_M235_REPORT                     "Reporting Distance Measurement"
 #define MSG_EXT_ADC_REPORT                  "Current Measurement (um): "
+#define MSG_EXT_ADC_FAILED                  "External ADC not responding, sampling stopped"
 
 #define MSG_Enqueueing                      "enqueueing \""
 #define MSG_POWERUP                         "PowerUp"
@@ -118,6 +119,8 @@
 #define MSG_ERR_CHECKSUM_MISMATCH           "checksum mismatch, Last Line: "
 #define MSG_ERR_NO_CHECKSUM                 "No Checksum with line number, Last Line: "
 #define MSG_ERR_NO_LINENUMBER_WITH_CHECKSUM "No Line Number with checksum, Last Line: "
+#define MSG_ERR_BINARY_FRAME                "Invalid binary frame"
+#define MSG_RX_OVERFLOW                     "Serial RX buffer full, bytes dropped: "
 #define MSG_FILE_PRINTED                    "Done printing file"
 #define MSG_BEGIN_FILE_LIST                 "Begin file list"
 #define MSG_END_FILE_LIST                   "End file list"
@@ -198,6 +201,14 @@
 #define MSG_T                               "T:"
 #define MSG_AT                              " @:"
 #define MSG_PID_AUTOTUNE_FINISHED           MSG_PID_AUTOTUNE " finished! Put the last Kp, Ki and Kd constants from below into Configuration.h"
+#define MSG_PID_NO_MODEL                    MSG_PID_AUTOTUNE_FAILED " No model fits the step"
+#define MSG_PID_MODEL                       " Model"
+#define MSG_PID_MODEL_GAIN                  " gain: "
+#define MSG_PID_MODEL_TAU                   " tau: "
+#define MSG_PID_MODEL_DEAD_TIME             " dead time: "
+#define MSG_PID_MODEL_RMS                   " rms: "
+#define MSG_PID_MODEL_SAMPLES               " samples: "
+#define MSG_PID_AUTOTUNE_STORED             MSG_PID_AUTOTUNE " gains applied and stored"
 #define MSG_PID_DEBUG                       " PID_DEBUG "
 #define MSG_PID_DEBUG_INPUT                 ": Input "
 #define MSG_PID_DEBUG_OUTPUT                " Output "
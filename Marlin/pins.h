@@ -248,6 +248,17 @@
   #define Z2_ENABLE_PIN    E1_ENABLE_PIN
 #endif
 
+// Hardware I2C (TWI) pins of the processor
+#ifndef TWI_SDA_PIN
+  #if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+    #define TWI_SDA_PIN      20
+    #define TWI_SCL_PIN      21
+  #elif defined(__AVR_ATmega644P__) || defined(__AVR_ATmega1284P__)
+    #define TWI_SDA_PIN      17
+    #define TWI_SCL_PIN      16
+  #endif
+#endif
+
 #define SENSITIVE_PINS { 0, 1, \
                         X_STEP_PIN, X_DIR_PIN, X_ENABLE_PIN, X_MIN_PIN, X_MAX_PIN, \
                         Y_STEP_PIN, Y_DIR_PIN, Y_ENABLE_PIN, Y_MIN_PIN, Y_MAX_PIN, \
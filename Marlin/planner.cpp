@@ -35,14 +35,14 @@
  *
  * Speed after a given distance of travel with constant acceleration:
  *   Solve[{Speed[s, a, t] == m, Travel[s, a, t] == d}, m, t]
- *   m -> Sqrt[2 a d + s^2]
+ *   m -> Sqrt[2 a d + s^2] --> the stepper ISR, stepwise
  *
  * DestinationSpeed[s_, a_, d_] := Sqrt[2 a d + s^2]
  *
  * When to start braking (di) to reach a specified destination speed (s2) after accelerating
  * from initial speed s1 without ever stopping at a plateau:
  *   Solve[{DestinationSpeed[s1, a, di] == DestinationSpeed[s2, a, d - di]}, di]
- *   di -> (2 a d - s1^2 + s2^2)/(4 a) --> intersection_distance()
+ *   di -> (2 a d - s1^2 + s2^2)/(4 a) --> calculate_trapezoid_for_block()
  *
  * IntersectionDistance[s1_, s2_, a_, d_] := (2 a d - s1^2 + s2^2)/(4 a)
  *
@@ -57,6 +57,8 @@
 
 #if ENABLED(MESH_BED_LEVELING)
   #include "mesh_bed_leveling.h"
+#elif ENABLED(LASER_MESH_LEVELING)
+  #include "BedScan.h"
 #endif
 
 //===========================================================================
@@ -100,6 +102,7 @@ unsigned long axis_steps_per_sqr_second[NUM_AXIS];
 block_t block_buffer[BLOCK_BUFFER_SIZE];            // A ring buffer for motion instfructions
 volatile unsigned char block_buffer_head;           // Index of the next block to be pushed
 volatile unsigned char block_buffer_tail;           // Index of the block to process now
+unsigned char block_buffer_planned;                 // Index of the last block whose entry speed is final
 
 //===========================================================================
 //============================ private variables ============================
@@ -146,11 +149,6 @@ FORCE_INLINE float estimate_acceleration_distance(float initial_rate, float targ
 // a total travel of distance. This can be used to compute the intersection point between acceleration and
 // deceleration in the cases where the trapezoid has no plateau (i.e. never reaches maximum speed)
 
-FORCE_INLINE float intersection_distance(float initial_rate, float final_rate, float acceleration, float distance) {
-  if (acceleration == 0) return 0; // acceleration was 0, set intersection distance to 0
-  return (acceleration * 2 * distance - initial_rate * initial_rate + final_rate * final_rate) / (acceleration * 4);
-}
-
 // Calculates trapezoid parameters so that the entry- and exit-speed is compensated by the provided factors.
 
 void calculate_trapezoid_for_block(block_t *block, float entry_factor, float exit_factor) {
@@ -161,23 +159,29 @@ void calculate_trapezoid_for_block(block_t *block, float entry_factor, float exi
   NOLESS(initial_rate, 120);
   NOLESS(final_rate, 120);
 
-  long acceleration = block->acceleration_st;
-  int32_t accelerate_steps = ceil(estimate_acceleration_distance(initial_rate, block->nominal_rate, acceleration));
-  int32_t decelerate_steps = floor(estimate_acceleration_distance(block->nominal_rate, final_rate, -acceleration));
+  // The ramps as in estimate_acceleration_distance(), sharing one division
+  float initial_sq = sq((float)initial_rate), final_sq = sq((float)final_rate),
+        nominal_sq = sq((float)block->nominal_rate),
+        inverse_2a = block->acceleration_st ? 0.5 / block->acceleration_st : 0;
+  int32_t accelerate_steps = ceil((nominal_sq - initial_sq) * inverse_2a);
+  int32_t decelerate_steps = floor((nominal_sq - final_sq) * inverse_2a);
 
   // Calculate the size of Plateau of Nominal Rate.
   int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
 
   // Is the Plateau of Nominal Rate smaller than nothing? That means no cruising, and we will
-  // have to use intersection_distance() to calculate when to abort acceleration and start braking
-  // in order to reach the final_rate exactly at the end of this block.
+  // have to calculate when to abort acceleration and start braking in order to reach the
+  // final_rate exactly at the end of this block: (2as - u^2 + v^2) / 4a
   if (plateau_steps < 0) {
-    accelerate_steps = ceil(intersection_distance(initial_rate, final_rate, acceleration, block->step_event_count));
+    accelerate_steps = ceil(0.5 * (block->step_event_count + (final_sq - initial_sq) * inverse_2a));
     accelerate_steps = max(accelerate_steps, 0); // Check limits due to numerical round-off
     accelerate_steps = min((uint32_t)accelerate_steps, block->step_event_count);//(We can cast here to unsigned, because the above line ensures that we are above zero)
     plateau_steps = 0;
   }
 
+  uint8_t initial_loops;
+  unsigned short initial_interval = st_step_interval(initial_rate, initial_loops);
+
 #if ENABLED(ADVANCE)
   volatile long initial_advance = block->advance * entry_factor * entry_factor;
   volatile long final_advance = block->advance * exit_factor * exit_factor;
@@ -191,6 +195,8 @@ void calculate_trapezoid_for_block(block_t *block, float entry_factor, float exi
     block->decelerate_after = accelerate_steps+plateau_steps;
     block->initial_rate = initial_rate;
     block->final_rate = final_rate;
+    block->initial_interval = initial_interval;
+    block->initial_loops = initial_loops;
     #if ENABLED(ADVANCE)
       block->initial_advance = initial_advance;
       block->final_advance = final_advance;
@@ -241,19 +247,15 @@ void planner_reverse_pass_kernel(block_t *previous, block_t *current, block_t *n
 }
 
 // planner_recalculate() needs to go over the current plan twice. Once in reverse and once forward. This
-// implements the reverse pass.
+// implements the reverse pass, back to block_buffer_planned.
 void planner_reverse_pass() {
-  uint8_t block_index = block_buffer_head;
+  uint8_t block_index = block_buffer_head,
+          planned = block_buffer_planned;
 
-  //Make a local copy of block_buffer_tail, because the interrupt can alter it
-  CRITICAL_SECTION_START;
-    unsigned char tail = block_buffer_tail;
-  CRITICAL_SECTION_END
-
-  if (BLOCK_MOD(block_buffer_head - tail + BLOCK_BUFFER_SIZE) > 3) { // moves queued
+  if (BLOCK_MOD(block_buffer_head - planned + BLOCK_BUFFER_SIZE) > 3) { // moves queued
     block_index = BLOCK_MOD(block_buffer_head - 3);
     block_t *block[3] = { NULL, NULL, NULL };
-    while (block_index != tail) {
+    while (block_index != planned) {
       block_index = prev_block_index(block_index);
       block[2]= block[1];
       block[1]= block[0];
@@ -287,9 +289,9 @@ void planner_forward_pass_kernel(block_t *previous, block_t *current, block_t *n
 }
 
 // planner_recalculate() needs to go over the current plan twice. Once in reverse and once forward. This
-// implements the forward pass.
+// implements the forward pass, from block_buffer_planned.
 void planner_forward_pass() {
-  uint8_t block_index = block_buffer_tail;
+  uint8_t block_index = block_buffer_planned;
   block_t *block[3] = { NULL, NULL, NULL };
 
   while (block_index != block_buffer_head) {
@@ -302,11 +304,11 @@ void planner_forward_pass() {
   planner_forward_pass_kernel(block[1], block[2], NULL);
 }
 
-// Recalculates the trapezoid speed profiles for all blocks in the plan according to the
-// entry_factor for each junction. Must be called by planner_recalculate() after
+// Recalculates the trapezoid speed profiles for the blocks from block_buffer_planned according to
+// the entry_factor for each junction. Must be called by planner_recalculate() after
 // updating the blocks.
 void planner_recalculate_trapezoids() {
-  int8_t block_index = block_buffer_tail;
+  int8_t block_index = block_buffer_planned;
   block_t *current;
   block_t *next = NULL;
 
@@ -348,15 +350,33 @@ void planner_recalculate_trapezoids() {
 // the set limit. Finally it will:
 //
 //   3. Recalculate trapezoids for all blocks.
+//
+// A block at its maximum entry speed, after blocks that are all final, is final too: the reverse
+// pass skips it and the forward pass already left it. The passes run from the last such block,
+// block_buffer_planned, which gives the same plan as starting from the tail every time.
 
 void planner_recalculate() {
+  //Make a local copy of block_buffer_tail, because the interrupt can alter it
+  CRITICAL_SECTION_START;
+    unsigned char tail = block_buffer_tail;
+  CRITICAL_SECTION_END
+
+  // Start from the tail if the stepper has taken the last final block
+  if (BLOCK_MOD(block_buffer_planned - tail + BLOCK_BUFFER_SIZE) >= BLOCK_MOD(block_buffer_head - tail + BLOCK_BUFFER_SIZE))
+    block_buffer_planned = tail;
+
   planner_reverse_pass();
   planner_forward_pass();
   planner_recalculate_trapezoids();
+
+  for (uint8_t block_index = next_block_index(block_buffer_planned);
+       block_index != block_buffer_head && block_buffer[block_index].entry_speed == block_buffer[block_index].max_entry_speed;
+       block_index = next_block_index(block_index))
+    block_buffer_planned = block_index;
 }
 
 void plan_init() {
-  block_buffer_head = block_buffer_tail = 0;
+  block_buffer_head = block_buffer_tail = block_buffer_planned = 0;
   memset(position, 0, sizeof(position)); // clear position
   for (int i=0; i<NUM_AXIS; i++) previous_speed[i] = 0.0;
   previous_nominal_speed = 0.0;
@@ -490,6 +510,9 @@ float junction_deviation = 0.1;
   #if ENABLED(MESH_BED_LEVELING)
     if (mbl.active) z += mbl.get_z(x, y);
   #elif ENABLED(AUTO_BED_LEVELING_FEATURE)
+    #if ENABLED(LASER_MESH_LEVELING)
+      if (BedScan__MeshActive()) z += BedScan__MeshZ(x, y); else
+    #endif
     apply_rotation_xyz(plan_bed_level_matrix, x, y, z);
   #endif
 
@@ -566,6 +589,12 @@ float junction_deviation = 0.1;
   if (block->step_event_count <= dropsegments) return;
 
   block->fan_speed = fanSpeed;
+  #if ENABLED(PNEUMATICS)
+    block->solenoids = solenoid_state;
+  #endif
+  #if ENABLED(E_REGULATOR)
+    block->regulator_setpoint = regulator_setpoint;
+  #endif
   #if ENABLED(BARICUDA)
     block->valve_pressure = ValvePressure;
     block->e_to_p_pressure = EtoPPressure;
@@ -867,7 +896,8 @@ float junction_deviation = 0.1;
 
   block->acceleration_st = acc_st;
   block->acceleration = acc_st / steps_per_mm;
-  block->acceleration_rate = (long)(acc_st * 16777216.0 / (F_CPU / 8.0));
+  block->acceleration_rate = acc_st * 2;
+  block->nominal_interval = st_step_interval(block->nominal_rate, block->nominal_loops);
 
   #if 0  // Use old jerk for now
     // Compute path unit vector
@@ -996,6 +1026,13 @@ float junction_deviation = 0.1;
   vector_3 plan_get_position() {
     vector_3 position = vector_3(st_get_position_mm(X_AXIS), st_get_position_mm(Y_AXIS), st_get_position_mm(Z_AXIS));
 
+    #if ENABLED(LASER_MESH_LEVELING)
+      if (BedScan__MeshActive()) {
+        position.z -= BedScan__MeshZ(position.x, position.y);
+        return position;
+      }
+    #endif
+
     //position.debug("in plan_get position");
     //plan_bed_level_matrix.debug("in plan_get_position");
     matrix_3x3 inverse = matrix_3x3::transpose(plan_bed_level_matrix);
@@ -1016,6 +1053,9 @@ float junction_deviation = 0.1;
     #if ENABLED(MESH_BED_LEVELING)
       if (mbl.active) z += mbl.get_z(x, y);
     #elif ENABLED(AUTO_BED_LEVELING_FEATURE)
+      #if ENABLED(LASER_MESH_LEVELING)
+        if (BedScan__MeshActive()) z += BedScan__MeshZ(x, y); else
+      #endif
       apply_rotation_xyz(plan_bed_level_matrix, x, y, z);
     #endif
 
@@ -1039,3 +1079,15 @@ void reset_acceleration_rates() {
   for (int i = 0; i < NUM_AXIS; i++)
     axis_steps_per_sqr_second[i] = max_acceleration_units_per_sq_second[i] * axis_steps_per_unit[i];
 }
+
+#if ENABLED(E_REGULATOR)
+  // Highest regulator setpoint of the queued blocks and of the moves to come.
+  // Read from the main loop only; the stepper ISR moving the tail just drops
+  // a block from the scan.
+  float plan_max_regulator_setpoint() {
+    float psi = regulator_setpoint;
+    for (uint8_t i = block_buffer_tail; i != block_buffer_head; i = next_block_index(i))
+      NOLESS(psi, block_buffer[i].regulator_setpoint);
+    return psi;
+  }
+#endif
@@ -34,7 +34,7 @@ typedef struct {
   unsigned long step_event_count;           // The number of step events required to complete this block
   long accelerate_until;                    // The index of the step event on which to stop acceleration
   long decelerate_after;                    // The index of the step event on which to start decelerating
-  long acceleration_rate;                   // The acceleration rate used for acceleration calculation
+  unsigned long acceleration_rate;          // Change of the step rate squared per step event (2 * acceleration_st)
   unsigned char direction_bits;             // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
   unsigned char active_extruder;            // Selects the active extruder
   #if ENABLED(ADVANCE)
@@ -59,7 +59,16 @@ typedef struct {
   unsigned long initial_rate;                        // The jerk-adjusted step rate at start of block  
   unsigned long final_rate;                          // The minimal rate at exit
   unsigned long acceleration_st;                     // acceleration steps/sec^2
+  unsigned short initial_interval;                   // Timer1 ticks between step interrupts at initial_rate
+  unsigned short nominal_interval;                   // and at nominal_rate
+  uint8_t initial_loops, nominal_loops;              // Step events per interrupt at those rates
   unsigned long fan_speed;
+  #if ENABLED(PNEUMATICS)
+    unsigned char solenoids;                         // Solenoids open during this block, bit per tool
+  #endif
+  #if ENABLED(E_REGULATOR)
+    float regulator_setpoint;                        // Regulator pressure during this block (psi)
+  #endif
   #if ENABLED(BARICUDA)
     unsigned long valve_pressure;
     unsigned long e_to_p_pressure;
@@ -143,6 +152,7 @@ extern unsigned long axis_steps_per_sqr_second[NUM_AXIS];
 extern block_t block_buffer[BLOCK_BUFFER_SIZE];            // A ring buffer for motion instructions
 extern volatile unsigned char block_buffer_head;           // Index of the next block to be pushed
 extern volatile unsigned char block_buffer_tail; 
+extern unsigned char block_buffer_planned;                 // Index of the last block whose entry speed is final
 
 // Returns true if the buffer has a queued block, false otherwise
 FORCE_INLINE bool blocks_queued() { return (block_buffer_head != block_buffer_tail); }
@@ -167,4 +177,9 @@ FORCE_INLINE block_t *plan_get_current_block() {
 
 void reset_acceleration_rates();
 
+#if ENABLED(E_REGULATOR)
+  // Highest regulator setpoint of the queued blocks and of the moves to come
+  float plan_max_regulator_setpoint();
+#endif
+
 #endif // PLANNER_H
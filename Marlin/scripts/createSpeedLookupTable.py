@@ -1,50 +1,66 @@
-#!/usr/bin/env python
+#!/usr/bin/env python3
 
-""" Generate the stepper delay lookup table for Marlin firmware. """
+""" Generate the stepper delay lookup table for Marlin firmware.
+
+The table maps the step rate squared to Timer1 ticks per step, as calc_timer()
+in stepper.cpp reads it. Print it to Marlin/speed_lookuptable.h:
+
+  python3 createSpeedLookupTable.py > ../speed_lookuptable.h
+"""
 
 import argparse
+import math
 
 __author__ = "Ben Gamari <bgamari@gmail.com>"
 __copyright__ = "Copyright 2012, Ben Gamari"
 __license__ = "GPL"
 
-parser = argparse.ArgumentParser(description=__doc__)
-parser.add_argument('-f', '--cpu-freq', type=int, default=16, help='CPU clockrate in MHz (default=16)')
+parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+parser.add_argument('-f', '--cpu-freq', type=int, nargs='+', default=[16, 20],
+                    help='CPU clockrates in MHz, one table each (default=16 20)')
 parser.add_argument('-d', '--divider', type=int, default=8, help='Timer/counter pre-scale divider (default=8)')
 args = parser.parse_args()
 
-cpu_freq = args.cpu_freq * 1000000
-timer_freq = cpu_freq / args.divider
-
-print "#ifndef SPEED_LOOKUPTABLE_H"
-print "#define SPEED_LOOKUPTABLE_H"
-print
-print '#include "Marlin.h"'
-print
-
-print "const uint16_t speed_lookuptable_fast[256][2] PROGMEM = {"
-a = [ timer_freq / ((i*256)+(args.cpu_freq*2)) for i in range(256) ]
-b = [ a[i] - a[i+1] for i in range(255) ]
-b.append(b[-1])
-for i in range(32):
-    print "  ",
-    for j in range(8):
-        print "{%d, %d}," % (a[8*i+j], b[8*i+j]),
-    print 
-print "};"
-print
-
-print "const uint16_t speed_lookuptable_slow[256][2] PROGMEM = {"
-a = [ timer_freq / ((i*8)+(args.cpu_freq*2)) for i in range(256) ]
-b = [ a[i] - a[i+1] for i in range(255) ]
-b.append(b[-1])
-for i in range(32):
-    print "  ",
-    for j in range(8):
-        print "{%d, %d}," % (a[8*i+j], b[8*i+j]),
-    print 
-print "};"
-print
-
-print "#endif"
+# calc_timer() scales the rate squared into [2^13, 2^14), counting octaves up
+# from 2^10, then picks one of 32 rows by the top bits and interpolates on the
+# low byte. 2^10 is about the 32 steps/s Timer1 can still time at 16MHz.
+OCTAVES = 17
+ROWS = 32
+ROW_STEP = 32
+FIRST = ROWS * ROW_STEP  # 2^10
+
+# Nearest tick, halves to even as Python 3 round() does. Rows below the
+# slowest rate calc_timer() allows at this clock are never read, and are only
+# held to what fits the 16 bit timer.
+def ticks(timer_freq, rate_sq):
+    return min(int(round(timer_freq / math.sqrt(rate_sq))), 0xFFFF)
+
+print("#ifndef SPEED_LOOKUPTABLE_H")
+print("#define SPEED_LOOKUPTABLE_H")
+print()
+print('#include "Marlin.h"')
+print()
+print("// Timer1 ticks between step interrupts by step rate squared (s), for calc_timer()")
+print("// in stepper.cpp. The rates run from 2^10 to 2^%d in %d octaves of %d rows:" % (10 + OCTAVES, OCTAVES, ROWS))
+print("// row %d * o + k starts at s = (%d + %d * k) << o and holds" % (ROWS, FIRST, ROW_STEP))
+print("//   { F_CPU / %d / sqrt(s), that minus the same at the start of the next row }" % args.divider)
+print("// each rounded to the nearest tick, and held to 65535 where it would overflow.")
+print()
+
+for n, mhz in enumerate(args.cpu_freq):
+    timer_freq = mhz * 1000000.0 / args.divider
+    starts = [(FIRST + ROW_STEP * k) << o for o in range(OCTAVES) for k in range(ROWS)]
+    starts.append(FIRST << OCTAVES)
+    a = [ticks(timer_freq, s) for s in starts]
+
+    print("#%s F_CPU == %d" % ("if" if n == 0 else "elif", mhz * 1000000))
+    print()
+    print("const uint16_t speed_lookuptable_sq[%d][2] PROGMEM = {" % (OCTAVES * ROWS))
+    for i in range(0, OCTAVES * ROWS, 8):
+        print(" ".join("{ %d, %d}," % (a[j], a[j] - a[j + 1]) for j in range(i, i + 8)))
+    print("};")
+    print()
 
+print("#endif")
+print()
+print("#endif")
@@ -0,0 +1,96 @@
+#!/usr/bin/python
+"""Thermistor Slope Table Generator
+
+Reads the temperature tables of thermistortables.h and writes
+thermistorslopes.h, which holds for every table the slope of each segment,
+so that analog2temp() can convert with a multiply-add instead of a divide.
+
+The slopes are written as expressions of the table entries themselves, so
+the compiler folds them with the same OVERSAMPLENR and PtLine() values the
+tables get. Run it again whenever a table in thermistortables.h changes.
+
+Usage: python createThermistorSlopes.py [thermistortables.h [thermistorslopes.h]]
+"""
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+TABLE_START = re.compile(r'^const short temptable_(\w+)\[\]\[2\] PROGMEM = \{')
+ENTRY = re.compile(r'PtLine\(([^()]*)\)|\{([^{}]*)\}')
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+def parse_entries(body):
+    """Returns (raw expression, value expression) pairs of a table body"""
+    entries = []
+    for m in ENTRY.finditer(strip_comments(body)):
+        if m.group(1) is not None:
+            t, r0, rup = [a.strip() for a in m.group(1).split(',')]
+            entries.append(('PtAdVal(%s,%s,%s)*OVERSAMPLENR' % (t, r0, rup), t))
+        else:
+            raw, value = [a.strip() for a in m.group(2).split(',')]
+            entries.append((re.sub(r'\s+', '', raw), value))
+    return entries
+
+def parse_tables(lines):
+    """Returns (name, #if line, entries) of each temperature table"""
+    tables = []
+    conditions = []
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        if line.startswith('#if'):
+            conditions.append(line.rstrip())
+        elif line.startswith('#endif'):
+            conditions.pop()
+        m = TABLE_START.match(line)
+        if m:
+            body = []
+            i += 1
+            while not lines[i].strip().startswith('};'):
+                body.append(lines[i])
+                i += 1
+            # conditions[0] is the include guard
+            tables.append((m.group(1), conditions[1], parse_entries(''.join(body))))
+        i += 1
+    return tables
+
+def write_slopes(tables, out):
+    out.write('/**\n')
+    out.write(' * thermistorslopes.h - Segment slopes of the tables in thermistortables.h\n')
+    out.write(' *\n')
+    out.write(' * Generated by scripts/createThermistorSlopes.py. Do not edit; run the\n')
+    out.write(' * script again when a table changes. Entry i holds the slope from entry i\n')
+    out.write(' * to entry i + 1 of the table, in degrees per raw count; the last one is 0\n')
+    out.write(' * as the value is held from the last entry on.\n')
+    out.write(' */\n\n')
+    out.write('#ifndef THERMISTORSLOPES_H_\n')
+    out.write('#define THERMISTORSLOPES_H_\n\n')
+    out.write('// Equal raw values never get picked as a segment, so their slope is 0\n')
+    out.write('#define TSLOPE(x0, y0, x1, y1) ((short)(x1) == (short)(x0) ? 0.0 : \\\n')
+    out.write('  (float)((y1) - (y0)) / (float)((short)(x1) - (short)(x0)))\n\n')
+    for name, condition, entries in tables:
+        out.write('%s\n' % condition)
+        out.write('const float tempslope_%s[] PROGMEM = {\n' % name)
+        for (x0, y0), (x1, y1) in zip(entries, entries[1:]):
+            out.write('  TSLOPE(%s, %s, %s, %s),\n' % (x0, y0, x1, y1))
+        out.write('  0\n')
+        out.write('};\n')
+        out.write('#endif\n\n')
+    out.write('#endif // THERMISTORSLOPES_H_\n')
+
+def main(argv):
+    source = argv[1] if len(argv) > 1 else os.path.join(HERE, '..', 'thermistortables.h')
+    target = argv[2] if len(argv) > 2 else os.path.join(HERE, '..', 'thermistorslopes.h')
+    with open(source) as f:
+        tables = parse_tables(f.readlines())
+    with open(target, 'w') as f:
+        write_slopes(tables, f)
+
+if __name__ == '__main__':
+    main(sys.argv)
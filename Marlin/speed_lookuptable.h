@@ -3,148 +3,156 @@
 
 #include "Marlin.h"
 
-#if F_CPU == 16000000
+// Timer1 ticks between step interrupts by step rate squared (s), for calc_timer()
+// in stepper.cpp. The rates run from 2^10 to 2^27 in 17 octaves of 32 rows:
+// row 32 * o + k starts at s = (1024 + 32 * k) << o and holds
+//   { F_CPU / 8 / sqrt(s), that minus the same at the start of the next row }
+// each rounded to the nearest tick, and held to 65535 where it would overflow.
 
-const uint16_t speed_lookuptable_fast[256][2] PROGMEM = {\
-{ 62500, 55556}, { 6944, 3268}, { 3676, 1176}, { 2500, 607}, { 1893, 369}, { 1524, 249}, { 1275, 179}, { 1096, 135}, 
-{ 961, 105}, { 856, 85}, { 771, 69}, { 702, 58}, { 644, 49}, { 595, 42}, { 553, 37}, { 516, 32}, 
-{ 484, 28}, { 456, 25}, { 431, 23}, { 408, 20}, { 388, 19}, { 369, 16}, { 353, 16}, { 337, 14}, 
-{ 323, 13}, { 310, 11}, { 299, 11}, { 288, 11}, { 277, 9}, { 268, 9}, { 259, 8}, { 251, 8}, 
-{ 243, 8}, { 235, 7}, { 228, 6}, { 222, 6}, { 216, 6}, { 210, 6}, { 204, 5}, { 199, 5}, 
-{ 194, 5}, { 189, 4}, { 185, 4}, { 181, 4}, { 177, 4}, { 173, 4}, { 169, 4}, { 165, 3}, 
-{ 162, 3}, { 159, 4}, { 155, 3}, { 152, 3}, { 149, 2}, { 147, 3}, { 144, 3}, { 141, 2}, 
-{ 139, 3}, { 136, 2}, { 134, 2}, { 132, 3}, { 129, 2}, { 127, 2}, { 125, 2}, { 123, 2}, 
-{ 121, 2}, { 119, 1}, { 118, 2}, { 116, 2}, { 114, 1}, { 113, 2}, { 111, 2}, { 109, 1}, 
-{ 108, 2}, { 106, 1}, { 105, 2}, { 103, 1}, { 102, 1}, { 101, 1}, { 100, 2}, { 98, 1}, 
-{ 97, 1}, { 96, 1}, { 95, 2}, { 93, 1}, { 92, 1}, { 91, 1}, { 90, 1}, { 89, 1}, 
-{ 88, 1}, { 87, 1}, { 86, 1}, { 85, 1}, { 84, 1}, { 83, 0}, { 83, 1}, { 82, 1}, 
-{ 81, 1}, { 80, 1}, { 79, 1}, { 78, 0}, { 78, 1}, { 77, 1}, { 76, 1}, { 75, 0}, 
-{ 75, 1}, { 74, 1}, { 73, 1}, { 72, 0}, { 72, 1}, { 71, 1}, { 70, 0}, { 70, 1}, 
-{ 69, 0}, { 69, 1}, { 68, 1}, { 67, 0}, { 67, 1}, { 66, 0}, { 66, 1}, { 65, 0}, 
-{ 65, 1}, { 64, 1}, { 63, 0}, { 63, 1}, { 62, 0}, { 62, 1}, { 61, 0}, { 61, 1}, 
-{ 60, 0}, { 60, 0}, { 60, 1}, { 59, 0}, { 59, 1}, { 58, 0}, { 58, 1}, { 57, 0}, 
-{ 57, 1}, { 56, 0}, { 56, 0}, { 56, 1}, { 55, 0}, { 55, 1}, { 54, 0}, { 54, 0}, 
-{ 54, 1}, { 53, 0}, { 53, 0}, { 53, 1}, { 52, 0}, { 52, 0}, { 52, 1}, { 51, 0}, 
-{ 51, 0}, { 51, 1}, { 50, 0}, { 50, 0}, { 50, 1}, { 49, 0}, { 49, 0}, { 49, 1}, 
-{ 48, 0}, { 48, 0}, { 48, 1}, { 47, 0}, { 47, 0}, { 47, 0}, { 47, 1}, { 46, 0}, 
-{ 46, 0}, { 46, 1}, { 45, 0}, { 45, 0}, { 45, 0}, { 45, 1}, { 44, 0}, { 44, 0}, 
-{ 44, 0}, { 44, 1}, { 43, 0}, { 43, 0}, { 43, 0}, { 43, 1}, { 42, 0}, { 42, 0}, 
-{ 42, 0}, { 42, 1}, { 41, 0}, { 41, 0}, { 41, 0}, { 41, 0}, { 41, 1}, { 40, 0}, 
-{ 40, 0}, { 40, 0}, { 40, 0}, { 40, 1}, { 39, 0}, { 39, 0}, { 39, 0}, { 39, 0}, 
-{ 39, 1}, { 38, 0}, { 38, 0}, { 38, 0}, { 38, 0}, { 38, 1}, { 37, 0}, { 37, 0}, 
-{ 37, 0}, { 37, 0}, { 37, 0}, { 37, 1}, { 36, 0}, { 36, 0}, { 36, 0}, { 36, 0}, 
-{ 36, 1}, { 35, 0}, { 35, 0}, { 35, 0}, { 35, 0}, { 35, 0}, { 35, 0}, { 35, 1}, 
-{ 34, 0}, { 34, 0}, { 34, 0}, { 34, 0}, { 34, 0}, { 34, 1}, { 33, 0}, { 33, 0}, 
-{ 33, 0}, { 33, 0}, { 33, 0}, { 33, 0}, { 33, 1}, { 32, 0}, { 32, 0}, { 32, 0}, 
-{ 32, 0}, { 32, 0}, { 32, 0}, { 32, 0}, { 32, 1}, { 31, 0}, { 31, 0}, { 31, 0}, 
-{ 31, 0}, { 31, 0}, { 31, 0}, { 31, 1}, { 30, 0}, { 30, 0}, { 30, 0}, { 30, 0}
-};
+#if F_CPU == 16000000
 
-const uint16_t speed_lookuptable_slow[256][2] PROGMEM = {\
-{ 62500, 12500}, { 50000, 8334}, { 41666, 5952}, { 35714, 4464}, { 31250, 3473}, { 27777, 2777}, { 25000, 2273}, { 22727, 1894}, 
-{ 20833, 1603}, { 19230, 1373}, { 17857, 1191}, { 16666, 1041}, { 15625, 920}, { 14705, 817}, { 13888, 731}, { 13157, 657}, 
-{ 12500, 596}, { 11904, 541}, { 11363, 494}, { 10869, 453}, { 10416, 416}, { 10000, 385}, { 9615, 356}, { 9259, 331}, 
-{ 8928, 308}, { 8620, 287}, { 8333, 269}, { 8064, 252}, { 7812, 237}, { 7575, 223}, { 7352, 210}, { 7142, 198}, 
-{ 6944, 188}, { 6756, 178}, { 6578, 168}, { 6410, 160}, { 6250, 153}, { 6097, 145}, { 5952, 139}, { 5813, 132}, 
-{ 5681, 126}, { 5555, 121}, { 5434, 115}, { 5319, 111}, { 5208, 106}, { 5102, 102}, { 5000, 99}, { 4901, 94}, 
-{ 4807, 91}, { 4716, 87}, { 4629, 84}, { 4545, 81}, { 4464, 79}, { 4385, 75}, { 4310, 73}, { 4237, 71}, 
-{ 4166, 68}, { 4098, 66}, { 4032, 64}, { 3968, 62}, { 3906, 60}, { 3846, 59}, { 3787, 56}, { 3731, 55}, 
-{ 3676, 53}, { 3623, 52}, { 3571, 50}, { 3521, 49}, { 3472, 48}, { 3424, 46}, { 3378, 45}, { 3333, 44}, 
-{ 3289, 43}, { 3246, 41}, { 3205, 41}, { 3164, 39}, { 3125, 39}, { 3086, 38}, { 3048, 36}, { 3012, 36}, 
-{ 2976, 35}, { 2941, 35}, { 2906, 33}, { 2873, 33}, { 2840, 32}, { 2808, 31}, { 2777, 30}, { 2747, 30}, 
-{ 2717, 29}, { 2688, 29}, { 2659, 28}, { 2631, 27}, { 2604, 27}, { 2577, 26}, { 2551, 26}, { 2525, 25}, 
-{ 2500, 25}, { 2475, 25}, { 2450, 23}, { 2427, 24}, { 2403, 23}, { 2380, 22}, { 2358, 22}, { 2336, 22}, 
-{ 2314, 21}, { 2293, 21}, { 2272, 20}, { 2252, 20}, { 2232, 20}, { 2212, 20}, { 2192, 19}, { 2173, 18}, 
-{ 2155, 19}, { 2136, 18}, { 2118, 18}, { 2100, 17}, { 2083, 17}, { 2066, 17}, { 2049, 17}, { 2032, 16}, 
-{ 2016, 16}, { 2000, 16}, { 1984, 16}, { 1968, 15}, { 1953, 16}, { 1937, 14}, { 1923, 15}, { 1908, 15}, 
-{ 1893, 14}, { 1879, 14}, { 1865, 14}, { 1851, 13}, { 1838, 14}, { 1824, 13}, { 1811, 13}, { 1798, 13}, 
-{ 1785, 12}, { 1773, 13}, { 1760, 12}, { 1748, 12}, { 1736, 12}, { 1724, 12}, { 1712, 12}, { 1700, 11}, 
-{ 1689, 12}, { 1677, 11}, { 1666, 11}, { 1655, 11}, { 1644, 11}, { 1633, 10}, { 1623, 11}, { 1612, 10}, 
-{ 1602, 10}, { 1592, 10}, { 1582, 10}, { 1572, 10}, { 1562, 10}, { 1552, 9}, { 1543, 10}, { 1533, 9}, 
-{ 1524, 9}, { 1515, 9}, { 1506, 9}, { 1497, 9}, { 1488, 9}, { 1479, 9}, { 1470, 9}, { 1461, 8}, 
-{ 1453, 8}, { 1445, 9}, { 1436, 8}, { 1428, 8}, { 1420, 8}, { 1412, 8}, { 1404, 8}, { 1396, 8}, 
-{ 1388, 7}, { 1381, 8}, { 1373, 7}, { 1366, 8}, { 1358, 7}, { 1351, 7}, { 1344, 8}, { 1336, 7}, 
-{ 1329, 7}, { 1322, 7}, { 1315, 7}, { 1308, 6}, { 1302, 7}, { 1295, 7}, { 1288, 6}, { 1282, 7}, 
-{ 1275, 6}, { 1269, 7}, { 1262, 6}, { 1256, 6}, { 1250, 7}, { 1243, 6}, { 1237, 6}, { 1231, 6}, 
-{ 1225, 6}, { 1219, 6}, { 1213, 6}, { 1207, 6}, { 1201, 5}, { 1196, 6}, { 1190, 6}, { 1184, 5}, 
-{ 1179, 6}, { 1173, 5}, { 1168, 6}, { 1162, 5}, { 1157, 5}, { 1152, 6}, { 1146, 5}, { 1141, 5}, 
-{ 1136, 5}, { 1131, 5}, { 1126, 5}, { 1121, 5}, { 1116, 5}, { 1111, 5}, { 1106, 5}, { 1101, 5}, 
-{ 1096, 5}, { 1091, 5}, { 1086, 4}, { 1082, 5}, { 1077, 5}, { 1072, 4}, { 1068, 5}, { 1063, 4}, 
-{ 1059, 5}, { 1054, 4}, { 1050, 4}, { 1046, 5}, { 1041, 4}, { 1037, 4}, { 1033, 5}, { 1028, 4}, 
-{ 1024, 4}, { 1020, 4}, { 1016, 4}, { 1012, 4}, { 1008, 4}, { 1004, 4}, { 1000, 4}, { 996, 4}, 
-{ 992, 4}, { 988, 4}, { 984, 4}, { 980, 4}, { 976, 4}, { 972, 4}, { 968, 3}, { 965, 3}
+const uint16_t speed_lookuptable_sq[544][2] PROGMEM = {
+{ 62500, 954}, { 61546, 912}, { 60634, 873}, { 59761, 835}, { 58926, 802}, { 58124, 770}, { 57354, 740}, { 56614, 712},
+{ 55902, 686}, { 55216, 662}, { 54554, 638}, { 53916, 616}, { 53300, 595}, { 52705, 576}, { 52129, 558}, { 51571, 540},
+{ 51031, 523}, { 50508, 508}, { 50000, 493}, { 49507, 478}, { 49029, 465}, { 48564, 451}, { 48113, 440}, { 47673, 427},
+{ 47246, 417}, { 46829, 405}, { 46424, 395}, { 46029, 385}, { 45644, 376}, { 45268, 367}, { 44901, 357}, { 44544, 350},
+{ 44194, 675}, { 43519, 644}, { 42875, 617}, { 42258, 591}, { 41667, 567}, { 41100, 545}, { 40555, 523}, { 40032, 504},
+{ 39528, 485}, { 39043, 467}, { 38576, 451}, { 38125, 436}, { 37689, 421}, { 37268, 408}, { 36860, 394}, { 36466, 382},
+{ 36084, 370}, { 35714, 359}, { 35355, 348}, { 35007, 338}, { 34669, 329}, { 34340, 319}, { 34021, 311}, { 33710, 302},
+{ 33408, 295}, { 33113, 286}, { 32827, 280}, { 32547, 272}, { 32275, 266}, { 32009, 259}, { 31750, 253}, { 31497, 247},
+{ 31250, 477}, { 30773, 456}, { 30317, 436}, { 29881, 418}, { 29463, 401}, { 29062, 385}, { 28677, 370}, { 28307, 356},
+{ 27951, 343}, { 27608, 331}, { 27277, 319}, { 26958, 308}, { 26650, 298}, { 26352, 288}, { 26064, 278}, { 25786, 270},
+{ 25516, 262}, { 25254, 254}, { 25000, 246}, { 24754, 239}, { 24515, 233}, { 24282, 226}, { 24056, 219}, { 23837, 214},
+{ 23623, 208}, { 23415, 203}, { 23212, 198}, { 23014, 192}, { 22822, 188}, { 22634, 183}, { 22451, 179}, { 22272, 175},
+{ 22097, 337}, { 21760, 323}, { 21437, 308}, { 21129, 296}, { 20833, 283}, { 20550, 272}, { 20278, 262}, { 20016, 252},
+{ 19764, 242}, { 19522, 234}, { 19288, 226}, { 19062, 218}, { 18844, 210}, { 18634, 204}, { 18430, 197}, { 18233, 191},
+{ 18042, 185}, { 17857, 179}, { 17678, 174}, { 17504, 170}, { 17334, 164}, { 17170, 160}, { 17010, 155}, { 16855, 151},
+{ 16704, 147}, { 16557, 144}, { 16413, 139}, { 16274, 137}, { 16137, 132}, { 16005, 130}, { 15875, 126}, { 15749, 124},
+{ 15625, 239}, { 15386, 228}, { 15158, 218}, { 14940, 209}, { 14731, 200}, { 14531, 193}, { 14338, 185}, { 14153, 178},
+{ 13975, 171}, { 13804, 165}, { 13639, 160}, { 13479, 154}, { 13325, 149}, { 13176, 144}, { 13032, 139}, { 12893, 135},
+{ 12758, 131}, { 12627, 127}, { 12500, 123}, { 12377, 120}, { 12257, 116}, { 12141, 113}, { 12028, 110}, { 11918, 107},
+{ 11811, 104}, { 11707, 101}, { 11606, 99}, { 11507, 96}, { 11411, 94}, { 11317, 92}, { 11225, 89}, { 11136, 87},
+{ 11049, 169}, { 10880, 161}, { 10719, 155}, { 10564, 147}, { 10417, 142}, { 10275, 136}, { 10139, 131}, { 10008, 126},
+{ 9882, 121}, { 9761, 117}, { 9644, 113}, { 9531, 109}, { 9422, 105}, { 9317, 102}, { 9215, 98}, { 9117, 96},
+{ 9021, 92}, { 8929, 90}, { 8839, 87}, { 8752, 85}, { 8667, 82}, { 8585, 80}, { 8505, 78}, { 8427, 75},
+{ 8352, 74}, { 8278, 71}, { 8207, 70}, { 8137, 68}, { 8069, 67}, { 8002, 64}, { 7938, 64}, { 7874, 62},
+{ 7812, 119}, { 7693, 114}, { 7579, 109}, { 7470, 104}, { 7366, 101}, { 7265, 96}, { 7169, 92}, { 7077, 89},
+{ 6988, 86}, { 6902, 83}, { 6819, 79}, { 6740, 77}, { 6663, 75}, { 6588, 72}, { 6516, 70}, { 6446, 67},
+{ 6379, 66}, { 6313, 63}, { 6250, 62}, { 6188, 59}, { 6129, 58}, { 6071, 57}, { 6014, 55}, { 5959, 53},
+{ 5906, 52}, { 5854, 51}, { 5803, 49}, { 5754, 49}, { 5705, 47}, { 5658, 45}, { 5613, 45}, { 5568, 44},
+{ 5524, 84}, { 5440, 81}, { 5359, 77}, { 5282, 74}, { 5208, 71}, { 5137, 68}, { 5069, 65}, { 5004, 63},
+{ 4941, 61}, { 4880, 58}, { 4822, 56}, { 4766, 55}, { 4711, 53}, { 4658, 50}, { 4608, 50}, { 4558, 47},
+{ 4511, 47}, { 4464, 45}, { 4419, 43}, { 4376, 42}, { 4334, 41}, { 4293, 40}, { 4253, 39}, { 4214, 38},
+{ 4176, 37}, { 4139, 36}, { 4103, 35}, { 4068, 34}, { 4034, 33}, { 4001, 32}, { 3969, 32}, { 3937, 31},
+{ 3906, 59}, { 3847, 57}, { 3790, 55}, { 3735, 52}, { 3683, 50}, { 3633, 48}, { 3585, 47}, { 3538, 44},
+{ 3494, 43}, { 3451, 41}, { 3410, 40}, { 3370, 39}, { 3331, 37}, { 3294, 36}, { 3258, 35}, { 3223, 34},
+{ 3189, 32}, { 3157, 32}, { 3125, 31}, { 3094, 30}, { 3064, 29}, { 3035, 28}, { 3007, 27}, { 2980, 27},
+{ 2953, 26}, { 2927, 26}, { 2901, 24}, { 2877, 24}, { 2853, 24}, { 2829, 23}, { 2806, 22}, { 2784, 22},
+{ 2762, 42}, { 2720, 40}, { 2680, 39}, { 2641, 37}, { 2604, 35}, { 2569, 34}, { 2535, 33}, { 2502, 31},
+{ 2471, 31}, { 2440, 29}, { 2411, 28}, { 2383, 27}, { 2356, 27}, { 2329, 25}, { 2304, 25}, { 2279, 24},
+{ 2255, 23}, { 2232, 22}, { 2210, 22}, { 2188, 21}, { 2167, 21}, { 2146, 20}, { 2126, 19}, { 2107, 19},
+{ 2088, 18}, { 2070, 18}, { 2052, 18}, { 2034, 17}, { 2017, 16}, { 2001, 17}, { 1984, 15}, { 1969, 16},
+{ 1953, 30}, { 1923, 28}, { 1895, 27}, { 1868, 27}, { 1841, 25}, { 1816, 24}, { 1792, 23}, { 1769, 22},
+{ 1747, 22}, { 1725, 20}, { 1705, 20}, { 1685, 19}, { 1666, 19}, { 1647, 18}, { 1629, 17}, { 1612, 17},
+{ 1595, 17}, { 1578, 16}, { 1562, 15}, { 1547, 15}, { 1532, 14}, { 1518, 14}, { 1504, 14}, { 1490, 14},
+{ 1476, 13}, { 1463, 12}, { 1451, 13}, { 1438, 12}, { 1426, 11}, { 1415, 12}, { 1403, 11}, { 1392, 11},
+{ 1381, 21}, { 1360, 20}, { 1340, 19}, { 1321, 19}, { 1302, 18}, { 1284, 17}, { 1267, 16}, { 1251, 16},
+{ 1235, 15}, { 1220, 15}, { 1205, 14}, { 1191, 13}, { 1178, 13}, { 1165, 13}, { 1152, 12}, { 1140, 12},
+{ 1128, 12}, { 1116, 11}, { 1105, 11}, { 1094, 11}, { 1083, 10}, { 1073, 10}, { 1063, 10}, { 1053, 9},
+{ 1044, 9}, { 1035, 9}, { 1026, 9}, { 1017, 8}, { 1009, 9}, { 1000, 8}, { 992, 8}, { 984, 7},
+{ 977, 15}, { 962, 15}, { 947, 13}, { 934, 13}, { 921, 13}, { 908, 12}, { 896, 11}, { 885, 12},
+{ 873, 10}, { 863, 11}, { 852, 10}, { 842, 9}, { 833, 9}, { 824, 9}, { 815, 9}, { 806, 9},
+{ 797, 8}, { 789, 8}, { 781, 7}, { 774, 8}, { 766, 7}, { 759, 7}, { 752, 7}, { 745, 7},
+{ 738, 6}, { 732, 7}, { 725, 6}, { 719, 6}, { 713, 6}, { 707, 5}, { 702, 6}, { 696, 5},
+{ 691, 11}, { 680, 10}, { 670, 10}, { 660, 9}, { 651, 9}, { 642, 8}, { 634, 8}, { 626, 8},
+{ 618, 8}, { 610, 7}, { 603, 7}, { 596, 7}, { 589, 7}, { 582, 6}, { 576, 6}, { 570, 6},
+{ 564, 6}, { 558, 6}, { 552, 5}, { 547, 5}, { 542, 5}, { 537, 5}, { 532, 5}, { 527, 5},
+{ 522, 5}, { 517, 4}, { 513, 4}, { 509, 5}, { 504, 4}, { 500, 4}, { 496, 4}, { 492, 4},
+{ 488, 7}, { 481, 7}, { 474, 7}, { 467, 7}, { 460, 6}, { 454, 6}, { 448, 6}, { 442, 5},
+{ 437, 6}, { 431, 5}, { 426, 5}, { 421, 5}, { 416, 4}, { 412, 5}, { 407, 4}, { 403, 4},
+{ 399, 4}, { 395, 4}, { 391, 4}, { 387, 4}, { 383, 4}, { 379, 3}, { 376, 4}, { 372, 3},
+{ 369, 3}, { 366, 3}, { 363, 3}, { 360, 3}, { 357, 3}, { 354, 3}, { 351, 3}, { 348, 3},
+{ 345, 5}, { 340, 5}, { 335, 5}, { 330, 4}, { 326, 5}, { 321, 4}, { 317, 4}, { 313, 4},
+{ 309, 4}, { 305, 4}, { 301, 3}, { 298, 4}, { 294, 3}, { 291, 3}, { 288, 3}, { 285, 3},
+{ 282, 3}, { 279, 3}, { 276, 3}, { 273, 2}, { 271, 3}, { 268, 2}, { 266, 3}, { 263, 2},
+{ 261, 2}, { 259, 3}, { 256, 2}, { 254, 2}, { 252, 2}, { 250, 2}, { 248, 2}, { 246, 2},
+{ 244, 4}, { 240, 3}, { 237, 4}, { 233, 3}, { 230, 3}, { 227, 3}, { 224, 3}, { 221, 3},
+{ 218, 2}, { 216, 3}, { 213, 2}, { 211, 3}, { 208, 2}, { 206, 2}, { 204, 3}, { 201, 2},
+{ 199, 2}, { 197, 2}, { 195, 2}, { 193, 1}, { 192, 2}, { 190, 2}, { 188, 2}, { 186, 1},
+{ 185, 2}, { 183, 2}, { 181, 1}, { 180, 2}, { 178, 1}, { 177, 2}, { 175, 1}, { 174, 1},
 };
 
 #elif F_CPU == 20000000
 
-const uint16_t speed_lookuptable_fast[256][2] PROGMEM = {
-   {62500, 54055}, {8445, 3917}, {4528, 1434}, {3094, 745}, {2349, 456}, {1893, 307}, {1586, 222}, {1364, 167},
-   {1197, 131}, {1066, 105}, {961, 86}, {875, 72}, {803, 61}, {742, 53}, {689, 45}, {644, 40},
-   {604, 35}, {569, 32}, {537, 28}, {509, 25}, {484, 23}, {461, 21}, {440, 19}, {421, 17},
-   {404, 16}, {388, 15}, {373, 14}, {359, 13}, {346, 12}, {334, 11}, {323, 10}, {313, 10},
-   {303, 9}, {294, 9}, {285, 8}, {277, 7}, {270, 8}, {262, 7}, {255, 6}, {249, 6},
-   {243, 6}, {237, 6}, {231, 5}, {226, 5}, {221, 5}, {216, 5}, {211, 4}, {207, 5},
-   {202, 4}, {198, 4}, {194, 4}, {190, 3}, {187, 4}, {183, 3}, {180, 3}, {177, 4},
-   {173, 3}, {170, 3}, {167, 2}, {165, 3}, {162, 3}, {159, 2}, {157, 3}, {154, 2},
-   {152, 3}, {149, 2}, {147, 2}, {145, 2}, {143, 2}, {141, 2}, {139, 2}, {137, 2},
-   {135, 2}, {133, 2}, {131, 2}, {129, 1}, {128, 2}, {126, 2}, {124, 1}, {123, 2},
-   {121, 1}, {120, 2}, {118, 1}, {117, 1}, {116, 2}, {114, 1}, {113, 1}, {112, 2},
-   {110, 1}, {109, 1}, {108, 1}, {107, 2}, {105, 1}, {104, 1}, {103, 1}, {102, 1},
-   {101, 1}, {100, 1}, {99, 1}, {98, 1}, {97, 1}, {96, 1}, {95, 1}, {94, 1},
-   {93, 1}, {92, 1}, {91, 0}, {91, 1}, {90, 1}, {89, 1}, {88, 1}, {87, 0},
-   {87, 1}, {86, 1}, {85, 1}, {84, 0}, {84, 1}, {83, 1}, {82, 1}, {81, 0},
-   {81, 1}, {80, 1}, {79, 0}, {79, 1}, {78, 0}, {78, 1}, {77, 1}, {76, 0},
-   {76, 1}, {75, 0}, {75, 1}, {74, 1}, {73, 0}, {73, 1}, {72, 0}, {72, 1},
-   {71, 0}, {71, 1}, {70, 0}, {70, 1}, {69, 0}, {69, 1}, {68, 0}, {68, 1},
-   {67, 0}, {67, 1}, {66, 0}, {66, 1}, {65, 0}, {65, 0}, {65, 1}, {64, 0},
-   {64, 1}, {63, 0}, {63, 1}, {62, 0}, {62, 0}, {62, 1}, {61, 0}, {61, 1},
-   {60, 0}, {60, 0}, {60, 1}, {59, 0}, {59, 0}, {59, 1}, {58, 0}, {58, 0},
-   {58, 1}, {57, 0}, {57, 0}, {57, 1}, {56, 0}, {56, 0}, {56, 1}, {55, 0},
-   {55, 0}, {55, 1}, {54, 0}, {54, 0}, {54, 1}, {53, 0}, {53, 0}, {53, 0},
-   {53, 1}, {52, 0}, {52, 0}, {52, 1}, {51, 0}, {51, 0}, {51, 0}, {51, 1},
-   {50, 0}, {50, 0}, {50, 0}, {50, 1}, {49, 0}, {49, 0}, {49, 0}, {49, 1},
-   {48, 0}, {48, 0}, {48, 0}, {48, 1}, {47, 0}, {47, 0}, {47, 0}, {47, 1},
-   {46, 0}, {46, 0}, {46, 0}, {46, 0}, {46, 1}, {45, 0}, {45, 0}, {45, 0},
-   {45, 1}, {44, 0}, {44, 0}, {44, 0}, {44, 0}, {44, 1}, {43, 0}, {43, 0},
-   {43, 0}, {43, 0}, {43, 1}, {42, 0}, {42, 0}, {42, 0}, {42, 0}, {42, 0},
-   {42, 1}, {41, 0}, {41, 0}, {41, 0}, {41, 0}, {41, 0}, {41, 1}, {40, 0},
-   {40, 0}, {40, 0}, {40, 0}, {40, 1}, {39, 0}, {39, 0}, {39, 0}, {39, 0},
-   {39, 0}, {39, 0}, {39, 1}, {38, 0}, {38, 0}, {38, 0}, {38, 0}, {38, 0},
-};
-
-const uint16_t speed_lookuptable_slow[256][2] PROGMEM = {
-   {62500, 10417}, {52083, 7441}, {44642, 5580}, {39062, 4340}, {34722, 3472}, {31250, 2841}, {28409, 2368}, {26041, 2003},
-   {24038, 1717}, {22321, 1488}, {20833, 1302}, {19531, 1149}, {18382, 1021}, {17361, 914}, {16447, 822}, {15625, 745},
-   {14880, 676}, {14204, 618}, {13586, 566}, {13020, 520}, {12500, 481}, {12019, 445}, {11574, 414}, {11160, 385},
-   {10775, 359}, {10416, 336}, {10080, 315}, {9765, 296}, {9469, 278}, {9191, 263}, {8928, 248}, {8680, 235},
-   {8445, 222}, {8223, 211}, {8012, 200}, {7812, 191}, {7621, 181}, {7440, 173}, {7267, 165}, {7102, 158},
-   {6944, 151}, {6793, 145}, {6648, 138}, {6510, 133}, {6377, 127}, {6250, 123}, {6127, 118}, {6009, 113},
-   {5896, 109}, {5787, 106}, {5681, 101}, {5580, 98}, {5482, 95}, {5387, 91}, {5296, 88}, {5208, 86},
-   {5122, 82}, {5040, 80}, {4960, 78}, {4882, 75}, {4807, 73}, {4734, 70}, {4664, 69}, {4595, 67},
-   {4528, 64}, {4464, 63}, {4401, 61}, {4340, 60}, {4280, 58}, {4222, 56}, {4166, 55}, {4111, 53},
-   {4058, 52}, {4006, 51}, {3955, 49}, {3906, 48}, {3858, 48}, {3810, 45}, {3765, 45}, {3720, 44},
-   {3676, 43}, {3633, 42}, {3591, 40}, {3551, 40}, {3511, 39}, {3472, 38}, {3434, 38}, {3396, 36},
-   {3360, 36}, {3324, 35}, {3289, 34}, {3255, 34}, {3221, 33}, {3188, 32}, {3156, 31}, {3125, 31},
-   {3094, 31}, {3063, 30}, {3033, 29}, {3004, 28}, {2976, 28}, {2948, 28}, {2920, 27}, {2893, 27},
-   {2866, 26}, {2840, 25}, {2815, 25}, {2790, 25}, {2765, 24}, {2741, 24}, {2717, 24}, {2693, 23},
-   {2670, 22}, {2648, 22}, {2626, 22}, {2604, 22}, {2582, 21}, {2561, 21}, {2540, 20}, {2520, 20},
-   {2500, 20}, {2480, 20}, {2460, 19}, {2441, 19}, {2422, 19}, {2403, 18}, {2385, 18}, {2367, 18},
-   {2349, 17}, {2332, 18}, {2314, 17}, {2297, 16}, {2281, 17}, {2264, 16}, {2248, 16}, {2232, 16},
-   {2216, 16}, {2200, 15}, {2185, 15}, {2170, 15}, {2155, 15}, {2140, 15}, {2125, 14}, {2111, 14},
-   {2097, 14}, {2083, 14}, {2069, 14}, {2055, 13}, {2042, 13}, {2029, 13}, {2016, 13}, {2003, 13},
-   {1990, 13}, {1977, 12}, {1965, 12}, {1953, 13}, {1940, 11}, {1929, 12}, {1917, 12}, {1905, 12},
-   {1893, 11}, {1882, 11}, {1871, 11}, {1860, 11}, {1849, 11}, {1838, 11}, {1827, 11}, {1816, 10},
-   {1806, 11}, {1795, 10}, {1785, 10}, {1775, 10}, {1765, 10}, {1755, 10}, {1745, 9}, {1736, 10},
-   {1726, 9}, {1717, 10}, {1707, 9}, {1698, 9}, {1689, 9}, {1680, 9}, {1671, 9}, {1662, 9},
-   {1653, 9}, {1644, 8}, {1636, 9}, {1627, 8}, {1619, 9}, {1610, 8}, {1602, 8}, {1594, 8},
-   {1586, 8}, {1578, 8}, {1570, 8}, {1562, 8}, {1554, 7}, {1547, 8}, {1539, 8}, {1531, 7},
-   {1524, 8}, {1516, 7}, {1509, 7}, {1502, 7}, {1495, 7}, {1488, 7}, {1481, 7}, {1474, 7},
-   {1467, 7}, {1460, 7}, {1453, 7}, {1446, 6}, {1440, 7}, {1433, 7}, {1426, 6}, {1420, 6},
-   {1414, 7}, {1407, 6}, {1401, 6}, {1395, 7}, {1388, 6}, {1382, 6}, {1376, 6}, {1370, 6},
-   {1364, 6}, {1358, 6}, {1352, 6}, {1346, 5}, {1341, 6}, {1335, 6}, {1329, 5}, {1324, 6},
-   {1318, 5}, {1313, 6}, {1307, 5}, {1302, 6}, {1296, 5}, {1291, 5}, {1286, 6}, {1280, 5},
-   {1275, 5}, {1270, 5}, {1265, 5}, {1260, 5}, {1255, 5}, {1250, 5}, {1245, 5}, {1240, 5},
-   {1235, 5}, {1230, 5}, {1225, 5}, {1220, 5}, {1215, 4}, {1211, 5}, {1206, 5}, {1201, 5},
+const uint16_t speed_lookuptable_sq[544][2] PROGMEM = {
+{ 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0},
+{ 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 0}, { 65535, 374}, { 65161, 697}, { 64464, 675},
+{ 63789, 654}, { 63135, 635}, { 62500, 616}, { 61884, 598}, { 61286, 581}, { 60705, 564}, { 60141, 550}, { 59591, 534},
+{ 59057, 520}, { 58537, 507}, { 58030, 494}, { 57536, 482}, { 57054, 469}, { 56585, 458}, { 56127, 448}, { 55679, 436},
+{ 55243, 844}, { 54399, 806}, { 53593, 771}, { 52822, 739}, { 52083, 708}, { 51375, 681}, { 50694, 654}, { 50040, 629},
+{ 49411, 607}, { 48804, 584}, { 48220, 564}, { 47656, 545}, { 47111, 526}, { 46585, 509}, { 46076, 493}, { 45583, 478},
+{ 45105, 462}, { 44643, 449}, { 44194, 435}, { 43759, 423}, { 43336, 411}, { 42925, 399}, { 42526, 389}, { 42137, 377},
+{ 41760, 368}, { 41392, 359}, { 41033, 349}, { 40684, 340}, { 40344, 332}, { 40012, 324}, { 39688, 317}, { 39371, 309},
+{ 39062, 596}, { 38466, 570}, { 37896, 545}, { 37351, 523}, { 36828, 501}, { 36327, 481}, { 35846, 462}, { 35384, 445},
+{ 34939, 429}, { 34510, 413}, { 34097, 399}, { 33698, 385}, { 33313, 373}, { 32940, 360}, { 32580, 348}, { 32232, 338},
+{ 31894, 327}, { 31567, 317}, { 31250, 308}, { 30942, 299}, { 30643, 290}, { 30353, 283}, { 30070, 274}, { 29796, 268},
+{ 29528, 260}, { 29268, 253}, { 29015, 247}, { 28768, 241}, { 28527, 235}, { 28292, 229}, { 28063, 223}, { 27840, 219},
+{ 27621, 421}, { 27200, 403}, { 26797, 386}, { 26411, 369}, { 26042, 355}, { 25687, 340}, { 25347, 327}, { 25020, 315},
+{ 24705, 303}, { 24402, 292}, { 24110, 282}, { 23828, 272}, { 23556, 264}, { 23292, 254}, { 23038, 247}, { 22791, 238},
+{ 22553, 232}, { 22321, 224}, { 22097, 218}, { 21879, 211}, { 21668, 205}, { 21463, 200}, { 21263, 194}, { 21069, 189},
+{ 20880, 184}, { 20696, 179}, { 20517, 175}, { 20342, 170}, { 20172, 166}, { 20006, 162}, { 19844, 158}, { 19686, 155},
+{ 19531, 298}, { 19233, 285}, { 18948, 273}, { 18675, 261}, { 18414, 250}, { 18164, 241}, { 17923, 231}, { 17692, 223},
+{ 17469, 214}, { 17255, 207}, { 17048, 199}, { 16849, 193}, { 16656, 186}, { 16470, 180}, { 16290, 174}, { 16116, 169},
+{ 15947, 163}, { 15784, 159}, { 15625, 154}, { 15471, 149}, { 15322, 146}, { 15176, 141}, { 15035, 137}, { 14898, 134},
+{ 14764, 130}, { 14634, 127}, { 14507, 123}, { 14384, 120}, { 14264, 118}, { 14146, 114}, { 14032, 112}, { 13920, 109},
+{ 13811, 211}, { 13600, 202}, { 13398, 192}, { 13206, 185}, { 13021, 177}, { 12844, 170}, { 12674, 164}, { 12510, 157},
+{ 12353, 152}, { 12201, 146}, { 12055, 141}, { 11914, 136}, { 11778, 132}, { 11646, 127}, { 11519, 123}, { 11396, 120},
+{ 11276, 115}, { 11161, 112}, { 11049, 109}, { 10940, 106}, { 10834, 103}, { 10731, 100}, { 10631, 97}, { 10534, 94},
+{ 10440, 92}, { 10348, 90}, { 10258, 87}, { 10171, 85}, { 10086, 83}, { 10003, 81}, { 9922, 79}, { 9843, 77},
+{ 9766, 149}, { 9617, 143}, { 9474, 136}, { 9338, 131}, { 9207, 125}, { 9082, 120}, { 8962, 116}, { 8846, 111},
+{ 8735, 108}, { 8627, 103}, { 8524, 100}, { 8424, 96}, { 8328, 93}, { 8235, 90}, { 8145, 87}, { 8058, 84},
+{ 7974, 82}, { 7892, 80}, { 7812, 76}, { 7736, 75}, { 7661, 73}, { 7588, 70}, { 7518, 69}, { 7449, 67},
+{ 7382, 65}, { 7317, 63}, { 7254, 62}, { 7192, 60}, { 7132, 59}, { 7073, 57}, { 7016, 56}, { 6960, 55},
+{ 6905, 105}, { 6800, 101}, { 6699, 96}, { 6603, 93}, { 6510, 88}, { 6422, 85}, { 6337, 82}, { 6255, 79},
+{ 6176, 75}, { 6101, 74}, { 6027, 70}, { 5957, 68}, { 5889, 66}, { 5823, 64}, { 5759, 61}, { 5698, 60},
+{ 5638, 58}, { 5580, 56}, { 5524, 54}, { 5470, 53}, { 5417, 51}, { 5366, 50}, { 5316, 49}, { 5267, 47},
+{ 5220, 46}, { 5174, 45}, { 5129, 43}, { 5086, 43}, { 5043, 42}, { 5001, 40}, { 4961, 40}, { 4921, 38},
+{ 4883, 75}, { 4808, 71}, { 4737, 68}, { 4669, 65}, { 4604, 63}, { 4541, 60}, { 4481, 58}, { 4423, 56},
+{ 4367, 53}, { 4314, 52}, { 4262, 50}, { 4212, 48}, { 4164, 46}, { 4118, 45}, { 4073, 44}, { 4029, 42},
+{ 3987, 41}, { 3946, 40}, { 3906, 38}, { 3868, 38}, { 3830, 36}, { 3794, 35}, { 3759, 35}, { 3724, 33},
+{ 3691, 32}, { 3659, 32}, { 3627, 31}, { 3596, 30}, { 3566, 29}, { 3537, 29}, { 3508, 28}, { 3480, 27},
+{ 3453, 53}, { 3400, 50}, { 3350, 49}, { 3301, 46}, { 3255, 44}, { 3211, 43}, { 3168, 40}, { 3128, 40},
+{ 3088, 38}, { 3050, 36}, { 3014, 36}, { 2978, 34}, { 2944, 32}, { 2912, 32}, { 2880, 31}, { 2849, 30},
+{ 2819, 29}, { 2790, 28}, { 2762, 27}, { 2735, 27}, { 2708, 25}, { 2683, 25}, { 2658, 24}, { 2634, 24},
+{ 2610, 23}, { 2587, 22}, { 2565, 22}, { 2543, 22}, { 2521, 20}, { 2501, 21}, { 2480, 19}, { 2461, 20},
+{ 2441, 37}, { 2404, 35}, { 2369, 35}, { 2334, 32}, { 2302, 32}, { 2270, 30}, { 2240, 29}, { 2211, 27},
+{ 2184, 27}, { 2157, 26}, { 2131, 25}, { 2106, 24}, { 2082, 23}, { 2059, 23}, { 2036, 22}, { 2014, 21},
+{ 1993, 20}, { 1973, 20}, { 1953, 19}, { 1934, 19}, { 1915, 18}, { 1897, 18}, { 1879, 17}, { 1862, 16},
+{ 1846, 17}, { 1829, 16}, { 1813, 15}, { 1798, 15}, { 1783, 15}, { 1768, 14}, { 1754, 14}, { 1740, 14},
+{ 1726, 26}, { 1700, 25}, { 1675, 24}, { 1651, 23}, { 1628, 23}, { 1605, 21}, { 1584, 20}, { 1564, 20},
+{ 1544, 19}, { 1525, 18}, { 1507, 18}, { 1489, 17}, { 1472, 16}, { 1456, 16}, { 1440, 16}, { 1424, 14},
+{ 1410, 15}, { 1395, 14}, { 1381, 14}, { 1367, 13}, { 1354, 13}, { 1341, 12}, { 1329, 12}, { 1317, 12},
+{ 1305, 12}, { 1293, 11}, { 1282, 11}, { 1271, 10}, { 1261, 11}, { 1250, 10}, { 1240, 10}, { 1230, 9},
+{ 1221, 19}, { 1202, 18}, { 1184, 17}, { 1167, 16}, { 1151, 16}, { 1135, 15}, { 1120, 14}, { 1106, 14},
+{ 1092, 14}, { 1078, 12}, { 1066, 13}, { 1053, 12}, { 1041, 12}, { 1029, 11}, { 1018, 11}, { 1007, 10},
+{ 997, 11}, { 986, 9}, { 977, 10}, { 967, 9}, { 958, 9}, { 949, 9}, { 940, 9}, { 931, 8},
+{ 923, 8}, { 915, 8}, { 907, 8}, { 899, 8}, { 891, 7}, { 884, 7}, { 877, 7}, { 870, 7},
+{ 863, 13}, { 850, 13}, { 837, 12}, { 825, 11}, { 814, 11}, { 803, 11}, { 792, 10}, { 782, 10},
+{ 772, 9}, { 763, 10}, { 753, 8}, { 745, 9}, { 736, 8}, { 728, 8}, { 720, 8}, { 712, 7},
+{ 705, 7}, { 698, 7}, { 691, 7}, { 684, 7}, { 677, 6}, { 671, 7}, { 664, 6}, { 658, 6},
+{ 652, 5}, { 647, 6}, { 641, 5}, { 636, 6}, { 630, 5}, { 625, 5}, { 620, 5}, { 615, 5},
+{ 610, 9}, { 601, 9}, { 592, 8}, { 584, 9}, { 575, 7}, { 568, 8}, { 560, 7}, { 553, 7},
+{ 546, 7}, { 539, 6}, { 533, 6}, { 527, 6}, { 521, 6}, { 515, 6}, { 509, 5}, { 504, 6},
+{ 498, 5}, { 493, 5}, { 488, 5}, { 483, 4}, { 479, 5}, { 474, 4}, { 470, 4}, { 466, 5},
+{ 461, 4}, { 457, 4}, { 453, 4}, { 449, 3}, { 446, 4}, { 442, 4}, { 438, 3}, { 435, 3},
+{ 432, 7}, { 425, 6}, { 419, 6}, { 413, 6}, { 407, 6}, { 401, 5}, { 396, 5}, { 391, 5},
+{ 386, 5}, { 381, 4}, { 377, 5}, { 372, 4}, { 368, 4}, { 364, 4}, { 360, 4}, { 356, 4},
+{ 352, 3}, { 349, 4}, { 345, 3}, { 342, 3}, { 339, 4}, { 335, 3}, { 332, 3}, { 329, 3},
+{ 326, 3}, { 323, 2}, { 321, 3}, { 318, 3}, { 315, 2}, { 313, 3}, { 310, 2}, { 308, 3},
+{ 305, 4}, { 301, 5}, { 296, 4}, { 292, 4}, { 288, 4}, { 284, 4}, { 280, 4}, { 276, 3},
+{ 273, 3}, { 270, 4}, { 266, 3}, { 263, 3}, { 260, 3}, { 257, 2}, { 255, 3}, { 252, 3},
+{ 249, 2}, { 247, 3}, { 244, 2}, { 242, 3}, { 239, 2}, { 237, 2}, { 235, 2}, { 233, 2},
+{ 231, 2}, { 229, 2}, { 227, 2}, { 225, 2}, { 223, 2}, { 221, 2}, { 219, 2}, { 217, 1},
 };
 
 #endif
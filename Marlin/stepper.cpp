@@ -30,6 +30,7 @@
 #include "language.h"
 #include "cardreader.h"
 #include "speed_lookuptable.h"
+#include "SegmentMerge.h"
 #if HAS_DIGIPOTSS
   #include <SPI.h>
 #endif
@@ -65,12 +66,11 @@ volatile static unsigned long step_events_completed; // The number of step event
   static long e_steps[4];
 #endif
 
-static long acceleration_time, deceleration_time;
-//static unsigned long accelerate_until, decelerate_after, acceleration_rate, initial_rate, final_rate, nominal_rate;
-static unsigned short acc_step_rate; // needed for deceleration start point
-static char step_loops;
+static unsigned long step_rate_sq; // Step rate squared, kept through the cruise for deceleration
+static unsigned long nominal_rate_sq, final_rate_sq;
+static uint8_t step_loops;
 static unsigned short OCR1A_nominal;
-static unsigned short step_loops_nominal;
+static uint8_t step_loops_nominal;
 
 volatile long endstops_trigsteps[3] = { 0 };
 volatile long endstops_stepsTotal, endstops_stepsDone;
@@ -96,6 +96,15 @@ static bool check_endstops = true;
 volatile long count_position[NUM_AXIS] = { 0 };
 volatile signed char count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
 
+#if ENABLED(PNEUMATICS)
+  static unsigned char st_solenoids = 0;            // Solenoid outputs as last written by the ISR
+#endif
+
+#if ENABLED(E_REGULATOR)
+  static float st_regulator_setpoint = 0;           // Setpoint of the block being traced (psi)
+  static volatile bool st_regulator_pending = false; // Set until idle() writes it to the DAC
+#endif
+
 
 //===========================================================================
 //================================ functions ================================
@@ -157,6 +166,15 @@ volatile signed char count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
 
 #define E_APPLY_STEP(v,Q) E_STEP_WRITE(v)
 
+#ifdef UNIT_TEST
+
+// Portable equivalent of the AVR multiply helper below, for host builds.
+// It rounds on the highest discarded bit, as the assembly version does.
+#define MultiU16X8toH16(intRes, charIn1, intIn2) \
+  intRes = (unsigned short)(((uint32_t)(uint8_t)(charIn1) * (uint16_t)(intIn2) + 0x80) >> 8)
+
+#else
+
 // intRes = intIn1 * intIn2 >> 16
 // uses:
 // r26 to store 0
@@ -182,61 +200,7 @@ volatile signed char count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
     "r26" \
   )
 
-// intRes = longIn1 * longIn2 >> 24
-// uses:
-// r26 to store 0
-// r27 to store bits 16-23 of the 48bit result. The top bit is used to round the two byte result.
-// note that the lower two bytes and the upper byte of the 48bit result are not calculated.
-// this can cause the result to be out by one as the lower bytes may cause carries into the upper ones.
-// B0 A0 are bits 24-39 and are the returned value
-// C1 B1 A1 is longIn1
-// D2 C2 B2 A2 is longIn2
-//
-#define MultiU24X32toH16(intRes, longIn1, longIn2) \
-  asm volatile ( \
-    "clr r26 \n\t" \
-    "mul %A1, %B2 \n\t" \
-    "mov r27, r1 \n\t" \
-    "mul %B1, %C2 \n\t" \
-    "movw %A0, r0 \n\t" \
-    "mul %C1, %C2 \n\t" \
-    "add %B0, r0 \n\t" \
-    "mul %C1, %B2 \n\t" \
-    "add %A0, r0 \n\t" \
-    "adc %B0, r1 \n\t" \
-    "mul %A1, %C2 \n\t" \
-    "add r27, r0 \n\t" \
-    "adc %A0, r1 \n\t" \
-    "adc %B0, r26 \n\t" \
-    "mul %B1, %B2 \n\t" \
-    "add r27, r0 \n\t" \
-    "adc %A0, r1 \n\t" \
-    "adc %B0, r26 \n\t" \
-    "mul %C1, %A2 \n\t" \
-    "add r27, r0 \n\t" \
-    "adc %A0, r1 \n\t" \
-    "adc %B0, r26 \n\t" \
-    "mul %B1, %A2 \n\t" \
-    "add r27, r1 \n\t" \
-    "adc %A0, r26 \n\t" \
-    "adc %B0, r26 \n\t" \
-    "lsr r27 \n\t" \
-    "adc %A0, r26 \n\t" \
-    "adc %B0, r26 \n\t" \
-    "mul %D2, %A1 \n\t" \
-    "add %A0, r0 \n\t" \
-    "adc %B0, r1 \n\t" \
-    "mul %D2, %B1 \n\t" \
-    "add %B0, r0 \n\t" \
-    "clr r1 \n\t" \
-    : \
-    "=&r" (intRes) \
-    : \
-    "d" (longIn1), \
-    "d" (longIn2) \
-    : \
-    "r26" , "r27" \
-  )
+#endif // UNIT_TEST
 
 // Some useful constants
 
@@ -469,46 +433,49 @@ inline void update_endstops() {
 //  The trapezoid is the shape the speed curve over time. It starts at block->initial_rate, accelerates
 //  first block->accelerate_until step_events_completed, then keeps going at constant speed until
 //  step_events_completed reaches block->decelerate_after after which it decelerates until the trapezoid generator is reset.
-//  The slope of acceleration is calculated using v = u + at where t is the accumulated timer values of the steps so far.
+//  The slope of acceleration is calculated using v^2 = u^2 + 2as, the distance based ramp the planner plans with: each
+//  step adds block->acceleration_rate (2a) to the step rate squared, and calc_timer() looks up the interval for that.
 
 void st_wake_up() {
   //  TCNT1 = 0;
   ENABLE_STEPPER_DRIVER_INTERRUPT();
 }
 
-FORCE_INLINE unsigned short calc_timer(unsigned short step_rate) {
-  unsigned short timer;
-  if (step_rate > MAX_STEP_FREQUENCY) step_rate = MAX_STEP_FREQUENCY;
+// Timer1 interval between step interrupts at a step rate given squared. Sets loops
+// to the step events per interrupt, several above 10kHz, so the interval stays long.
+FORCE_INLINE unsigned short calc_timer(unsigned long rate_sq, uint8_t &loops) {
+  NOMORE(rate_sq, (unsigned long)MAX_STEP_FREQUENCY * MAX_STEP_FREQUENCY);
 
-  if (step_rate > 20000) { // If steprate > 20kHz >> step 4 times
-    step_rate = (step_rate >> 2) & 0x3fff;
-    step_loops = 4;
+  if (rate_sq > 20000UL * 20000) { // If steprate > 20kHz >> step 4 times
+    rate_sq >>= 4;
+    loops = 4;
   }
-  else if (step_rate > 10000) { // If steprate > 10kHz >> step 2 times
-    step_rate = (step_rate >> 1) & 0x7fff;
-    step_loops = 2;
+  else if (rate_sq > 10000UL * 10000) { // If steprate > 10kHz >> step 2 times
+    rate_sq >>= 2;
+    loops = 2;
   }
   else {
-    step_loops = 1;
+    loops = 1;
   }
 
-  if (step_rate < (F_CPU / 500000)) step_rate = (F_CPU / 500000);
-  step_rate -= (F_CPU / 500000); // Correct for minimal speed
-  if (step_rate >= (8 * 256)) { // higher step rate
-    unsigned short table_address = (unsigned short)&speed_lookuptable_fast[(unsigned char)(step_rate>>8)][0];
-    unsigned char tmp_step_rate = (step_rate & 0x00ff);
-    unsigned short gain = (unsigned short)pgm_read_word_near(table_address+2);
-    MultiU16X8toH16(timer, tmp_step_rate, gain);
-    timer = (unsigned short)pgm_read_word_near(table_address) - timer;
-  }
-  else { // lower step rates
-    unsigned short table_address = (unsigned short)&speed_lookuptable_slow[0][0];
-    table_address += ((step_rate)>>1) & 0xfffc;
-    timer = (unsigned short)pgm_read_word_near(table_address);
-    timer -= (((unsigned short)pgm_read_word_near(table_address+2) * (unsigned char)(step_rate & 0x0007))>>3);
-  }
-  if (timer < 100) { timer = 100; MYSERIAL.print(MSG_STEPPER_TOO_HIGH); MYSERIAL.println(step_rate); }//(20kHz this should never happen)
-  return timer;
+  // Scale to 2^13 <= rate_sq < 2^14, counting octaves up from 2^10. The top bits
+  // then pick the table row and the low byte interpolates within it. Below
+  // F_CPU / 500000 steps/s the interval would overflow Timer1.
+  NOLESS(rate_sq, (unsigned long)(F_CPU / 500000) * (F_CPU / 500000));
+  uint8_t octave = 3;
+  if (rate_sq >= 0x200000UL) { rate_sq >>= 8; octave = 11; }
+  while (rate_sq >= 0x4000) { rate_sq >>= 1; octave++; }
+  while (rate_sq < 0x2000) { rate_sq <<= 1; octave--; }
+
+  const uint16_t *table_address = speed_lookuptable_sq[(octave << 5) + ((unsigned short)rate_sq >> 8) - 32];
+  unsigned short gain = (unsigned short)pgm_read_word_near(table_address + 1), timer;
+  MultiU16X8toH16(timer, (unsigned char)rate_sq, gain);
+  return (unsigned short)pgm_read_word_near(table_address) - timer;
+}
+
+unsigned short st_step_interval(unsigned long rate, uint8_t &loops) {
+  NOMORE(rate, MAX_STEP_FREQUENCY);
+  return calc_timer(rate * rate, loops);
 }
 
 /**
@@ -547,13 +514,16 @@ void set_stepper_direction() {
   }
   
   #if DISABLED(ADVANCE)
-    if (TEST(out_bits, E_AXIS)) {
-      REV_E_DIR();
-      count_direction[E_AXIS] = -1;
-    }
-    else {
-      NORM_E_DIR();
-      count_direction[E_AXIS] = 1;
+    // st_init() gets here before any block is loaded, so there is no extruder to select yet
+    if (current_block) {
+      if (TEST(out_bits, E_AXIS)) {
+        REV_E_DIR();
+        count_direction[E_AXIS] = -1;
+      }
+      else {
+        NORM_E_DIR();
+        count_direction[E_AXIS] = 1;
+      }
     }
   #endif //!ADVANCE
 }
@@ -574,14 +544,14 @@ FORCE_INLINE void trapezoid_generator_reset() {
     e_steps[current_block->active_extruder] += ((advance >>8) - old_advance);
     old_advance = advance >>8;
   #endif
-  deceleration_time = 0;
-  // step_rate to timer interval
-  OCR1A_nominal = calc_timer(current_block->nominal_rate);
-  // make a note of the number of step loops required at nominal speed
-  step_loops_nominal = step_loops;
-  acc_step_rate = current_block->initial_rate;
-  acceleration_time = calc_timer(acc_step_rate);
-  OCR1A = acceleration_time;
+  // Intervals at the ends of the ramps, looked up by the planner
+  OCR1A_nominal = current_block->nominal_interval;
+  step_loops_nominal = current_block->nominal_loops;
+  OCR1A = current_block->initial_interval;
+  step_loops = current_block->initial_loops;
+  step_rate_sq = current_block->initial_rate * current_block->initial_rate;
+  nominal_rate_sq = current_block->nominal_rate * current_block->nominal_rate;
+  final_rate_sq = current_block->final_rate * current_block->final_rate;
 
   // SERIAL_ECHO_START;
   // SERIAL_ECHOPGM("advance :");
@@ -594,6 +564,58 @@ FORCE_INLINE void trapezoid_generator_reset() {
   // SERIAL_ECHOLN(current_block->final_advance/256.0);
 }
 
+#if ENABLED(PNEUMATICS)
+  // Switches the solenoids of a starting block without draining the planner.
+  // Only changed outputs are written, as a solenoid pin may double as a heater.
+  FORCE_INLINE void st_apply_solenoids(unsigned char solenoids) {
+    unsigned char changed = solenoids ^ st_solenoids;
+    if (!changed) return;
+    st_solenoids = solenoids;
+    #if HAS_SOLENOID_0
+      if (TEST(changed, 0)) WRITE(SOL0_PIN, TEST(solenoids, 0));
+    #endif
+    #if HAS_SOLENOID_1
+      if (TEST(changed, 1)) WRITE(SOL1_PIN, TEST(solenoids, 1));
+    #endif
+  }
+
+  // Clears the solenoids of the queued blocks as well, or the next block to
+  // start would open its solenoid again. Used on errors, without a quickStop().
+  void st_close_solenoids() {
+    CRITICAL_SECTION_START;
+      solenoid_state = 0;
+      for (uint8_t i = block_buffer_tail; i != block_buffer_head; i = BLOCK_MOD(i + 1))
+        block_buffer[i].solenoids = 0;
+      st_solenoids = 0;
+      #if HAS_SOLENOID_0
+        OUT_WRITE(SOL0_PIN, LOW);
+      #endif
+      #if HAS_SOLENOID_1
+        OUT_WRITE(SOL1_PIN, LOW);
+      #endif
+    CRITICAL_SECTION_END;
+  }
+#endif
+
+#if ENABLED(E_REGULATOR)
+  // The regulator DAC is on I2C, which can't be driven from here, so a new
+  // setpoint is only latched for st_regulator_setpoint_changed()
+  FORCE_INLINE void st_latch_regulator_setpoint(float setpoint) {
+    if (setpoint == st_regulator_setpoint) return;
+    st_regulator_setpoint = setpoint;
+    st_regulator_pending = true;
+  }
+
+  bool st_regulator_setpoint_changed(float &setpoint) {
+    if (!st_regulator_pending) return false;
+    CRITICAL_SECTION_START;
+    setpoint = st_regulator_setpoint;
+    st_regulator_pending = false;
+    CRITICAL_SECTION_END;
+    return true;
+  }
+#endif
+
 // "The Stepper Driver Interrupt" - This timer interrupt is the workhorse.
 // It pops blocks from the block_buffer and executes them by pulsing the stepper pins appropriately.
 ISR(TIMER1_COMPA_vect) {
@@ -615,6 +637,12 @@ ISR(TIMER1_COMPA_vect) {
     current_block = plan_get_current_block();
     if (current_block) {
       current_block->busy = true;
+      #if ENABLED(PNEUMATICS)
+        st_apply_solenoids(current_block->solenoids);
+      #endif
+      #if ENABLED(E_REGULATOR)
+        st_latch_regulator_setpoint(current_block->regulator_setpoint);
+      #endif
       trapezoid_generator_reset();
       counter_x = -(current_block->step_event_count >> 1);
       counter_y = counter_z = counter_e = counter_x;
@@ -633,6 +661,13 @@ ISR(TIMER1_COMPA_vect) {
       // #endif
     }
     else {
+      // Pneumatics changes queued after the last move take effect once it is done
+      #if ENABLED(PNEUMATICS)
+        st_apply_solenoids(solenoid_state);
+      #endif
+      #if ENABLED(E_REGULATOR)
+        st_latch_regulator_setpoint(regulator_setpoint);
+      #endif
       OCR1A = 2000; // 1kHz.
     }
   }
@@ -689,21 +724,18 @@ ISR(TIMER1_COMPA_vect) {
       if (step_events_completed >= current_block->step_event_count) break;
     }
     // Calculate new timer value
-    unsigned short timer;
-    unsigned short step_rate;
+    // 2a for each of the step_loops (1, 2 or 4) steps just taken
+    unsigned long rate_sq_change = current_block->acceleration_rate << (step_loops >> 1);
     if (step_events_completed <= (unsigned long)current_block->accelerate_until) {
 
-      MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
-      acc_step_rate += current_block->initial_rate;
+      step_rate_sq += rate_sq_change;
 
       // upper limit
-      if (acc_step_rate > current_block->nominal_rate)
-        acc_step_rate = current_block->nominal_rate;
+      if (step_rate_sq > nominal_rate_sq)
+        step_rate_sq = nominal_rate_sq;
 
       // step_rate to timer interval
-      timer = calc_timer(acc_step_rate);
-      OCR1A = timer;
-      acceleration_time += timer;
+      OCR1A = calc_timer(step_rate_sq, step_loops);
       #if ENABLED(ADVANCE)
         for(int8_t i=0; i < step_loops; i++) {
           advance += advance_rate;
@@ -716,23 +748,14 @@ ISR(TIMER1_COMPA_vect) {
       #endif
     }
     else if (step_events_completed > (unsigned long)current_block->decelerate_after) {
-      MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
-
-      if (step_rate > acc_step_rate) { // Check step_rate stays positive
-        step_rate = current_block->final_rate;
-      }
-      else {
-        step_rate = acc_step_rate - step_rate; // Decelerate from aceleration end point.
-      }
-
-      // lower limit
-      if (step_rate < current_block->final_rate)
-        step_rate = current_block->final_rate;
+      // Decelerate from the rate reached, down to the lower limit
+      if (step_rate_sq > final_rate_sq + rate_sq_change)
+        step_rate_sq -= rate_sq_change;
+      else
+        step_rate_sq = final_rate_sq;
 
       // step_rate to timer interval
-      timer = calc_timer(step_rate);
-      OCR1A = timer;
-      deceleration_time += timer;
+      OCR1A = calc_timer(step_rate_sq, step_loops);
       #if ENABLED(ADVANCE)
         for(int8_t i=0; i < step_loops; i++) {
           advance -= advance_rate;
@@ -836,6 +859,16 @@ void st_init() {
   digipot_init(); //Initialize Digipot Motor Current
   microstep_init(); //Initialize Microstepping Pins
 
+  // Solenoids are switched by the ISR as blocks start
+  #if ENABLED(PNEUMATICS)
+    #if HAS_SOLENOID_0
+      OUT_WRITE(SOL0_PIN, LOW);
+    #endif
+    #if HAS_SOLENOID_1
+      OUT_WRITE(SOL1_PIN, LOW);
+    #endif
+  #endif
+
   // initialise TMC Steppers
   #if ENABLED(HAVE_TMCDRIVER)
     tmc_init();
@@ -1039,7 +1072,7 @@ void st_init() {
   // Generally we use a divider of 8, resulting in a 2MHz timer
   // frequency on a 16MHz MCU. If you are going to change this, be
   // sure to regenerate speed_lookuptable.h with
-  // create_speed_lookuptable.py
+  // scripts/createSpeedLookupTable.py --divider <new divider>
   TCCR1B = (TCCR1B & ~(0x07<<CS10)) | (2<<CS10);
 
   OCR1A = 0x4000;
@@ -1092,12 +1125,67 @@ long st_get_position(uint8_t axis) {
 
 float st_get_position_mm(AxisEnum axis) { return st_get_position(axis) / axis_steps_per_unit[axis]; }
 
+#if ENABLED(PRESSURE_ADVANCE)
+
+  /**
+   * Follows the trapezoids of the current and the following blocks to the
+   * step rate lead seconds from now, as the ISR will run them.
+   * @param lead   Look-ahead time in seconds
+   * @param block  Set to the block running then, to the last block if the
+   *               buffer runs out first (the rate is 0), or NULL when idle
+   * @returns      Step events per second
+   */
+  float st_rate_ahead(float lead, block_t *&block) {
+    CRITICAL_SECTION_START;
+    block = current_block;
+    unsigned long steps = step_events_completed;
+    CRITICAL_SECTION_END;
+    if (!block) return 0;
+
+    uint8_t index = block - block_buffer;
+    for (;;) {
+      float accel = block->acceleration_st,
+            rate_top = sqrt(sq((float)block->initial_rate) + 2 * accel * block->accelerate_until),
+            rate, time;
+      NOMORE(rate_top, block->nominal_rate);
+
+      if ((long)steps < block->accelerate_until) {
+        rate = sqrt(sq((float)block->initial_rate) + 2 * accel * steps);
+        time = (rate_top - rate) / accel;
+        if (lead < time) return rate + accel * lead;
+        lead -= time;
+        steps = block->accelerate_until;
+      }
+      if ((long)steps < block->decelerate_after) {
+        time = (block->decelerate_after - steps) / rate_top;
+        if (lead < time) return rate_top;
+        lead -= time;
+        steps = block->decelerate_after;
+      }
+      rate = sq(rate_top) - 2 * accel * (steps - block->decelerate_after);
+      rate = sqrt(max(rate, sq((float)block->final_rate)));
+      time = (rate - block->final_rate) / accel;
+      if (lead < time) return rate - accel * lead;
+      lead -= time;
+
+      index = BLOCK_MOD(index + 1);
+      if (index == block_buffer_head) return 0;
+      block = &block_buffer[index];
+      steps = 0;
+    }
+  }
+
+#endif // PRESSURE_ADVANCE
+
 void finishAndDisableSteppers() {
   st_synchronize();
   disable_all_steppers();
 }
 
 void quickStop() {
+  #if ENABLED(SEGMENT_MERGE)
+    SegmentMerge__Discard();
+  #endif
   cleaning_buffer_counter = 5000;
   DISABLE_STEPPER_DRIVER_INTERRUPT();
   while (blocks_queued()) plan_discard_current_block();
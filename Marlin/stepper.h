@@ -69,6 +69,10 @@ long st_get_position(uint8_t axis);
 // Get current position in mm
 float st_get_position_mm(AxisEnum axis);
 
+// Timer1 ticks between step interrupts at rate step events/s, as the ISR will
+// time them. Sets loops to the step events per interrupt.
+unsigned short st_step_interval(unsigned long rate, uint8_t &loops);
+
 // The stepper subsystem goes to sleep when it runs out of things to execute. Call this
 // to notify the subsystem that it is time to go to work.
 void st_wake_up();
@@ -87,6 +91,21 @@ extern block_t *current_block;  // A pointer to the block currently being traced
 
 void quickStop();
 
+#if ENABLED(PNEUMATICS)
+  // Closes every solenoid right away, including those the queued blocks would open
+  void st_close_solenoids();
+#endif
+
+#if ENABLED(E_REGULATOR)
+  // Returns true, once, when a block with a new regulator setpoint has started
+  bool st_regulator_setpoint_changed(float &setpoint);
+#endif
+
+#if ENABLED(PRESSURE_ADVANCE)
+  // Step rate of the planned motion lead seconds from now, and the block running then
+  float st_rate_ahead(float lead, block_t *&block);
+#endif
+
 void digitalPotWrite(int address, int value);
 void microstep_ms(uint8_t driver, int8_t ms1, int8_t ms2);
 void microstep_mode(uint8_t driver, uint8_t stepping);
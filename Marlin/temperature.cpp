@@ -25,6 +25,11 @@
 #include "language.h"
 #include "Regulator.h"
 #include "MCP4725.h"
+#include "PneumaticPump.h"
+#include "PressureSensor.h"
+#include "PidFixed.h"
+#include "HeaterModel.h"
+#include "configuration_store.h"
 
 #include "Sd2PinMap.h"
 #include "Cartridge.h"
@@ -110,11 +115,15 @@ static volatile bool temp_meas_ready = false;
 
 #if ENABLED(PIDTEMP)
   //static cannot be external:
-  static float temp_iState[EXTRUDERS] = { 0 };
-  static float temp_dState[EXTRUDERS] = { 0 };
-  static float pTerm[EXTRUDERS];
-  static float iTerm[EXTRUDERS];
-  static float dTerm[EXTRUDERS];
+  #if ENABLED(PID_FIXED_POINT)
+    static PidFixed pid_fixed[EXTRUDERS];
+  #else
+    static float temp_iState[EXTRUDERS] = { 0 };
+    static float temp_dState[EXTRUDERS] = { 0 };
+    static float pTerm[EXTRUDERS];
+    static float iTerm[EXTRUDERS];
+    static float dTerm[EXTRUDERS];
+  #endif
   #if ENABLED(PID_ADD_EXTRUSION_RATE)
     static float cTerm[EXTRUDERS];
     static long last_position[EXTRUDERS];
@@ -123,27 +132,33 @@ static volatile bool temp_meas_ready = false;
   #endif
   //int output;
   static float pid_error[EXTRUDERS];
-  static float temp_iState_min[EXTRUDERS];
-  static float temp_iState_max[EXTRUDERS];
+  #if DISABLED(PID_FIXED_POINT)
+    static float temp_iState_min[EXTRUDERS];
+    static float temp_iState_max[EXTRUDERS];
+  #endif
   static bool pid_reset[EXTRUDERS];
 #endif //PIDTEMP
 #if ENABLED(PIDTEMPBED)
   //static cannot be external:
-  static float temp_iState_bed = { 0 };
-  static float temp_dState_bed = { 0 };
-  static float pTerm_bed;
-  static float iTerm_bed;
-  static float dTerm_bed;
+  #if ENABLED(PID_FIXED_POINT)
+    static PidFixed pid_fixed_bed;
+  #else
+    static float temp_iState_bed = { 0 };
+    static float temp_dState_bed = { 0 };
+    static float pTerm_bed;
+    static float iTerm_bed;
+    static float dTerm_bed;
+    static float temp_iState_min_bed;
+    static float temp_iState_max_bed;
+  #endif
   //int output;
   static float pid_error_bed;
-  static float temp_iState_min_bed;
-  static float temp_iState_max_bed;
 #else //PIDTEMPBED
   static millis_t  next_bed_check_ms;
 #endif //PIDTEMPBED
   static unsigned char soft_pwm[EXTRUDERS];
 
-#if ENABLED(PNEUMATICS)
+#if ENABLED(PNEUMATICS) && DISABLED(PNEUMATIC_PUMP_PWM)
   static unsigned long previous_millis_pneumatic_value;
 #endif
 
@@ -161,9 +176,9 @@ static volatile bool temp_meas_ready = false;
 
 #if ENABLED(PIDTEMP)
   #if ENABLED(PID_PARAMS_PER_EXTRUDER)
-    float Kp[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(DEFAULT_Kp);
-    float Ki[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(DEFAULT_Ki*PID_dT);
-    float Kd[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(DEFAULT_Kd / PID_dT);
+    float Kp[EXTRUDERS] = ARRAY_BY_EXTRUDERS(DEFAULT_Kp, DEFAULT_Kp_E1, DEFAULT_Kp_E2, DEFAULT_Kp_E3);
+    float Ki[EXTRUDERS] = ARRAY_BY_EXTRUDERS(DEFAULT_Ki*PID_dT, DEFAULT_Ki_E1*PID_dT, DEFAULT_Ki_E2*PID_dT, DEFAULT_Ki_E3*PID_dT);
+    float Kd[EXTRUDERS] = ARRAY_BY_EXTRUDERS(DEFAULT_Kd / PID_dT, DEFAULT_Kd_E1 / PID_dT, DEFAULT_Kd_E2 / PID_dT, DEFAULT_Kd_E3 / PID_dT);
     #if ENABLED(PID_ADD_EXTRUSION_RATE)
       float Kc[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(DEFAULT_Kc);
     #endif // PID_ADD_EXTRUSION_RATE
@@ -192,19 +207,29 @@ static int maxttemp[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(16383);
 #if ENABLED(PNEUMATICS)
   static int pneumatic_min_raw = PNEUMATIC_RAW_LO;
   static int pneumatic_max_raw = PNEUMATIC_RAW_HI;
+  static PressureSegment pneumatic_segments[PRESSURETABLE_LEN];
+  static PressureFilter pneumatic_filter;
+  static int pneumatic_unfiltered_raw = 0;
+  PressureStats pneumatic_stats;
 #endif
 
 #if ENABLED(E_REGULATOR)
   static int regulator_min_raw = REGULATOR_RAW_LO;
   static int regulator_max_raw = REGULATOR_RAW_HI;
+  static PressureSegment regulator_segments[REGULATORTABLE_LEN];
+  static PressureFilter regulator_filter;
+  static int regulator_unfiltered_raw = 0;
+  PressureStats regulator_stats;
 #endif
 
 #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
   static void *heater_ttbl_map[2] = {(void *)HEATER_0_TEMPTABLE, (void *)HEATER_1_TEMPTABLE };
   static uint8_t heater_ttbllen_map[2] = { HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN };
+  static const float *heater_tslope_map[2] = { HEATER_0_TEMPSLOPES, HEATER_1_TEMPSLOPES };
 #else
   static void *heater_ttbl_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( (void *)HEATER_0_TEMPTABLE, (void *)HEATER_1_TEMPTABLE, (void *)HEATER_2_TEMPTABLE, (void *)HEATER_3_TEMPTABLE );
   static uint8_t heater_ttbllen_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN, HEATER_2_TEMPTABLE_LEN, HEATER_3_TEMPTABLE_LEN );
+  static const float *heater_tslope_map[EXTRUDERS] = ARRAY_BY_EXTRUDERS( HEATER_0_TEMPSLOPES, HEATER_1_TEMPSLOPES, HEATER_2_TEMPSLOPES, HEATER_3_TEMPSLOPES );
 #endif
 
 static float analog2temp(int raw, uint8_t e);
@@ -396,17 +421,147 @@ void PID_autotune(float temp, int extruder, int ncycles) {
   }
 }
 
+#if ENABLED(PID_AUTOTUNE_FOPDT)
+
+/**
+ * Heats from rest at full power until the temperature reaches temp or
+ * HEATER_MODEL_MAX_SAMPLES are taken, fits a first order plus dead time
+ * model to the rise and derives the gains from it. With store the gains
+ * replace the current ones and are saved to EEPROM.
+ * Readings only come every ~164ms, so the samples the fit takes on a fixed
+ * interval are interpolated between the readings on either side.
+ */
+void PID_autotune_step(float temp, int extruder, bool store) {
+  static float samples[HEATER_MODEL_MAX_SAMPLES]; // Too big for the stack
+  uint8_t count = 0;
+  float input = 0.0, last_input = 0.0;
+  millis_t last_input_ms = 0;
+
+  if (extruder >= EXTRUDERS
+    #if !HAS_TEMP_BED
+       || extruder < 0
+    #endif
+  ) {
+    SERIAL_ECHOLN(MSG_PID_BAD_EXTRUDER_NUM);
+    return;
+  }
+
+  SERIAL_ECHOLN(MSG_PID_AUTOTUNE_START);
+
+  disable_all_heaters(); // switch off all heaters.
+
+  long power = extruder < 0 ? MAX_BED_POWER : PID_MAX;
+  millis_t interval = extruder < 0 ? PID_FOPDT_BED_INTERVAL : PID_FOPDT_INTERVAL,
+           temp_ms = millis(), next_sample_ms = 0;
+
+  while (count < HEATER_MODEL_MAX_SAMPLES) {
+    millis_t ms = millis();
+
+    if (temp_meas_ready) { // temp sample ready
+      updateTemperaturesFromRawValues();
+      input = (extruder<0)?current_temperature_bed:current_temperature[extruder];
+
+      if (count == 0) {
+        // The first sample is the one at rest, and the interval counts from it
+        samples[count++] = input;
+        next_sample_ms = ms + interval;
+        if (extruder < 0)
+          soft_pwm_bed = power >> 1;
+        else
+          soft_pwm[extruder] = power >> 1;
+      }
+      else {
+        while (count < HEATER_MODEL_MAX_SAMPLES && (long)(ms - next_sample_ms) >= 0) {
+          samples[count++] = last_input + (input - last_input) * (next_sample_ms - last_input_ms) / (ms - last_input_ms);
+          next_sample_ms += interval;
+        }
+      }
+      last_input = input;
+      last_input_ms = ms;
+      if (count > 1 && samples[count - 1] >= temp) break;
+    }
+
+    // Every 2 seconds...
+    if (ms > temp_ms + 2000) {
+      if (extruder < 0)
+        SERIAL_PROTOCOLPGM(MSG_B);
+      else
+        SERIAL_PROTOCOLPGM(MSG_T);
+      SERIAL_PROTOCOL(input);
+      SERIAL_PROTOCOLPGM(MSG_AT);
+      SERIAL_PROTOCOLLN(getHeaterPower(extruder));
+      temp_ms = ms;
+    }
+    lcd_update();
+  }
+
+  if (extruder < 0)
+    soft_pwm_bed = 0;
+  else
+    soft_pwm[extruder] = 0;
+
+  HeaterModel model;
+  if (!HeaterModel__Fit(samples, count, interval / 1000.0, power, &model)) {
+    SERIAL_PROTOCOLLNPGM(MSG_PID_NO_MODEL);
+    return;
+  }
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL);
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL_GAIN);      SERIAL_PROTOCOL_F(model.gain, 4);
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL_TAU);       SERIAL_PROTOCOL(model.tau);
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL_DEAD_TIME); SERIAL_PROTOCOL(model.dead_time);
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL_RMS);       SERIAL_PROTOCOL(model.rms);
+  SERIAL_PROTOCOLPGM(MSG_PID_MODEL_SAMPLES);   SERIAL_PROTOCOLLN((int)model.used);
+
+  float kp, ki, kd;
+  HeaterModel__Gains(&model, &kp, &ki, &kd);
+  SERIAL_PROTOCOLLNPGM(MSG_PID_AUTOTUNE_FINISHED);
+  const char *estring = extruder < 0 ? "bed" : "";
+  SERIAL_PROTOCOLPGM("#define  DEFAULT_"); SERIAL_PROTOCOL(estring); SERIAL_PROTOCOLPGM("Kp "); SERIAL_PROTOCOLLN(kp);
+  SERIAL_PROTOCOLPGM("#define  DEFAULT_"); SERIAL_PROTOCOL(estring); SERIAL_PROTOCOLPGM("Ki "); SERIAL_PROTOCOLLN(ki);
+  SERIAL_PROTOCOLPGM("#define  DEFAULT_"); SERIAL_PROTOCOL(estring); SERIAL_PROTOCOLPGM("Kd "); SERIAL_PROTOCOLLN(kd);
+
+  if (store) {
+    if (extruder < 0) {
+      #if ENABLED(PIDTEMPBED)
+        bedKp = kp;
+        bedKi = scalePID_i(ki);
+        bedKd = scalePID_d(kd);
+      #endif
+    }
+    else {
+      #if ENABLED(PIDTEMP)
+        PID_PARAM(Kp, extruder) = kp;
+        PID_PARAM(Ki, extruder) = scalePID_i(ki);
+        PID_PARAM(Kd, extruder) = scalePID_d(kd);
+      #endif
+    }
+    updatePID();
+    Config_StoreSettings();
+    SERIAL_PROTOCOLLNPGM(MSG_PID_AUTOTUNE_STORED);
+  }
+}
+
+#endif // PID_AUTOTUNE_FOPDT
+
 void updatePID() {
   #if ENABLED(PIDTEMP)
     for (int e = 0; e < EXTRUDERS; e++) {
-      temp_iState_max[e] = PID_INTEGRAL_DRIVE_MAX / PID_PARAM(Ki,e);
+      #if ENABLED(PID_FIXED_POINT)
+        PidFixed__SetGains(&pid_fixed[e], PID_PARAM(Kp,e), PID_PARAM(Ki,e), PID_PARAM(Kd,e), K1, PID_INTEGRAL_DRIVE_MAX, PID_MAX);
+      #else
+        temp_iState_max[e] = PID_INTEGRAL_DRIVE_MAX / PID_PARAM(Ki,e);
+      #endif
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         last_position[e] = 0;
       #endif
     }
   #endif
   #if ENABLED(PIDTEMPBED)
-    temp_iState_max_bed = PID_BED_INTEGRAL_DRIVE_MAX / bedKi;
+    #if ENABLED(PID_FIXED_POINT)
+      PidFixed__SetGains(&pid_fixed_bed, bedKp, bedKi, bedKd, K1, PID_BED_INTEGRAL_DRIVE_MAX, MAX_BED_POWER);
+    #else
+      temp_iState_max_bed = PID_BED_INTEGRAL_DRIVE_MAX / bedKi;
+    #endif
   #endif
 }
 
@@ -547,7 +702,9 @@ void bed_max_temp_error(void) {
 
 #if ENABLED(PNEUMATICS)
   void pneumatic_value_error(void) {
-    #if HAS_PNEUMATIC_PUMP
+    #if ENABLED(PNEUMATIC_PUMP_PWM)
+      PneumaticPump__Off();
+    #elif HAS_PNEUMATIC_PUMP
       WRITE(PNEUMATIC_PUMP_PIN, 0);
     #endif
       pneumatic_error_flag = 1;
@@ -560,8 +717,12 @@ float get_pid_output(int e) {
   #if ENABLED(PIDTEMP)
     #if DISABLED(PID_OPENLOOP)
       pid_error[e] = target_temperature[e] - current_temperature[e];
-      dTerm[e] = K2 * PID_PARAM(Kd,e) * (current_temperature[e] - temp_dState[e]) + K1 * dTerm[e];
-      temp_dState[e] = current_temperature[e];
+      #if ENABLED(PID_FIXED_POINT)
+        PidFixed__Track(&pid_fixed[e], PID_FIXED(current_temperature[e]));
+      #else
+        dTerm[e] = K2 * PID_PARAM(Kd,e) * (current_temperature[e] - temp_dState[e]) + K1 * dTerm[e];
+        temp_dState[e] = current_temperature[e];
+      #endif
       if (pid_error[e] > PID_FUNCTIONAL_RANGE) {
         pid_output = BANG_MAX;
         pid_reset[e] = true;
@@ -572,15 +733,13 @@ float get_pid_output(int e) {
       }
       else {
         if (pid_reset[e]) {
-          temp_iState[e] = 0.0;
+          #if ENABLED(PID_FIXED_POINT)
+            PidFixed__ResetIntegral(&pid_fixed[e]);
+          #else
+            temp_iState[e] = 0.0;
+          #endif
           pid_reset[e] = false;
         }
-        pTerm[e] = PID_PARAM(Kp,e) * pid_error[e];
-        temp_iState[e] += pid_error[e];
-        temp_iState[e] = constrain(temp_iState[e], temp_iState_min[e], temp_iState_max[e]);
-        iTerm[e] = PID_PARAM(Ki,e) * temp_iState[e];
-
-        pid_output = pTerm[e] + iTerm[e] - dTerm[e];
 
         #if ENABLED(PID_ADD_EXTRUSION_RATE)
           cTerm[e] = 0;
@@ -593,19 +752,37 @@ float get_pid_output(int e) {
               lpq[lpq_ptr++] = 0;
             }
             if (lpq_ptr >= lpq_len) lpq_ptr = 0;
-            cTerm[e] = (lpq[lpq_ptr] / axis_steps_per_unit[E_AXIS]) * Kc;
-            pid_output += cTerm[e];
+            cTerm[e] = (lpq[lpq_ptr] / axis_steps_per_unit[E_AXIS]) * PID_PARAM(Kc,e);
           }
         #endif //PID_ADD_EXTRUSION_RATE
 
-        if (pid_output > PID_MAX) {
-          if (pid_error[e] > 0) temp_iState[e] -= pid_error[e]; // conditional un-integration
-          pid_output = PID_MAX;
-        }
-        else if (pid_output < 0) {
-          if (pid_error[e] < 0) temp_iState[e] -= pid_error[e]; // conditional un-integration
-          pid_output = 0;
-        }
+        #if ENABLED(PID_FIXED_POINT)
+          #if ENABLED(PID_ADD_EXTRUSION_RATE)
+            pid_fixed_t feedforward = PID_FIXED(cTerm[e]);
+          #else
+            pid_fixed_t feedforward = 0;
+          #endif
+          pid_output = PidFixed__Output(&pid_fixed[e], PID_FIXED(pid_error[e]), feedforward) >> 16;
+        #else
+          pTerm[e] = PID_PARAM(Kp,e) * pid_error[e];
+          temp_iState[e] += pid_error[e];
+          temp_iState[e] = constrain(temp_iState[e], temp_iState_min[e], temp_iState_max[e]);
+          iTerm[e] = PID_PARAM(Ki,e) * temp_iState[e];
+
+          pid_output = pTerm[e] + iTerm[e] - dTerm[e];
+          #if ENABLED(PID_ADD_EXTRUSION_RATE)
+            pid_output += cTerm[e];
+          #endif
+
+          if (pid_output > PID_MAX) {
+            if (pid_error[e] > 0) temp_iState[e] -= pid_error[e]; // conditional un-integration
+            pid_output = PID_MAX;
+          }
+          else if (pid_output < 0) {
+            if (pid_error[e] < 0) temp_iState[e] -= pid_error[e]; // conditional un-integration
+            pid_output = 0;
+          }
+        #endif // PID_FIXED_POINT
       }
     #else
       pid_output = constrain(target_temperature[e], 0, PID_MAX);
@@ -616,9 +793,15 @@ float get_pid_output(int e) {
       SERIAL_ECHOPAIR(MSG_PID_DEBUG, e);
       SERIAL_ECHOPAIR(MSG_PID_DEBUG_INPUT, current_temperature[e]);
       SERIAL_ECHOPAIR(MSG_PID_DEBUG_OUTPUT, pid_output);
-      SERIAL_ECHOPAIR(MSG_PID_DEBUG_PTERM, pTerm[e]);
-      SERIAL_ECHOPAIR(MSG_PID_DEBUG_ITERM, iTerm[e]);
-      SERIAL_ECHOPAIR(MSG_PID_DEBUG_DTERM, dTerm[e]);
+      #if ENABLED(PID_FIXED_POINT)
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_PTERM, PID_FIXED_TO_FLOAT(pid_fixed[e].p_term));
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_ITERM, PID_FIXED_TO_FLOAT(pid_fixed[e].i_term));
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_DTERM, PID_FIXED_TO_FLOAT(pid_fixed[e].d_term));
+      #else
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_PTERM, pTerm[e]);
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_ITERM, iTerm[e]);
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_DTERM, dTerm[e]);
+      #endif
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         SERIAL_ECHOPAIR(MSG_PID_DEBUG_CTERM, cTerm[e]);
       #endif
@@ -637,23 +820,28 @@ float get_pid_output(int e) {
     float pid_output;
     #if DISABLED(PID_OPENLOOP)
       pid_error_bed = target_temperature_bed - current_temperature_bed;
-      pTerm_bed = bedKp * pid_error_bed;
-      temp_iState_bed += pid_error_bed;
-      temp_iState_bed = constrain(temp_iState_bed, temp_iState_min_bed, temp_iState_max_bed);
-      iTerm_bed = bedKi * temp_iState_bed;
-
-      dTerm_bed = K2 * bedKd * (current_temperature_bed - temp_dState_bed) + K1 * dTerm_bed;
-      temp_dState_bed = current_temperature_bed;
-
-      pid_output = pTerm_bed + iTerm_bed - dTerm_bed;
-      if (pid_output > MAX_BED_POWER) {
-        if (pid_error_bed > 0) temp_iState_bed -= pid_error_bed; // conditional un-integration
-        pid_output = MAX_BED_POWER;
-      }
-      else if (pid_output < 0) {
-        if (pid_error_bed < 0) temp_iState_bed -= pid_error_bed; // conditional un-integration
-        pid_output = 0;
-      }
+      #if ENABLED(PID_FIXED_POINT)
+        PidFixed__Track(&pid_fixed_bed, PID_FIXED(current_temperature_bed));
+        pid_output = PidFixed__Output(&pid_fixed_bed, PID_FIXED(pid_error_bed), 0) >> 16;
+      #else
+        pTerm_bed = bedKp * pid_error_bed;
+        temp_iState_bed += pid_error_bed;
+        temp_iState_bed = constrain(temp_iState_bed, temp_iState_min_bed, temp_iState_max_bed);
+        iTerm_bed = bedKi * temp_iState_bed;
+
+        dTerm_bed = K2 * bedKd * (current_temperature_bed - temp_dState_bed) + K1 * dTerm_bed;
+        temp_dState_bed = current_temperature_bed;
+
+        pid_output = pTerm_bed + iTerm_bed - dTerm_bed;
+        if (pid_output > MAX_BED_POWER) {
+          if (pid_error_bed > 0) temp_iState_bed -= pid_error_bed; // conditional un-integration
+          pid_output = MAX_BED_POWER;
+        }
+        else if (pid_output < 0) {
+          if (pid_error_bed < 0) temp_iState_bed -= pid_error_bed; // conditional un-integration
+          pid_output = 0;
+        }
+      #endif // PID_FIXED_POINT
     #else
       pid_output = constrain(target_temperature_bed, 0, MAX_BED_POWER);
     #endif // PID_OPENLOOP
@@ -665,12 +853,21 @@ float get_pid_output(int e) {
       SERIAL_ECHO(current_temperature_bed);
       SERIAL_PROTOCOLPGM(" Output ");
       SERIAL_ECHO(pid_output);
-      SERIAL_PROTOCOLPGM(" pTerm ");
-      SERIAL_ECHO(pTerm_bed);
-      SERIAL_PROTOCOLPGM(" iTerm ");
-      SERIAL_ECHO(iTerm_bed);
-      SERIAL_PROTOCOLPGM(" dTerm ");
-      SERIAL_ECHOLN(dTerm_bed);
+      #if ENABLED(PID_FIXED_POINT)
+        SERIAL_PROTOCOLPGM(" pTerm ");
+        SERIAL_ECHO(PID_FIXED_TO_FLOAT(pid_fixed_bed.p_term));
+        SERIAL_PROTOCOLPGM(" iTerm ");
+        SERIAL_ECHO(PID_FIXED_TO_FLOAT(pid_fixed_bed.i_term));
+        SERIAL_PROTOCOLPGM(" dTerm ");
+        SERIAL_ECHOLN(PID_FIXED_TO_FLOAT(pid_fixed_bed.d_term));
+      #else
+        SERIAL_PROTOCOLPGM(" pTerm ");
+        SERIAL_ECHO(pTerm_bed);
+        SERIAL_PROTOCOLPGM(" iTerm ");
+        SERIAL_ECHO(iTerm_bed);
+        SERIAL_PROTOCOLPGM(" dTerm ");
+        SERIAL_ECHOLN(dTerm_bed);
+      #endif
     #endif //PID_BED_DEBUG
 
     return pid_output;
@@ -761,7 +958,9 @@ void manage_heater() {
     }
   #endif //FILAMENT_SENSOR
 
-  #if ENABLED(PNEUMATICS)
+  #if ENABLED(PNEUMATIC_PUMP_PWM)
+    PneumaticPump__Update(pressurePneumatic());
+  #elif ENABLED(PNEUMATICS)
   if (millis() - previous_millis_pneumatic_value > PNEUMATIC_CHECK_INTERVAL) {
 
     previous_millis_pneumatic_value = millis();
@@ -788,14 +987,17 @@ void manage_heater() {
   // ELECTRO-PNEUMATIC REGULATOR CONTROL
   #if (ENABLED(E_REGULATOR) && ENABLED(PNEUMATICS))
   if (millis() - previous_millis_regulator_value > REGULATOR_CHECK_INTERVAL) {
+    #if ENABLED(REGULATOR_CLOSED_LOOP)
+      Regulator__Control(pressureRegulator());
+    #endif
     // Updates the regulator protection timers
     Regulator__Update();
     previous_millis_regulator_value = millis();
   }
   // Turn off E-reg if error flag
   if(pneumatic_error_flag == 1) {
-    // Set output pressure to 0
-    DAC_write(MCP4725_I2C_ADDRESS, 0);
+    // Set output pressure to 0, through the regulator so the loop stops too
+    Regulator__SetOutputPressure(0);
     pneumatic_error_flag = 0;
   }
   #endif // E-REGULATOR
@@ -841,7 +1043,6 @@ void manage_heater() {
   #endif //TEMP_SENSOR_BED != 0
 }
 
-#define PGM_RD_W(x)   (short)pgm_read_word(&x)
 // Derived from RepRap FiveD extruder::getTemperature()
 // For hot end temperature measurement.
 static float analog2temp(int raw, uint8_t e) {
@@ -862,26 +1063,9 @@ static float analog2temp(int raw, uint8_t e) {
     if (e == 0) return 0.25 * raw;
   #endif
 
-  if (heater_ttbl_map[e] != NULL) {
-    float celsius = 0;
-    uint8_t i;
-    short (*tt)[][2] = (short (*)[][2])(heater_ttbl_map[e]);
-
-    for (i = 1; i < heater_ttbllen_map[e]; i++) {
-      if (PGM_RD_W((*tt)[i][0]) > raw) {
-        celsius = PGM_RD_W((*tt)[i-1][1]) + 
-          (raw - PGM_RD_W((*tt)[i-1][0])) * 
-          (float)(PGM_RD_W((*tt)[i][1]) - PGM_RD_W((*tt)[i-1][1])) /
-          (float)(PGM_RD_W((*tt)[i][0]) - PGM_RD_W((*tt)[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == heater_ttbllen_map[e]) celsius = PGM_RD_W((*tt)[i-1][1]);
+  if (heater_ttbl_map[e] != NULL)
+    return temptable_lookup((const short (*)[2])heater_ttbl_map[e], heater_tslope_map[e], heater_ttbllen_map[e], raw);
 
-    return celsius;
-  }
   return ((raw * ((5.0 * 100.0) / 1024.0) / OVERSAMPLENR) * TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET;
 }
 
@@ -889,23 +1073,7 @@ static float analog2temp(int raw, uint8_t e) {
 // For bed temperature measurement.
 static float analog2tempBed(int raw) {
   #if ENABLED(BED_USES_THERMISTOR)
-    float celsius = 0;
-    byte i;
-
-    for (i = 1; i < BEDTEMPTABLE_LEN; i++) {
-      if (PGM_RD_W(BEDTEMPTABLE[i][0]) > raw) {
-        celsius  = PGM_RD_W(BEDTEMPTABLE[i-1][1]) + 
-          (raw - PGM_RD_W(BEDTEMPTABLE[i-1][0])) * 
-          (float)(PGM_RD_W(BEDTEMPTABLE[i][1]) - PGM_RD_W(BEDTEMPTABLE[i-1][1])) /
-          (float)(PGM_RD_W(BEDTEMPTABLE[i][0]) - PGM_RD_W(BEDTEMPTABLE[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == BEDTEMPTABLE_LEN) celsius = PGM_RD_W(BEDTEMPTABLE[i-1][1]);
-
-    return celsius;
+    return temptable_lookup(BEDTEMPTABLE, BEDTEMPSLOPES, BEDTEMPTABLE_LEN, raw);
   #elif defined BED_USES_AD595
     return ((raw * ((5.0 * 100.0) / 1024.0) / OVERSAMPLENR) * TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET;
   #else
@@ -914,54 +1082,28 @@ static float analog2tempBed(int raw) {
 }
 
 #if ENABLED(PNEUMATICS)
+// Get pressure reading (psi * 10) from the tank sensor sum
 static float analog2valPneumatic(int raw) {
-    float psi = 0;
-    uint8_t i;
-
-    for (i = 1; i < PRESSURETABLE_LEN; i++)
-    {
-      if (PGM_RD_W(PRESSURETABLE[i][0]) > raw)
-      {
-        psi  = PGM_RD_W(PRESSURETABLE[i-1][1]) + 
-          (raw - PGM_RD_W(PRESSURETABLE[i-1][0])) * 
-          (float)(PGM_RD_W(PRESSURETABLE[i][1]) - PGM_RD_W(PRESSURETABLE[i-1][1])) /
-          (float)(PGM_RD_W(PRESSURETABLE[i][0]) - PGM_RD_W(PRESSURETABLE[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == PRESSURETABLE_LEN) psi = PGM_RD_W(PRESSURETABLE[i-1][1]);
-
-    return psi;
+  return PressureSensor__Convert(pneumatic_segments, PRESSURETABLE_LEN, raw);
 }
 #endif // PNEUMATICS
 
 // Get pressure reading from raw (internal) ADC value
 #if ENABLED(E_REGULATOR)
 static float analog2valRegulator(int raw) {
-    float psi = 0;
-    uint8_t i;
-
-    for (i = 1; i < REGULATORTABLE_LEN; i++)
-    {
-      if (PGM_RD_W(REGULATORTABLE[i][0]) > raw)
-      {
-        psi  = PGM_RD_W(REGULATORTABLE[i-1][1]) + 
-          (raw - PGM_RD_W(REGULATORTABLE[i-1][0])) * 
-          (float)(PGM_RD_W(REGULATORTABLE[i][1]) - PGM_RD_W(REGULATORTABLE[i-1][1])) /
-          (float)(PGM_RD_W(REGULATORTABLE[i][0]) - PGM_RD_W(REGULATORTABLE[i-1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == REGULATORTABLE_LEN) psi = PGM_RD_W(REGULATORTABLE[i-1][1]);
-
-    return psi;
+  return PressureSensor__Convert(regulator_segments, REGULATORTABLE_LEN, raw);
 }
 #endif // E_REGULATOR
 
+#if ENABLED(PNEUMATICS)
+  void reset_pressure_stats() {
+    PressureSensor__StatsReset(&pneumatic_stats);
+    #if ENABLED(E_REGULATOR)
+      PressureSensor__StatsReset(&regulator_stats);
+    #endif
+  }
+#endif
+
 /* Called to get the raw values into the the actual temperatures. The raw values are created in interrupt context,
     and this function is called from normal context as it is too slow to run in interrupts and will block the stepper routine otherwise */
 static void updateTemperaturesFromRawValues() {
@@ -974,9 +1116,11 @@ static void updateTemperaturesFromRawValues() {
   current_temperature_bed = analog2tempBed(current_temperature_bed_raw);
   #if ENABLED(PNEUMATICS)
     current_pneumatic = analog2valPneumatic(current_pneumatic_raw);
+    PressureSensor__StatsAdd(&pneumatic_stats, analog2valPneumatic(pneumatic_unfiltered_raw) / 10.0);
   #endif
   #if ENABLED(E_REGULATOR)
     current_regulator = analog2valRegulator(current_regulator_raw);
+    PressureSensor__StatsAdd(&regulator_stats, analog2valRegulator(regulator_unfiltered_raw) / 10.0);
   #endif
   #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
     redundant_temperature = analog2temp(redundant_temperature_raw, 1);
@@ -1028,15 +1172,23 @@ void tp_init() {
     // populate with the first value 
     maxttemp[e] = maxttemp[0];
     #if ENABLED(PIDTEMP)
-      temp_iState_min[e] = 0.0;
-      temp_iState_max[e] = PID_INTEGRAL_DRIVE_MAX / PID_PARAM(Ki,e);
+      #if ENABLED(PID_FIXED_POINT)
+        PidFixed__SetGains(&pid_fixed[e], PID_PARAM(Kp,e), PID_PARAM(Ki,e), PID_PARAM(Kd,e), K1, PID_INTEGRAL_DRIVE_MAX, PID_MAX);
+      #else
+        temp_iState_min[e] = 0.0;
+        temp_iState_max[e] = PID_INTEGRAL_DRIVE_MAX / PID_PARAM(Ki,e);
+      #endif
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         last_position[e] = 0;
       #endif
     #endif //PIDTEMP
     #if ENABLED(PIDTEMPBED)
-      temp_iState_min_bed = 0.0;
-      temp_iState_max_bed = PID_BED_INTEGRAL_DRIVE_MAX / bedKi;
+      #if ENABLED(PID_FIXED_POINT)
+        PidFixed__SetGains(&pid_fixed_bed, bedKp, bedKi, bedKd, K1, PID_BED_INTEGRAL_DRIVE_MAX, MAX_BED_POWER);
+      #else
+        temp_iState_min_bed = 0.0;
+        temp_iState_max_bed = PID_BED_INTEGRAL_DRIVE_MAX / bedKi;
+      #endif
     #endif //PIDTEMPBED
   }
 
@@ -1205,6 +1357,16 @@ void tp_init() {
     }
   #endif //BED_MAXTEMP
 
+  #if ENABLED(PNEUMATICS)
+    PressureSensor__BuildSegments(PRESSURETABLE, PRESSURETABLE_LEN, pneumatic_segments);
+  #endif
+  #if ENABLED(E_REGULATOR)
+    PressureSensor__BuildSegments(REGULATORTABLE, REGULATORTABLE_LEN, regulator_segments);
+  #endif
+  #if ENABLED(PNEUMATICS)
+    reset_pressure_stats();
+  #endif
+
   #ifdef PNEUMATIC_MIN
     while(analog2valPneumatic(pneumatic_min_raw) < PNEUMATIC_MIN) {
       pneumatic_min_raw += OVERSAMPLENR;
@@ -1343,7 +1505,9 @@ void disable_all_heaters() {
 
   #if HAS_PNEUMATIC
     target_value_pneumatic = 0;
-    #if HAS_PNEUMATIC_PUMP
+    #if ENABLED(PNEUMATIC_PUMP_PWM)
+      PneumaticPump__Off();
+    #elif HAS_PNEUMATIC_PUMP
       WRITE(PNEUMATIC_PUMP_PIN, LOW);
     #endif
   #endif
@@ -1438,6 +1602,8 @@ static unsigned long raw_temp_value[4] = { 0 };
 static unsigned long raw_temp_bed_value = 0;
 static unsigned long raw_pneumatic_value = 0;
 static unsigned long raw_regulator_value = 0;
+static unsigned long raw_pneumatic_unfiltered = 0;
+static unsigned long raw_regulator_unfiltered = 0;
 
 static void set_current_temp_raw() {
   #if HAS_TEMP_0 && DISABLED(HEATER_0_USES_MAX6675)
@@ -1459,6 +1625,12 @@ static void set_current_temp_raw() {
   current_temperature_bed_raw = raw_temp_bed_value;
   current_pneumatic_raw = raw_pneumatic_value;
   current_regulator_raw = raw_regulator_value;
+  #if ENABLED(PNEUMATICS)
+    pneumatic_unfiltered_raw = raw_pneumatic_unfiltered;
+  #endif
+  #if ENABLED(E_REGULATOR)
+    regulator_unfiltered_raw = raw_regulator_unfiltered;
+  #endif
   temp_meas_ready = true;
 }
 
@@ -1810,6 +1982,17 @@ ISR(TIMER0_COMPB_vect) {
   } // switch(temp_state)
 
   if (temp_count >= OVERSAMPLENR) { // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+    // Filter the pressure sums every time, so the filters keep their pace
+    // even while manage_heater() is late
+    #if ENABLED(PNEUMATICS)
+      raw_pneumatic_unfiltered = raw_pneumatic_value;
+      raw_pneumatic_value = PressureSensor__Filter(&pneumatic_filter, PNEUMATIC_FILTER, raw_pneumatic_value);
+    #endif
+    #if ENABLED(E_REGULATOR)
+      raw_regulator_unfiltered = raw_regulator_value;
+      raw_regulator_value = PressureSensor__Filter(&regulator_filter, REGULATOR_FILTER, raw_regulator_value);
+    #endif
+
     // Update the raw values if they've been read. Else we could be updating them during reading.
     if (!temp_meas_ready) set_current_temp_raw();
 
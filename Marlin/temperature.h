@@ -23,6 +23,7 @@
 
 #include "Marlin.h"
 #include "planner.h"
+#include "PressureSensor.h"
 #if ENABLED(PID_ADD_EXTRUSION_RATE)
   #include "stepper.h"
 #endif
@@ -55,6 +56,15 @@ extern float current_temperature[4];
   extern float current_regulator;
 #endif
 
+#if ENABLED(PNEUMATICS)
+  // Statistics of the unfiltered readings in psi, for M249
+  extern PressureStats pneumatic_stats;
+  #if ENABLED(E_REGULATOR)
+    extern PressureStats regulator_stats;
+  #endif
+  void reset_pressure_stats();
+#endif
+
 #if ENABLED(SHOW_TEMP_ADC_VALUES)
   extern int current_temperature_raw[4];
   extern int current_temperature_bed_raw;
@@ -166,6 +176,9 @@ void disable_all_heaters();
 void updatePID();
 
 void PID_autotune(float temp, int extruder, int ncycles);
+#if ENABLED(PID_AUTOTUNE_FOPDT)
+  void PID_autotune_step(float temp, int extruder, bool store);
+#endif
 
 void setExtruderAutoFanState(int pin, bool state);
 void checkExtruderAutoFans();
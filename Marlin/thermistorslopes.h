@@ -0,0 +1,1060 @@
+/**
+ * thermistorslopes.h - Segment slopes of the tables in thermistortables.h
+ *
+ * Generated by scripts/createThermistorSlopes.py. Do not edit; run the
+ * script again when a table changes. Entry i holds the slope from entry i
+ * to entry i + 1 of the table, in degrees per raw count; the last one is 0
+ * as the value is held from the last entry on.
+ */
+
+#ifndef THERMISTORSLOPES_H_
+#define THERMISTORSLOPES_H_
+
+// Equal raw values never get picked as a segment, so their slope is 0
+#define TSLOPE(x0, y0, x1, y1) ((short)(x1) == (short)(x0) ? 0.0 : \
+  (float)((y1) - (y0)) / (float)((short)(x1) - (short)(x0)))
+
+#if (THERMISTORHEATER_0 == 1) || (THERMISTORHEATER_1 == 1)  || (THERMISTORHEATER_2 == 1) || (THERMISTORHEATER_3 == 1) || (THERMISTORBED == 1) //100k bed thermistor
+const float tempslope_1[] PROGMEM = {
+  TSLOPE(23*OVERSAMPLENR, 300, 25*OVERSAMPLENR, 295),
+  TSLOPE(25*OVERSAMPLENR, 295, 27*OVERSAMPLENR, 290),
+  TSLOPE(27*OVERSAMPLENR, 290, 28*OVERSAMPLENR, 285),
+  TSLOPE(28*OVERSAMPLENR, 285, 31*OVERSAMPLENR, 280),
+  TSLOPE(31*OVERSAMPLENR, 280, 33*OVERSAMPLENR, 275),
+  TSLOPE(33*OVERSAMPLENR, 275, 35*OVERSAMPLENR, 270),
+  TSLOPE(35*OVERSAMPLENR, 270, 38*OVERSAMPLENR, 265),
+  TSLOPE(38*OVERSAMPLENR, 265, 41*OVERSAMPLENR, 260),
+  TSLOPE(41*OVERSAMPLENR, 260, 44*OVERSAMPLENR, 255),
+  TSLOPE(44*OVERSAMPLENR, 255, 48*OVERSAMPLENR, 250),
+  TSLOPE(48*OVERSAMPLENR, 250, 52*OVERSAMPLENR, 245),
+  TSLOPE(52*OVERSAMPLENR, 245, 56*OVERSAMPLENR, 240),
+  TSLOPE(56*OVERSAMPLENR, 240, 61*OVERSAMPLENR, 235),
+  TSLOPE(61*OVERSAMPLENR, 235, 66*OVERSAMPLENR, 230),
+  TSLOPE(66*OVERSAMPLENR, 230, 71*OVERSAMPLENR, 225),
+  TSLOPE(71*OVERSAMPLENR, 225, 78*OVERSAMPLENR, 220),
+  TSLOPE(78*OVERSAMPLENR, 220, 84*OVERSAMPLENR, 215),
+  TSLOPE(84*OVERSAMPLENR, 215, 92*OVERSAMPLENR, 210),
+  TSLOPE(92*OVERSAMPLENR, 210, 100*OVERSAMPLENR, 205),
+  TSLOPE(100*OVERSAMPLENR, 205, 109*OVERSAMPLENR, 200),
+  TSLOPE(109*OVERSAMPLENR, 200, 120*OVERSAMPLENR, 195),
+  TSLOPE(120*OVERSAMPLENR, 195, 131*OVERSAMPLENR, 190),
+  TSLOPE(131*OVERSAMPLENR, 190, 143*OVERSAMPLENR, 185),
+  TSLOPE(143*OVERSAMPLENR, 185, 156*OVERSAMPLENR, 180),
+  TSLOPE(156*OVERSAMPLENR, 180, 171*OVERSAMPLENR, 175),
+  TSLOPE(171*OVERSAMPLENR, 175, 187*OVERSAMPLENR, 170),
+  TSLOPE(187*OVERSAMPLENR, 170, 205*OVERSAMPLENR, 165),
+  TSLOPE(205*OVERSAMPLENR, 165, 224*OVERSAMPLENR, 160),
+  TSLOPE(224*OVERSAMPLENR, 160, 245*OVERSAMPLENR, 155),
+  TSLOPE(245*OVERSAMPLENR, 155, 268*OVERSAMPLENR, 150),
+  TSLOPE(268*OVERSAMPLENR, 150, 293*OVERSAMPLENR, 145),
+  TSLOPE(293*OVERSAMPLENR, 145, 320*OVERSAMPLENR, 140),
+  TSLOPE(320*OVERSAMPLENR, 140, 348*OVERSAMPLENR, 135),
+  TSLOPE(348*OVERSAMPLENR, 135, 379*OVERSAMPLENR, 130),
+  TSLOPE(379*OVERSAMPLENR, 130, 411*OVERSAMPLENR, 125),
+  TSLOPE(411*OVERSAMPLENR, 125, 445*OVERSAMPLENR, 120),
+  TSLOPE(445*OVERSAMPLENR, 120, 480*OVERSAMPLENR, 115),
+  TSLOPE(480*OVERSAMPLENR, 115, 516*OVERSAMPLENR, 110),
+  TSLOPE(516*OVERSAMPLENR, 110, 553*OVERSAMPLENR, 105),
+  TSLOPE(553*OVERSAMPLENR, 105, 591*OVERSAMPLENR, 100),
+  TSLOPE(591*OVERSAMPLENR, 100, 628*OVERSAMPLENR, 95),
+  TSLOPE(628*OVERSAMPLENR, 95, 665*OVERSAMPLENR, 90),
+  TSLOPE(665*OVERSAMPLENR, 90, 702*OVERSAMPLENR, 85),
+  TSLOPE(702*OVERSAMPLENR, 85, 737*OVERSAMPLENR, 80),
+  TSLOPE(737*OVERSAMPLENR, 80, 770*OVERSAMPLENR, 75),
+  TSLOPE(770*OVERSAMPLENR, 75, 801*OVERSAMPLENR, 70),
+  TSLOPE(801*OVERSAMPLENR, 70, 830*OVERSAMPLENR, 65),
+  TSLOPE(830*OVERSAMPLENR, 65, 857*OVERSAMPLENR, 60),
+  TSLOPE(857*OVERSAMPLENR, 60, 881*OVERSAMPLENR, 55),
+  TSLOPE(881*OVERSAMPLENR, 55, 903*OVERSAMPLENR, 50),
+  TSLOPE(903*OVERSAMPLENR, 50, 922*OVERSAMPLENR, 45),
+  TSLOPE(922*OVERSAMPLENR, 45, 939*OVERSAMPLENR, 40),
+  TSLOPE(939*OVERSAMPLENR, 40, 954*OVERSAMPLENR, 35),
+  TSLOPE(954*OVERSAMPLENR, 35, 966*OVERSAMPLENR, 30),
+  TSLOPE(966*OVERSAMPLENR, 30, 977*OVERSAMPLENR, 25),
+  TSLOPE(977*OVERSAMPLENR, 25, 985*OVERSAMPLENR, 20),
+  TSLOPE(985*OVERSAMPLENR, 20, 993*OVERSAMPLENR, 15),
+  TSLOPE(993*OVERSAMPLENR, 15, 999*OVERSAMPLENR, 10),
+  TSLOPE(999*OVERSAMPLENR, 10, 1004*OVERSAMPLENR, 5),
+  TSLOPE(1004*OVERSAMPLENR, 5, 1008*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 2) || (THERMISTORHEATER_1 == 2) || (THERMISTORHEATER_2 == 2) || (THERMISTORHEATER_3 == 2) || (THERMISTORBED == 2) //200k bed thermistor
+const float tempslope_2[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 848, 30*OVERSAMPLENR, 300),
+  TSLOPE(30*OVERSAMPLENR, 300, 34*OVERSAMPLENR, 290),
+  TSLOPE(34*OVERSAMPLENR, 290, 39*OVERSAMPLENR, 280),
+  TSLOPE(39*OVERSAMPLENR, 280, 46*OVERSAMPLENR, 270),
+  TSLOPE(46*OVERSAMPLENR, 270, 53*OVERSAMPLENR, 260),
+  TSLOPE(53*OVERSAMPLENR, 260, 63*OVERSAMPLENR, 250),
+  TSLOPE(63*OVERSAMPLENR, 250, 74*OVERSAMPLENR, 240),
+  TSLOPE(74*OVERSAMPLENR, 240, 87*OVERSAMPLENR, 230),
+  TSLOPE(87*OVERSAMPLENR, 230, 104*OVERSAMPLENR, 220),
+  TSLOPE(104*OVERSAMPLENR, 220, 124*OVERSAMPLENR, 210),
+  TSLOPE(124*OVERSAMPLENR, 210, 148*OVERSAMPLENR, 200),
+  TSLOPE(148*OVERSAMPLENR, 200, 176*OVERSAMPLENR, 190),
+  TSLOPE(176*OVERSAMPLENR, 190, 211*OVERSAMPLENR, 180),
+  TSLOPE(211*OVERSAMPLENR, 180, 252*OVERSAMPLENR, 170),
+  TSLOPE(252*OVERSAMPLENR, 170, 301*OVERSAMPLENR, 160),
+  TSLOPE(301*OVERSAMPLENR, 160, 357*OVERSAMPLENR, 150),
+  TSLOPE(357*OVERSAMPLENR, 150, 420*OVERSAMPLENR, 140),
+  TSLOPE(420*OVERSAMPLENR, 140, 489*OVERSAMPLENR, 130),
+  TSLOPE(489*OVERSAMPLENR, 130, 562*OVERSAMPLENR, 120),
+  TSLOPE(562*OVERSAMPLENR, 120, 636*OVERSAMPLENR, 110),
+  TSLOPE(636*OVERSAMPLENR, 110, 708*OVERSAMPLENR, 100),
+  TSLOPE(708*OVERSAMPLENR, 100, 775*OVERSAMPLENR, 90),
+  TSLOPE(775*OVERSAMPLENR, 90, 835*OVERSAMPLENR, 80),
+  TSLOPE(835*OVERSAMPLENR, 80, 884*OVERSAMPLENR, 70),
+  TSLOPE(884*OVERSAMPLENR, 70, 924*OVERSAMPLENR, 60),
+  TSLOPE(924*OVERSAMPLENR, 60, 955*OVERSAMPLENR, 50),
+  TSLOPE(955*OVERSAMPLENR, 50, 977*OVERSAMPLENR, 40),
+  TSLOPE(977*OVERSAMPLENR, 40, 993*OVERSAMPLENR, 30),
+  TSLOPE(993*OVERSAMPLENR, 30, 1004*OVERSAMPLENR, 20),
+  TSLOPE(1004*OVERSAMPLENR, 20, 1012*OVERSAMPLENR, 10),
+  TSLOPE(1012*OVERSAMPLENR, 10, 1016*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 3) || (THERMISTORHEATER_1 == 3) || (THERMISTORHEATER_2 == 3) || (THERMISTORHEATER_3 == 3) || (THERMISTORBED == 3) //mendel-parts
+const float tempslope_3[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 864, 21*OVERSAMPLENR, 300),
+  TSLOPE(21*OVERSAMPLENR, 300, 25*OVERSAMPLENR, 290),
+  TSLOPE(25*OVERSAMPLENR, 290, 29*OVERSAMPLENR, 280),
+  TSLOPE(29*OVERSAMPLENR, 280, 33*OVERSAMPLENR, 270),
+  TSLOPE(33*OVERSAMPLENR, 270, 39*OVERSAMPLENR, 260),
+  TSLOPE(39*OVERSAMPLENR, 260, 46*OVERSAMPLENR, 250),
+  TSLOPE(46*OVERSAMPLENR, 250, 54*OVERSAMPLENR, 240),
+  TSLOPE(54*OVERSAMPLENR, 240, 64*OVERSAMPLENR, 230),
+  TSLOPE(64*OVERSAMPLENR, 230, 75*OVERSAMPLENR, 220),
+  TSLOPE(75*OVERSAMPLENR, 220, 90*OVERSAMPLENR, 210),
+  TSLOPE(90*OVERSAMPLENR, 210, 107*OVERSAMPLENR, 200),
+  TSLOPE(107*OVERSAMPLENR, 200, 128*OVERSAMPLENR, 190),
+  TSLOPE(128*OVERSAMPLENR, 190, 154*OVERSAMPLENR, 180),
+  TSLOPE(154*OVERSAMPLENR, 180, 184*OVERSAMPLENR, 170),
+  TSLOPE(184*OVERSAMPLENR, 170, 221*OVERSAMPLENR, 160),
+  TSLOPE(221*OVERSAMPLENR, 160, 265*OVERSAMPLENR, 150),
+  TSLOPE(265*OVERSAMPLENR, 150, 316*OVERSAMPLENR, 140),
+  TSLOPE(316*OVERSAMPLENR, 140, 375*OVERSAMPLENR, 130),
+  TSLOPE(375*OVERSAMPLENR, 130, 441*OVERSAMPLENR, 120),
+  TSLOPE(441*OVERSAMPLENR, 120, 513*OVERSAMPLENR, 110),
+  TSLOPE(513*OVERSAMPLENR, 110, 588*OVERSAMPLENR, 100),
+  TSLOPE(588*OVERSAMPLENR, 100, 734*OVERSAMPLENR, 80),
+  TSLOPE(734*OVERSAMPLENR, 80, 856*OVERSAMPLENR, 60),
+  TSLOPE(856*OVERSAMPLENR, 60, 938*OVERSAMPLENR, 40),
+  TSLOPE(938*OVERSAMPLENR, 40, 986*OVERSAMPLENR, 20),
+  TSLOPE(986*OVERSAMPLENR, 20, 1008*OVERSAMPLENR, 0),
+  TSLOPE(1008*OVERSAMPLENR, 0, 1018*OVERSAMPLENR, -20),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 4) || (THERMISTORHEATER_1 == 4) || (THERMISTORHEATER_2 == 4) || (THERMISTORHEATER_3 == 4) || (THERMISTORBED == 4) //10k thermistor
+const float tempslope_4[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 430, 54*OVERSAMPLENR, 137),
+  TSLOPE(54*OVERSAMPLENR, 137, 107*OVERSAMPLENR, 107),
+  TSLOPE(107*OVERSAMPLENR, 107, 160*OVERSAMPLENR, 91),
+  TSLOPE(160*OVERSAMPLENR, 91, 213*OVERSAMPLENR, 80),
+  TSLOPE(213*OVERSAMPLENR, 80, 266*OVERSAMPLENR, 71),
+  TSLOPE(266*OVERSAMPLENR, 71, 319*OVERSAMPLENR, 64),
+  TSLOPE(319*OVERSAMPLENR, 64, 372*OVERSAMPLENR, 57),
+  TSLOPE(372*OVERSAMPLENR, 57, 425*OVERSAMPLENR, 51),
+  TSLOPE(425*OVERSAMPLENR, 51, 478*OVERSAMPLENR, 46),
+  TSLOPE(478*OVERSAMPLENR, 46, 531*OVERSAMPLENR, 41),
+  TSLOPE(531*OVERSAMPLENR, 41, 584*OVERSAMPLENR, 35),
+  TSLOPE(584*OVERSAMPLENR, 35, 637*OVERSAMPLENR, 30),
+  TSLOPE(637*OVERSAMPLENR, 30, 690*OVERSAMPLENR, 25),
+  TSLOPE(690*OVERSAMPLENR, 25, 743*OVERSAMPLENR, 20),
+  TSLOPE(743*OVERSAMPLENR, 20, 796*OVERSAMPLENR, 14),
+  TSLOPE(796*OVERSAMPLENR, 14, 849*OVERSAMPLENR, 7),
+  TSLOPE(849*OVERSAMPLENR, 7, 902*OVERSAMPLENR, 0),
+  TSLOPE(902*OVERSAMPLENR, 0, 955*OVERSAMPLENR, -11),
+  TSLOPE(955*OVERSAMPLENR, -11, 1008*OVERSAMPLENR, -35),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 5) || (THERMISTORHEATER_1 == 5) || (THERMISTORHEATER_2 == 5) || (THERMISTORHEATER_3 == 5) || (THERMISTORBED == 5) //100k ParCan thermistor (104GT-2)
+const float tempslope_5[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 713, 17*OVERSAMPLENR, 300),
+  TSLOPE(17*OVERSAMPLENR, 300, 20*OVERSAMPLENR, 290),
+  TSLOPE(20*OVERSAMPLENR, 290, 23*OVERSAMPLENR, 280),
+  TSLOPE(23*OVERSAMPLENR, 280, 27*OVERSAMPLENR, 270),
+  TSLOPE(27*OVERSAMPLENR, 270, 31*OVERSAMPLENR, 260),
+  TSLOPE(31*OVERSAMPLENR, 260, 37*OVERSAMPLENR, 250),
+  TSLOPE(37*OVERSAMPLENR, 250, 43*OVERSAMPLENR, 240),
+  TSLOPE(43*OVERSAMPLENR, 240, 51*OVERSAMPLENR, 230),
+  TSLOPE(51*OVERSAMPLENR, 230, 61*OVERSAMPLENR, 220),
+  TSLOPE(61*OVERSAMPLENR, 220, 73*OVERSAMPLENR, 210),
+  TSLOPE(73*OVERSAMPLENR, 210, 87*OVERSAMPLENR, 200),
+  TSLOPE(87*OVERSAMPLENR, 200, 106*OVERSAMPLENR, 190),
+  TSLOPE(106*OVERSAMPLENR, 190, 128*OVERSAMPLENR, 180),
+  TSLOPE(128*OVERSAMPLENR, 180, 155*OVERSAMPLENR, 170),
+  TSLOPE(155*OVERSAMPLENR, 170, 189*OVERSAMPLENR, 160),
+  TSLOPE(189*OVERSAMPLENR, 160, 230*OVERSAMPLENR, 150),
+  TSLOPE(230*OVERSAMPLENR, 150, 278*OVERSAMPLENR, 140),
+  TSLOPE(278*OVERSAMPLENR, 140, 336*OVERSAMPLENR, 130),
+  TSLOPE(336*OVERSAMPLENR, 130, 402*OVERSAMPLENR, 120),
+  TSLOPE(402*OVERSAMPLENR, 120, 476*OVERSAMPLENR, 110),
+  TSLOPE(476*OVERSAMPLENR, 110, 554*OVERSAMPLENR, 100),
+  TSLOPE(554*OVERSAMPLENR, 100, 635*OVERSAMPLENR, 90),
+  TSLOPE(635*OVERSAMPLENR, 90, 713*OVERSAMPLENR, 80),
+  TSLOPE(713*OVERSAMPLENR, 80, 784*OVERSAMPLENR, 70),
+  TSLOPE(784*OVERSAMPLENR, 70, 846*OVERSAMPLENR, 60),
+  TSLOPE(846*OVERSAMPLENR, 60, 897*OVERSAMPLENR, 50),
+  TSLOPE(897*OVERSAMPLENR, 50, 937*OVERSAMPLENR, 40),
+  TSLOPE(937*OVERSAMPLENR, 40, 966*OVERSAMPLENR, 30),
+  TSLOPE(966*OVERSAMPLENR, 30, 986*OVERSAMPLENR, 20),
+  TSLOPE(986*OVERSAMPLENR, 20, 1000*OVERSAMPLENR, 10),
+  TSLOPE(1000*OVERSAMPLENR, 10, 1010*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 6) || (THERMISTORHEATER_1 == 6) || (THERMISTORHEATER_2 == 6) || (THERMISTORHEATER_3 == 6) || (THERMISTORBED == 6) // 100k Epcos thermistor
+const float tempslope_6[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 350, 28*OVERSAMPLENR, 250),
+  TSLOPE(28*OVERSAMPLENR, 250, 31*OVERSAMPLENR, 245),
+  TSLOPE(31*OVERSAMPLENR, 245, 35*OVERSAMPLENR, 240),
+  TSLOPE(35*OVERSAMPLENR, 240, 39*OVERSAMPLENR, 235),
+  TSLOPE(39*OVERSAMPLENR, 235, 42*OVERSAMPLENR, 230),
+  TSLOPE(42*OVERSAMPLENR, 230, 44*OVERSAMPLENR, 225),
+  TSLOPE(44*OVERSAMPLENR, 225, 49*OVERSAMPLENR, 220),
+  TSLOPE(49*OVERSAMPLENR, 220, 53*OVERSAMPLENR, 215),
+  TSLOPE(53*OVERSAMPLENR, 215, 62*OVERSAMPLENR, 210),
+  TSLOPE(62*OVERSAMPLENR, 210, 71*OVERSAMPLENR, 205),
+  TSLOPE(71*OVERSAMPLENR, 205, 78*OVERSAMPLENR, 200),
+  TSLOPE(78*OVERSAMPLENR, 200, 94*OVERSAMPLENR, 190),
+  TSLOPE(94*OVERSAMPLENR, 190, 102*OVERSAMPLENR, 185),
+  TSLOPE(102*OVERSAMPLENR, 185, 116*OVERSAMPLENR, 170),
+  TSLOPE(116*OVERSAMPLENR, 170, 143*OVERSAMPLENR, 160),
+  TSLOPE(143*OVERSAMPLENR, 160, 183*OVERSAMPLENR, 150),
+  TSLOPE(183*OVERSAMPLENR, 150, 223*OVERSAMPLENR, 140),
+  TSLOPE(223*OVERSAMPLENR, 140, 270*OVERSAMPLENR, 130),
+  TSLOPE(270*OVERSAMPLENR, 130, 318*OVERSAMPLENR, 120),
+  TSLOPE(318*OVERSAMPLENR, 120, 383*OVERSAMPLENR, 110),
+  TSLOPE(383*OVERSAMPLENR, 110, 413*OVERSAMPLENR, 105),
+  TSLOPE(413*OVERSAMPLENR, 105, 439*OVERSAMPLENR, 100),
+  TSLOPE(439*OVERSAMPLENR, 100, 484*OVERSAMPLENR, 95),
+  TSLOPE(484*OVERSAMPLENR, 95, 513*OVERSAMPLENR, 90),
+  TSLOPE(513*OVERSAMPLENR, 90, 607*OVERSAMPLENR, 80),
+  TSLOPE(607*OVERSAMPLENR, 80, 664*OVERSAMPLENR, 70),
+  TSLOPE(664*OVERSAMPLENR, 70, 781*OVERSAMPLENR, 60),
+  TSLOPE(781*OVERSAMPLENR, 60, 810*OVERSAMPLENR, 55),
+  TSLOPE(810*OVERSAMPLENR, 55, 849*OVERSAMPLENR, 50),
+  TSLOPE(849*OVERSAMPLENR, 50, 914*OVERSAMPLENR, 45),
+  TSLOPE(914*OVERSAMPLENR, 45, 914*OVERSAMPLENR, 40),
+  TSLOPE(914*OVERSAMPLENR, 40, 935*OVERSAMPLENR, 35),
+  TSLOPE(935*OVERSAMPLENR, 35, 954*OVERSAMPLENR, 30),
+  TSLOPE(954*OVERSAMPLENR, 30, 970*OVERSAMPLENR, 25),
+  TSLOPE(970*OVERSAMPLENR, 25, 978*OVERSAMPLENR, 22),
+  TSLOPE(978*OVERSAMPLENR, 22, 1008*OVERSAMPLENR, 3),
+  TSLOPE(1008*OVERSAMPLENR, 3, 1023*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 7) || (THERMISTORHEATER_1 == 7) || (THERMISTORHEATER_2 == 7) || (THERMISTORHEATER_3 == 7) || (THERMISTORBED == 7) // 100k Honeywell 135-104LAG-J01
+const float tempslope_7[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 941, 19*OVERSAMPLENR, 362),
+  TSLOPE(19*OVERSAMPLENR, 362, 37*OVERSAMPLENR, 299),
+  TSLOPE(37*OVERSAMPLENR, 299, 55*OVERSAMPLENR, 266),
+  TSLOPE(55*OVERSAMPLENR, 266, 73*OVERSAMPLENR, 245),
+  TSLOPE(73*OVERSAMPLENR, 245, 91*OVERSAMPLENR, 229),
+  TSLOPE(91*OVERSAMPLENR, 229, 109*OVERSAMPLENR, 216),
+  TSLOPE(109*OVERSAMPLENR, 216, 127*OVERSAMPLENR, 206),
+  TSLOPE(127*OVERSAMPLENR, 206, 145*OVERSAMPLENR, 197),
+  TSLOPE(145*OVERSAMPLENR, 197, 163*OVERSAMPLENR, 190),
+  TSLOPE(163*OVERSAMPLENR, 190, 181*OVERSAMPLENR, 183),
+  TSLOPE(181*OVERSAMPLENR, 183, 199*OVERSAMPLENR, 177),
+  TSLOPE(199*OVERSAMPLENR, 177, 217*OVERSAMPLENR, 171),
+  TSLOPE(217*OVERSAMPLENR, 171, 235*OVERSAMPLENR, 166),
+  TSLOPE(235*OVERSAMPLENR, 166, 253*OVERSAMPLENR, 162),
+  TSLOPE(253*OVERSAMPLENR, 162, 271*OVERSAMPLENR, 157),
+  TSLOPE(271*OVERSAMPLENR, 157, 289*OVERSAMPLENR, 153),
+  TSLOPE(289*OVERSAMPLENR, 153, 307*OVERSAMPLENR, 149),
+  TSLOPE(307*OVERSAMPLENR, 149, 325*OVERSAMPLENR, 146),
+  TSLOPE(325*OVERSAMPLENR, 146, 343*OVERSAMPLENR, 142),
+  TSLOPE(343*OVERSAMPLENR, 142, 361*OVERSAMPLENR, 139),
+  TSLOPE(361*OVERSAMPLENR, 139, 379*OVERSAMPLENR, 135),
+  TSLOPE(379*OVERSAMPLENR, 135, 397*OVERSAMPLENR, 132),
+  TSLOPE(397*OVERSAMPLENR, 132, 415*OVERSAMPLENR, 129),
+  TSLOPE(415*OVERSAMPLENR, 129, 433*OVERSAMPLENR, 126),
+  TSLOPE(433*OVERSAMPLENR, 126, 451*OVERSAMPLENR, 123),
+  TSLOPE(451*OVERSAMPLENR, 123, 469*OVERSAMPLENR, 121),
+  TSLOPE(469*OVERSAMPLENR, 121, 487*OVERSAMPLENR, 118),
+  TSLOPE(487*OVERSAMPLENR, 118, 505*OVERSAMPLENR, 115),
+  TSLOPE(505*OVERSAMPLENR, 115, 523*OVERSAMPLENR, 112),
+  TSLOPE(523*OVERSAMPLENR, 112, 541*OVERSAMPLENR, 110),
+  TSLOPE(541*OVERSAMPLENR, 110, 559*OVERSAMPLENR, 107),
+  TSLOPE(559*OVERSAMPLENR, 107, 577*OVERSAMPLENR, 105),
+  TSLOPE(577*OVERSAMPLENR, 105, 595*OVERSAMPLENR, 102),
+  TSLOPE(595*OVERSAMPLENR, 102, 613*OVERSAMPLENR, 99),
+  TSLOPE(613*OVERSAMPLENR, 99, 631*OVERSAMPLENR, 97),
+  TSLOPE(631*OVERSAMPLENR, 97, 649*OVERSAMPLENR, 94),
+  TSLOPE(649*OVERSAMPLENR, 94, 667*OVERSAMPLENR, 92),
+  TSLOPE(667*OVERSAMPLENR, 92, 685*OVERSAMPLENR, 89),
+  TSLOPE(685*OVERSAMPLENR, 89, 703*OVERSAMPLENR, 86),
+  TSLOPE(703*OVERSAMPLENR, 86, 721*OVERSAMPLENR, 84),
+  TSLOPE(721*OVERSAMPLENR, 84, 739*OVERSAMPLENR, 81),
+  TSLOPE(739*OVERSAMPLENR, 81, 757*OVERSAMPLENR, 78),
+  TSLOPE(757*OVERSAMPLENR, 78, 775*OVERSAMPLENR, 75),
+  TSLOPE(775*OVERSAMPLENR, 75, 793*OVERSAMPLENR, 72),
+  TSLOPE(793*OVERSAMPLENR, 72, 811*OVERSAMPLENR, 69),
+  TSLOPE(811*OVERSAMPLENR, 69, 829*OVERSAMPLENR, 66),
+  TSLOPE(829*OVERSAMPLENR, 66, 847*OVERSAMPLENR, 62),
+  TSLOPE(847*OVERSAMPLENR, 62, 865*OVERSAMPLENR, 59),
+  TSLOPE(865*OVERSAMPLENR, 59, 883*OVERSAMPLENR, 55),
+  TSLOPE(883*OVERSAMPLENR, 55, 901*OVERSAMPLENR, 51),
+  TSLOPE(901*OVERSAMPLENR, 51, 919*OVERSAMPLENR, 46),
+  TSLOPE(919*OVERSAMPLENR, 46, 937*OVERSAMPLENR, 41),
+  TSLOPE(937*OVERSAMPLENR, 41, 955*OVERSAMPLENR, 35),
+  TSLOPE(955*OVERSAMPLENR, 35, 973*OVERSAMPLENR, 27),
+  TSLOPE(973*OVERSAMPLENR, 27, 991*OVERSAMPLENR, 17),
+  TSLOPE(991*OVERSAMPLENR, 17, 1009*OVERSAMPLENR, 1),
+  TSLOPE(1009*OVERSAMPLENR, 1, 1023*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 71) || (THERMISTORHEATER_1 == 71) || (THERMISTORHEATER_2 == 71) || (THERMISTORHEATER_3 == 71) || (THERMISTORBED == 71) // 100k Honeywell 135-104LAF-J01
+const float tempslope_71[] PROGMEM = {
+  TSLOPE(35*OVERSAMPLENR, 300, 51*OVERSAMPLENR, 270),
+  TSLOPE(51*OVERSAMPLENR, 270, 54*OVERSAMPLENR, 265),
+  TSLOPE(54*OVERSAMPLENR, 265, 58*OVERSAMPLENR, 260),
+  TSLOPE(58*OVERSAMPLENR, 260, 59*OVERSAMPLENR, 258),
+  TSLOPE(59*OVERSAMPLENR, 258, 61*OVERSAMPLENR, 256),
+  TSLOPE(61*OVERSAMPLENR, 256, 63*OVERSAMPLENR, 254),
+  TSLOPE(63*OVERSAMPLENR, 254, 64*OVERSAMPLENR, 252),
+  TSLOPE(64*OVERSAMPLENR, 252, 66*OVERSAMPLENR, 250),
+  TSLOPE(66*OVERSAMPLENR, 250, 67*OVERSAMPLENR, 249),
+  TSLOPE(67*OVERSAMPLENR, 249, 68*OVERSAMPLENR, 248),
+  TSLOPE(68*OVERSAMPLENR, 248, 69*OVERSAMPLENR, 247),
+  TSLOPE(69*OVERSAMPLENR, 247, 70*OVERSAMPLENR, 246),
+  TSLOPE(70*OVERSAMPLENR, 246, 71*OVERSAMPLENR, 245),
+  TSLOPE(71*OVERSAMPLENR, 245, 72*OVERSAMPLENR, 244),
+  TSLOPE(72*OVERSAMPLENR, 244, 73*OVERSAMPLENR, 243),
+  TSLOPE(73*OVERSAMPLENR, 243, 74*OVERSAMPLENR, 242),
+  TSLOPE(74*OVERSAMPLENR, 242, 75*OVERSAMPLENR, 241),
+  TSLOPE(75*OVERSAMPLENR, 241, 76*OVERSAMPLENR, 240),
+  TSLOPE(76*OVERSAMPLENR, 240, 77*OVERSAMPLENR, 239),
+  TSLOPE(77*OVERSAMPLENR, 239, 78*OVERSAMPLENR, 238),
+  TSLOPE(78*OVERSAMPLENR, 238, 79*OVERSAMPLENR, 237),
+  TSLOPE(79*OVERSAMPLENR, 237, 80*OVERSAMPLENR, 236),
+  TSLOPE(80*OVERSAMPLENR, 236, 81*OVERSAMPLENR, 235),
+  TSLOPE(81*OVERSAMPLENR, 235, 82*OVERSAMPLENR, 234),
+  TSLOPE(82*OVERSAMPLENR, 234, 84*OVERSAMPLENR, 233),
+  TSLOPE(84*OVERSAMPLENR, 233, 85*OVERSAMPLENR, 232),
+  TSLOPE(85*OVERSAMPLENR, 232, 86*OVERSAMPLENR, 231),
+  TSLOPE(86*OVERSAMPLENR, 231, 87*OVERSAMPLENR, 230),
+  TSLOPE(87*OVERSAMPLENR, 230, 89*OVERSAMPLENR, 229),
+  TSLOPE(89*OVERSAMPLENR, 229, 90*OVERSAMPLENR, 228),
+  TSLOPE(90*OVERSAMPLENR, 228, 91*OVERSAMPLENR, 227),
+  TSLOPE(91*OVERSAMPLENR, 227, 92*OVERSAMPLENR, 226),
+  TSLOPE(92*OVERSAMPLENR, 226, 94*OVERSAMPLENR, 225),
+  TSLOPE(94*OVERSAMPLENR, 225, 95*OVERSAMPLENR, 224),
+  TSLOPE(95*OVERSAMPLENR, 224, 97*OVERSAMPLENR, 223),
+  TSLOPE(97*OVERSAMPLENR, 223, 98*OVERSAMPLENR, 222),
+  TSLOPE(98*OVERSAMPLENR, 222, 99*OVERSAMPLENR, 221),
+  TSLOPE(99*OVERSAMPLENR, 221, 101*OVERSAMPLENR, 220),
+  TSLOPE(101*OVERSAMPLENR, 220, 102*OVERSAMPLENR, 219),
+  TSLOPE(102*OVERSAMPLENR, 219, 104*OVERSAMPLENR, 218),
+  TSLOPE(104*OVERSAMPLENR, 218, 106*OVERSAMPLENR, 217),
+  TSLOPE(106*OVERSAMPLENR, 217, 107*OVERSAMPLENR, 216),
+  TSLOPE(107*OVERSAMPLENR, 216, 109*OVERSAMPLENR, 215),
+  TSLOPE(109*OVERSAMPLENR, 215, 110*OVERSAMPLENR, 214),
+  TSLOPE(110*OVERSAMPLENR, 214, 112*OVERSAMPLENR, 213),
+  TSLOPE(112*OVERSAMPLENR, 213, 114*OVERSAMPLENR, 212),
+  TSLOPE(114*OVERSAMPLENR, 212, 115*OVERSAMPLENR, 211),
+  TSLOPE(115*OVERSAMPLENR, 211, 117*OVERSAMPLENR, 210),
+  TSLOPE(117*OVERSAMPLENR, 210, 119*OVERSAMPLENR, 209),
+  TSLOPE(119*OVERSAMPLENR, 209, 121*OVERSAMPLENR, 208),
+  TSLOPE(121*OVERSAMPLENR, 208, 123*OVERSAMPLENR, 207),
+  TSLOPE(123*OVERSAMPLENR, 207, 125*OVERSAMPLENR, 206),
+  TSLOPE(125*OVERSAMPLENR, 206, 126*OVERSAMPLENR, 205),
+  TSLOPE(126*OVERSAMPLENR, 205, 128*OVERSAMPLENR, 204),
+  TSLOPE(128*OVERSAMPLENR, 204, 130*OVERSAMPLENR, 203),
+  TSLOPE(130*OVERSAMPLENR, 203, 132*OVERSAMPLENR, 202),
+  TSLOPE(132*OVERSAMPLENR, 202, 134*OVERSAMPLENR, 201),
+  TSLOPE(134*OVERSAMPLENR, 201, 136*OVERSAMPLENR, 200),
+  TSLOPE(136*OVERSAMPLENR, 200, 139*OVERSAMPLENR, 199),
+  TSLOPE(139*OVERSAMPLENR, 199, 141*OVERSAMPLENR, 198),
+  TSLOPE(141*OVERSAMPLENR, 198, 143*OVERSAMPLENR, 197),
+  TSLOPE(143*OVERSAMPLENR, 197, 145*OVERSAMPLENR, 196),
+  TSLOPE(145*OVERSAMPLENR, 196, 147*OVERSAMPLENR, 195),
+  TSLOPE(147*OVERSAMPLENR, 195, 150*OVERSAMPLENR, 194),
+  TSLOPE(150*OVERSAMPLENR, 194, 152*OVERSAMPLENR, 193),
+  TSLOPE(152*OVERSAMPLENR, 193, 154*OVERSAMPLENR, 192),
+  TSLOPE(154*OVERSAMPLENR, 192, 157*OVERSAMPLENR, 191),
+  TSLOPE(157*OVERSAMPLENR, 191, 159*OVERSAMPLENR, 190),
+  TSLOPE(159*OVERSAMPLENR, 190, 162*OVERSAMPLENR, 189),
+  TSLOPE(162*OVERSAMPLENR, 189, 164*OVERSAMPLENR, 188),
+  TSLOPE(164*OVERSAMPLENR, 188, 167*OVERSAMPLENR, 187),
+  TSLOPE(167*OVERSAMPLENR, 187, 170*OVERSAMPLENR, 186),
+  TSLOPE(170*OVERSAMPLENR, 186, 172*OVERSAMPLENR, 185),
+  TSLOPE(172*OVERSAMPLENR, 185, 175*OVERSAMPLENR, 184),
+  TSLOPE(175*OVERSAMPLENR, 184, 178*OVERSAMPLENR, 183),
+  TSLOPE(178*OVERSAMPLENR, 183, 181*OVERSAMPLENR, 182),
+  TSLOPE(181*OVERSAMPLENR, 182, 184*OVERSAMPLENR, 181),
+  TSLOPE(184*OVERSAMPLENR, 181, 187*OVERSAMPLENR, 180),
+  TSLOPE(187*OVERSAMPLENR, 180, 190*OVERSAMPLENR, 179),
+  TSLOPE(190*OVERSAMPLENR, 179, 193*OVERSAMPLENR, 178),
+  TSLOPE(193*OVERSAMPLENR, 178, 196*OVERSAMPLENR, 177),
+  TSLOPE(196*OVERSAMPLENR, 177, 199*OVERSAMPLENR, 176),
+  TSLOPE(199*OVERSAMPLENR, 176, 202*OVERSAMPLENR, 175),
+  TSLOPE(202*OVERSAMPLENR, 175, 205*OVERSAMPLENR, 174),
+  TSLOPE(205*OVERSAMPLENR, 174, 208*OVERSAMPLENR, 173),
+  TSLOPE(208*OVERSAMPLENR, 173, 212*OVERSAMPLENR, 172),
+  TSLOPE(212*OVERSAMPLENR, 172, 215*OVERSAMPLENR, 171),
+  TSLOPE(215*OVERSAMPLENR, 171, 219*OVERSAMPLENR, 170),
+  TSLOPE(219*OVERSAMPLENR, 170, 237*OVERSAMPLENR, 165),
+  TSLOPE(237*OVERSAMPLENR, 165, 256*OVERSAMPLENR, 160),
+  TSLOPE(256*OVERSAMPLENR, 160, 300*OVERSAMPLENR, 150),
+  TSLOPE(300*OVERSAMPLENR, 150, 351*OVERSAMPLENR, 140),
+  TSLOPE(351*OVERSAMPLENR, 140, 470*OVERSAMPLENR, 120),
+  TSLOPE(470*OVERSAMPLENR, 120, 504*OVERSAMPLENR, 115),
+  TSLOPE(504*OVERSAMPLENR, 115, 538*OVERSAMPLENR, 110),
+  TSLOPE(538*OVERSAMPLENR, 110, 552*OVERSAMPLENR, 108),
+  TSLOPE(552*OVERSAMPLENR, 108, 566*OVERSAMPLENR, 106),
+  TSLOPE(566*OVERSAMPLENR, 106, 580*OVERSAMPLENR, 104),
+  TSLOPE(580*OVERSAMPLENR, 104, 594*OVERSAMPLENR, 102),
+  TSLOPE(594*OVERSAMPLENR, 102, 608*OVERSAMPLENR, 100),
+  TSLOPE(608*OVERSAMPLENR, 100, 622*OVERSAMPLENR, 98),
+  TSLOPE(622*OVERSAMPLENR, 98, 636*OVERSAMPLENR, 96),
+  TSLOPE(636*OVERSAMPLENR, 96, 650*OVERSAMPLENR, 94),
+  TSLOPE(650*OVERSAMPLENR, 94, 664*OVERSAMPLENR, 92),
+  TSLOPE(664*OVERSAMPLENR, 92, 678*OVERSAMPLENR, 90),
+  TSLOPE(678*OVERSAMPLENR, 90, 712*OVERSAMPLENR, 85),
+  TSLOPE(712*OVERSAMPLENR, 85, 745*OVERSAMPLENR, 80),
+  TSLOPE(745*OVERSAMPLENR, 80, 758*OVERSAMPLENR, 78),
+  TSLOPE(758*OVERSAMPLENR, 78, 770*OVERSAMPLENR, 76),
+  TSLOPE(770*OVERSAMPLENR, 76, 783*OVERSAMPLENR, 74),
+  TSLOPE(783*OVERSAMPLENR, 74, 795*OVERSAMPLENR, 72),
+  TSLOPE(795*OVERSAMPLENR, 72, 806*OVERSAMPLENR, 70),
+  TSLOPE(806*OVERSAMPLENR, 70, 818*OVERSAMPLENR, 68),
+  TSLOPE(818*OVERSAMPLENR, 68, 829*OVERSAMPLENR, 66),
+  TSLOPE(829*OVERSAMPLENR, 66, 840*OVERSAMPLENR, 64),
+  TSLOPE(840*OVERSAMPLENR, 64, 850*OVERSAMPLENR, 62),
+  TSLOPE(850*OVERSAMPLENR, 62, 860*OVERSAMPLENR, 60),
+  TSLOPE(860*OVERSAMPLENR, 60, 870*OVERSAMPLENR, 58),
+  TSLOPE(870*OVERSAMPLENR, 58, 879*OVERSAMPLENR, 56),
+  TSLOPE(879*OVERSAMPLENR, 56, 888*OVERSAMPLENR, 54),
+  TSLOPE(888*OVERSAMPLENR, 54, 897*OVERSAMPLENR, 52),
+  TSLOPE(897*OVERSAMPLENR, 52, 905*OVERSAMPLENR, 50),
+  TSLOPE(905*OVERSAMPLENR, 50, 924*OVERSAMPLENR, 45),
+  TSLOPE(924*OVERSAMPLENR, 45, 940*OVERSAMPLENR, 40),
+  TSLOPE(940*OVERSAMPLENR, 40, 955*OVERSAMPLENR, 35),
+  TSLOPE(955*OVERSAMPLENR, 35, 967*OVERSAMPLENR, 30),
+  TSLOPE(967*OVERSAMPLENR, 30, 970*OVERSAMPLENR, 29),
+  TSLOPE(970*OVERSAMPLENR, 29, 972*OVERSAMPLENR, 28),
+  TSLOPE(972*OVERSAMPLENR, 28, 974*OVERSAMPLENR, 27),
+  TSLOPE(974*OVERSAMPLENR, 27, 976*OVERSAMPLENR, 26),
+  TSLOPE(976*OVERSAMPLENR, 26, 978*OVERSAMPLENR, 25),
+  TSLOPE(978*OVERSAMPLENR, 25, 980*OVERSAMPLENR, 24),
+  TSLOPE(980*OVERSAMPLENR, 24, 982*OVERSAMPLENR, 23),
+  TSLOPE(982*OVERSAMPLENR, 23, 984*OVERSAMPLENR, 22),
+  TSLOPE(984*OVERSAMPLENR, 22, 985*OVERSAMPLENR, 21),
+  TSLOPE(985*OVERSAMPLENR, 21, 987*OVERSAMPLENR, 20),
+  TSLOPE(987*OVERSAMPLENR, 20, 995*OVERSAMPLENR, 15),
+  TSLOPE(995*OVERSAMPLENR, 15, 1001*OVERSAMPLENR, 10),
+  TSLOPE(1001*OVERSAMPLENR, 10, 1006*OVERSAMPLENR, 5),
+  TSLOPE(1006*OVERSAMPLENR, 5, 1010*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 8) || (THERMISTORHEATER_1 == 8) || (THERMISTORHEATER_2 == 8) || (THERMISTORHEATER_3 == 8) || (THERMISTORBED == 8)
+const float tempslope_8[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 704, 54*OVERSAMPLENR, 216),
+  TSLOPE(54*OVERSAMPLENR, 216, 107*OVERSAMPLENR, 175),
+  TSLOPE(107*OVERSAMPLENR, 175, 160*OVERSAMPLENR, 152),
+  TSLOPE(160*OVERSAMPLENR, 152, 213*OVERSAMPLENR, 137),
+  TSLOPE(213*OVERSAMPLENR, 137, 266*OVERSAMPLENR, 125),
+  TSLOPE(266*OVERSAMPLENR, 125, 319*OVERSAMPLENR, 115),
+  TSLOPE(319*OVERSAMPLENR, 115, 372*OVERSAMPLENR, 106),
+  TSLOPE(372*OVERSAMPLENR, 106, 425*OVERSAMPLENR, 99),
+  TSLOPE(425*OVERSAMPLENR, 99, 478*OVERSAMPLENR, 91),
+  TSLOPE(478*OVERSAMPLENR, 91, 531*OVERSAMPLENR, 85),
+  TSLOPE(531*OVERSAMPLENR, 85, 584*OVERSAMPLENR, 78),
+  TSLOPE(584*OVERSAMPLENR, 78, 637*OVERSAMPLENR, 71),
+  TSLOPE(637*OVERSAMPLENR, 71, 690*OVERSAMPLENR, 65),
+  TSLOPE(690*OVERSAMPLENR, 65, 743*OVERSAMPLENR, 58),
+  TSLOPE(743*OVERSAMPLENR, 58, 796*OVERSAMPLENR, 50),
+  TSLOPE(796*OVERSAMPLENR, 50, 849*OVERSAMPLENR, 42),
+  TSLOPE(849*OVERSAMPLENR, 42, 902*OVERSAMPLENR, 31),
+  TSLOPE(902*OVERSAMPLENR, 31, 955*OVERSAMPLENR, 17),
+  TSLOPE(955*OVERSAMPLENR, 17, 1008*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 9) || (THERMISTORHEATER_1 == 9) || (THERMISTORHEATER_2 == 9) || (THERMISTORHEATER_3 == 9) || (THERMISTORBED == 9)
+const float tempslope_9[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 936, 36*OVERSAMPLENR, 300),
+  TSLOPE(36*OVERSAMPLENR, 300, 71*OVERSAMPLENR, 246),
+  TSLOPE(71*OVERSAMPLENR, 246, 106*OVERSAMPLENR, 218),
+  TSLOPE(106*OVERSAMPLENR, 218, 141*OVERSAMPLENR, 199),
+  TSLOPE(141*OVERSAMPLENR, 199, 176*OVERSAMPLENR, 185),
+  TSLOPE(176*OVERSAMPLENR, 185, 211*OVERSAMPLENR, 173),
+  TSLOPE(211*OVERSAMPLENR, 173, 246*OVERSAMPLENR, 163),
+  TSLOPE(246*OVERSAMPLENR, 163, 281*OVERSAMPLENR, 155),
+  TSLOPE(281*OVERSAMPLENR, 155, 316*OVERSAMPLENR, 147),
+  TSLOPE(316*OVERSAMPLENR, 147, 351*OVERSAMPLENR, 140),
+  TSLOPE(351*OVERSAMPLENR, 140, 386*OVERSAMPLENR, 134),
+  TSLOPE(386*OVERSAMPLENR, 134, 421*OVERSAMPLENR, 128),
+  TSLOPE(421*OVERSAMPLENR, 128, 456*OVERSAMPLENR, 122),
+  TSLOPE(456*OVERSAMPLENR, 122, 491*OVERSAMPLENR, 117),
+  TSLOPE(491*OVERSAMPLENR, 117, 526*OVERSAMPLENR, 112),
+  TSLOPE(526*OVERSAMPLENR, 112, 561*OVERSAMPLENR, 107),
+  TSLOPE(561*OVERSAMPLENR, 107, 596*OVERSAMPLENR, 102),
+  TSLOPE(596*OVERSAMPLENR, 102, 631*OVERSAMPLENR, 97),
+  TSLOPE(631*OVERSAMPLENR, 97, 666*OVERSAMPLENR, 92),
+  TSLOPE(666*OVERSAMPLENR, 92, 701*OVERSAMPLENR, 87),
+  TSLOPE(701*OVERSAMPLENR, 87, 736*OVERSAMPLENR, 81),
+  TSLOPE(736*OVERSAMPLENR, 81, 771*OVERSAMPLENR, 76),
+  TSLOPE(771*OVERSAMPLENR, 76, 806*OVERSAMPLENR, 70),
+  TSLOPE(806*OVERSAMPLENR, 70, 841*OVERSAMPLENR, 63),
+  TSLOPE(841*OVERSAMPLENR, 63, 876*OVERSAMPLENR, 56),
+  TSLOPE(876*OVERSAMPLENR, 56, 911*OVERSAMPLENR, 48),
+  TSLOPE(911*OVERSAMPLENR, 48, 946*OVERSAMPLENR, 38),
+  TSLOPE(946*OVERSAMPLENR, 38, 981*OVERSAMPLENR, 23),
+  TSLOPE(981*OVERSAMPLENR, 23, 1005*OVERSAMPLENR, 5),
+  TSLOPE(1005*OVERSAMPLENR, 5, 1016*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 10) || (THERMISTORHEATER_1 == 10) || (THERMISTORHEATER_2 == 10) || (THERMISTORHEATER_3 == 10) || (THERMISTORBED == 10)
+const float tempslope_10[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 929, 36*OVERSAMPLENR, 299),
+  TSLOPE(36*OVERSAMPLENR, 299, 71*OVERSAMPLENR, 246),
+  TSLOPE(71*OVERSAMPLENR, 246, 106*OVERSAMPLENR, 217),
+  TSLOPE(106*OVERSAMPLENR, 217, 141*OVERSAMPLENR, 198),
+  TSLOPE(141*OVERSAMPLENR, 198, 176*OVERSAMPLENR, 184),
+  TSLOPE(176*OVERSAMPLENR, 184, 211*OVERSAMPLENR, 173),
+  TSLOPE(211*OVERSAMPLENR, 173, 246*OVERSAMPLENR, 163),
+  TSLOPE(246*OVERSAMPLENR, 163, 281*OVERSAMPLENR, 154),
+  TSLOPE(281*OVERSAMPLENR, 154, 316*OVERSAMPLENR, 147),
+  TSLOPE(316*OVERSAMPLENR, 147, 351*OVERSAMPLENR, 140),
+  TSLOPE(351*OVERSAMPLENR, 140, 386*OVERSAMPLENR, 134),
+  TSLOPE(386*OVERSAMPLENR, 134, 421*OVERSAMPLENR, 128),
+  TSLOPE(421*OVERSAMPLENR, 128, 456*OVERSAMPLENR, 122),
+  TSLOPE(456*OVERSAMPLENR, 122, 491*OVERSAMPLENR, 117),
+  TSLOPE(491*OVERSAMPLENR, 117, 526*OVERSAMPLENR, 112),
+  TSLOPE(526*OVERSAMPLENR, 112, 561*OVERSAMPLENR, 107),
+  TSLOPE(561*OVERSAMPLENR, 107, 596*OVERSAMPLENR, 102),
+  TSLOPE(596*OVERSAMPLENR, 102, 631*OVERSAMPLENR, 97),
+  TSLOPE(631*OVERSAMPLENR, 97, 666*OVERSAMPLENR, 91),
+  TSLOPE(666*OVERSAMPLENR, 91, 701*OVERSAMPLENR, 86),
+  TSLOPE(701*OVERSAMPLENR, 86, 736*OVERSAMPLENR, 81),
+  TSLOPE(736*OVERSAMPLENR, 81, 771*OVERSAMPLENR, 76),
+  TSLOPE(771*OVERSAMPLENR, 76, 806*OVERSAMPLENR, 70),
+  TSLOPE(806*OVERSAMPLENR, 70, 841*OVERSAMPLENR, 63),
+  TSLOPE(841*OVERSAMPLENR, 63, 876*OVERSAMPLENR, 56),
+  TSLOPE(876*OVERSAMPLENR, 56, 911*OVERSAMPLENR, 48),
+  TSLOPE(911*OVERSAMPLENR, 48, 946*OVERSAMPLENR, 38),
+  TSLOPE(946*OVERSAMPLENR, 38, 981*OVERSAMPLENR, 23),
+  TSLOPE(981*OVERSAMPLENR, 23, 1005*OVERSAMPLENR, 5),
+  TSLOPE(1005*OVERSAMPLENR, 5, 1016*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 11) || (THERMISTORHEATER_1 == 11) || (THERMISTORHEATER_2 == 11) || (THERMISTORHEATER_3 == 11) || (THERMISTORBED == 11)
+const float tempslope_11[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 938, 31*OVERSAMPLENR, 314),
+  TSLOPE(31*OVERSAMPLENR, 314, 41*OVERSAMPLENR, 290),
+  TSLOPE(41*OVERSAMPLENR, 290, 51*OVERSAMPLENR, 272),
+  TSLOPE(51*OVERSAMPLENR, 272, 61*OVERSAMPLENR, 258),
+  TSLOPE(61*OVERSAMPLENR, 258, 71*OVERSAMPLENR, 247),
+  TSLOPE(71*OVERSAMPLENR, 247, 81*OVERSAMPLENR, 237),
+  TSLOPE(81*OVERSAMPLENR, 237, 91*OVERSAMPLENR, 229),
+  TSLOPE(91*OVERSAMPLENR, 229, 101*OVERSAMPLENR, 221),
+  TSLOPE(101*OVERSAMPLENR, 221, 111*OVERSAMPLENR, 215),
+  TSLOPE(111*OVERSAMPLENR, 215, 121*OVERSAMPLENR, 209),
+  TSLOPE(121*OVERSAMPLENR, 209, 131*OVERSAMPLENR, 204),
+  TSLOPE(131*OVERSAMPLENR, 204, 141*OVERSAMPLENR, 199),
+  TSLOPE(141*OVERSAMPLENR, 199, 151*OVERSAMPLENR, 195),
+  TSLOPE(151*OVERSAMPLENR, 195, 161*OVERSAMPLENR, 190),
+  TSLOPE(161*OVERSAMPLENR, 190, 171*OVERSAMPLENR, 187),
+  TSLOPE(171*OVERSAMPLENR, 187, 181*OVERSAMPLENR, 183),
+  TSLOPE(181*OVERSAMPLENR, 183, 191*OVERSAMPLENR, 179),
+  TSLOPE(191*OVERSAMPLENR, 179, 201*OVERSAMPLENR, 176),
+  TSLOPE(201*OVERSAMPLENR, 176, 221*OVERSAMPLENR, 170),
+  TSLOPE(221*OVERSAMPLENR, 170, 241*OVERSAMPLENR, 165),
+  TSLOPE(241*OVERSAMPLENR, 165, 261*OVERSAMPLENR, 160),
+  TSLOPE(261*OVERSAMPLENR, 160, 281*OVERSAMPLENR, 155),
+  TSLOPE(281*OVERSAMPLENR, 155, 301*OVERSAMPLENR, 150),
+  TSLOPE(301*OVERSAMPLENR, 150, 331*OVERSAMPLENR, 144),
+  TSLOPE(331*OVERSAMPLENR, 144, 361*OVERSAMPLENR, 139),
+  TSLOPE(361*OVERSAMPLENR, 139, 391*OVERSAMPLENR, 133),
+  TSLOPE(391*OVERSAMPLENR, 133, 421*OVERSAMPLENR, 128),
+  TSLOPE(421*OVERSAMPLENR, 128, 451*OVERSAMPLENR, 123),
+  TSLOPE(451*OVERSAMPLENR, 123, 491*OVERSAMPLENR, 117),
+  TSLOPE(491*OVERSAMPLENR, 117, 531*OVERSAMPLENR, 111),
+  TSLOPE(531*OVERSAMPLENR, 111, 571*OVERSAMPLENR, 105),
+  TSLOPE(571*OVERSAMPLENR, 105, 611*OVERSAMPLENR, 100),
+  TSLOPE(611*OVERSAMPLENR, 100, 641*OVERSAMPLENR, 95),
+  TSLOPE(641*OVERSAMPLENR, 95, 681*OVERSAMPLENR, 90),
+  TSLOPE(681*OVERSAMPLENR, 90, 711*OVERSAMPLENR, 85),
+  TSLOPE(711*OVERSAMPLENR, 85, 751*OVERSAMPLENR, 79),
+  TSLOPE(751*OVERSAMPLENR, 79, 791*OVERSAMPLENR, 72),
+  TSLOPE(791*OVERSAMPLENR, 72, 811*OVERSAMPLENR, 69),
+  TSLOPE(811*OVERSAMPLENR, 69, 831*OVERSAMPLENR, 65),
+  TSLOPE(831*OVERSAMPLENR, 65, 871*OVERSAMPLENR, 57),
+  TSLOPE(871*OVERSAMPLENR, 57, 881*OVERSAMPLENR, 55),
+  TSLOPE(881*OVERSAMPLENR, 55, 901*OVERSAMPLENR, 51),
+  TSLOPE(901*OVERSAMPLENR, 51, 921*OVERSAMPLENR, 45),
+  TSLOPE(921*OVERSAMPLENR, 45, 941*OVERSAMPLENR, 39),
+  TSLOPE(941*OVERSAMPLENR, 39, 971*OVERSAMPLENR, 28),
+  TSLOPE(971*OVERSAMPLENR, 28, 981*OVERSAMPLENR, 23),
+  TSLOPE(981*OVERSAMPLENR, 23, 991*OVERSAMPLENR, 17),
+  TSLOPE(991*OVERSAMPLENR, 17, 1001*OVERSAMPLENR, 9),
+  TSLOPE(1001*OVERSAMPLENR, 9, 1021*OVERSAMPLENR, -27),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 13) || (THERMISTORHEATER_1 == 13) || (THERMISTORHEATER_2 == 13) || (THERMISTORHEATER_3 == 13) || (THERMISTORBED == 13)
+const float tempslope_13[] PROGMEM = {
+  TSLOPE(20.04*OVERSAMPLENR, 300, 23.19*OVERSAMPLENR, 290),
+  TSLOPE(23.19*OVERSAMPLENR, 290, 26.71*OVERSAMPLENR, 280),
+  TSLOPE(26.71*OVERSAMPLENR, 280, 31.23*OVERSAMPLENR, 270),
+  TSLOPE(31.23*OVERSAMPLENR, 270, 36.52*OVERSAMPLENR, 260),
+  TSLOPE(36.52*OVERSAMPLENR, 260, 42.75*OVERSAMPLENR, 250),
+  TSLOPE(42.75*OVERSAMPLENR, 250, 50.68*OVERSAMPLENR, 240),
+  TSLOPE(50.68*OVERSAMPLENR, 240, 60.22*OVERSAMPLENR, 230),
+  TSLOPE(60.22*OVERSAMPLENR, 230, 72.03*OVERSAMPLENR, 220),
+  TSLOPE(72.03*OVERSAMPLENR, 220, 86.84*OVERSAMPLENR, 210),
+  TSLOPE(86.84*OVERSAMPLENR, 210, 102.79*OVERSAMPLENR, 200),
+  TSLOPE(102.79*OVERSAMPLENR, 200, 124.46*OVERSAMPLENR, 190),
+  TSLOPE(124.46*OVERSAMPLENR, 190, 151.02*OVERSAMPLENR, 180),
+  TSLOPE(151.02*OVERSAMPLENR, 180, 182.86*OVERSAMPLENR, 170),
+  TSLOPE(182.86*OVERSAMPLENR, 170, 220.72*OVERSAMPLENR, 160),
+  TSLOPE(220.72*OVERSAMPLENR, 160, 316.96*OVERSAMPLENR, 140),
+  TSLOPE(316.96*OVERSAMPLENR, 140, 447.17*OVERSAMPLENR, 120),
+  TSLOPE(447.17*OVERSAMPLENR, 120, 590.61*OVERSAMPLENR, 100),
+  TSLOPE(590.61*OVERSAMPLENR, 100, 737.31*OVERSAMPLENR, 80),
+  TSLOPE(737.31*OVERSAMPLENR, 80, 857.77*OVERSAMPLENR, 60),
+  TSLOPE(857.77*OVERSAMPLENR, 60, 939.52*OVERSAMPLENR, 40),
+  TSLOPE(939.52*OVERSAMPLENR, 40, 986.03*OVERSAMPLENR, 20),
+  TSLOPE(986.03*OVERSAMPLENR, 20, 1008.7*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 20) || (THERMISTORHEATER_1 == 20) || (THERMISTORHEATER_2 == 20) || (THERMISTORBED == 20) // PT100 with INA826 amp on Ultimaker v2.0 electronics
+const float tempslope_20[] PROGMEM = {
+  TSLOPE(0*OVERSAMPLENR, 0, 227*OVERSAMPLENR, 1),
+  TSLOPE(227*OVERSAMPLENR, 1, 236*OVERSAMPLENR, 10),
+  TSLOPE(236*OVERSAMPLENR, 10, 245*OVERSAMPLENR, 20),
+  TSLOPE(245*OVERSAMPLENR, 20, 253*OVERSAMPLENR, 30),
+  TSLOPE(253*OVERSAMPLENR, 30, 262*OVERSAMPLENR, 40),
+  TSLOPE(262*OVERSAMPLENR, 40, 270*OVERSAMPLENR, 50),
+  TSLOPE(270*OVERSAMPLENR, 50, 279*OVERSAMPLENR, 60),
+  TSLOPE(279*OVERSAMPLENR, 60, 287*OVERSAMPLENR, 70),
+  TSLOPE(287*OVERSAMPLENR, 70, 295*OVERSAMPLENR, 80),
+  TSLOPE(295*OVERSAMPLENR, 80, 304*OVERSAMPLENR, 90),
+  TSLOPE(304*OVERSAMPLENR, 90, 312*OVERSAMPLENR, 100),
+  TSLOPE(312*OVERSAMPLENR, 100, 320*OVERSAMPLENR, 110),
+  TSLOPE(320*OVERSAMPLENR, 110, 329*OVERSAMPLENR, 120),
+  TSLOPE(329*OVERSAMPLENR, 120, 337*OVERSAMPLENR, 130),
+  TSLOPE(337*OVERSAMPLENR, 130, 345*OVERSAMPLENR, 140),
+  TSLOPE(345*OVERSAMPLENR, 140, 353*OVERSAMPLENR, 150),
+  TSLOPE(353*OVERSAMPLENR, 150, 361*OVERSAMPLENR, 160),
+  TSLOPE(361*OVERSAMPLENR, 160, 369*OVERSAMPLENR, 170),
+  TSLOPE(369*OVERSAMPLENR, 170, 377*OVERSAMPLENR, 180),
+  TSLOPE(377*OVERSAMPLENR, 180, 385*OVERSAMPLENR, 190),
+  TSLOPE(385*OVERSAMPLENR, 190, 393*OVERSAMPLENR, 200),
+  TSLOPE(393*OVERSAMPLENR, 200, 401*OVERSAMPLENR, 210),
+  TSLOPE(401*OVERSAMPLENR, 210, 409*OVERSAMPLENR, 220),
+  TSLOPE(409*OVERSAMPLENR, 220, 417*OVERSAMPLENR, 230),
+  TSLOPE(417*OVERSAMPLENR, 230, 424*OVERSAMPLENR, 240),
+  TSLOPE(424*OVERSAMPLENR, 240, 432*OVERSAMPLENR, 250),
+  TSLOPE(432*OVERSAMPLENR, 250, 440*OVERSAMPLENR, 260),
+  TSLOPE(440*OVERSAMPLENR, 260, 447*OVERSAMPLENR, 270),
+  TSLOPE(447*OVERSAMPLENR, 270, 455*OVERSAMPLENR, 280),
+  TSLOPE(455*OVERSAMPLENR, 280, 463*OVERSAMPLENR, 290),
+  TSLOPE(463*OVERSAMPLENR, 290, 470*OVERSAMPLENR, 300),
+  TSLOPE(470*OVERSAMPLENR, 300, 478*OVERSAMPLENR, 310),
+  TSLOPE(478*OVERSAMPLENR, 310, 485*OVERSAMPLENR, 320),
+  TSLOPE(485*OVERSAMPLENR, 320, 493*OVERSAMPLENR, 330),
+  TSLOPE(493*OVERSAMPLENR, 330, 500*OVERSAMPLENR, 340),
+  TSLOPE(500*OVERSAMPLENR, 340, 507*OVERSAMPLENR, 350),
+  TSLOPE(507*OVERSAMPLENR, 350, 515*OVERSAMPLENR, 360),
+  TSLOPE(515*OVERSAMPLENR, 360, 522*OVERSAMPLENR, 370),
+  TSLOPE(522*OVERSAMPLENR, 370, 529*OVERSAMPLENR, 380),
+  TSLOPE(529*OVERSAMPLENR, 380, 537*OVERSAMPLENR, 390),
+  TSLOPE(537*OVERSAMPLENR, 390, 544*OVERSAMPLENR, 400),
+  TSLOPE(544*OVERSAMPLENR, 400, 614*OVERSAMPLENR, 500),
+  TSLOPE(614*OVERSAMPLENR, 500, 681*OVERSAMPLENR, 600),
+  TSLOPE(681*OVERSAMPLENR, 600, 744*OVERSAMPLENR, 700),
+  TSLOPE(744*OVERSAMPLENR, 700, 805*OVERSAMPLENR, 800),
+  TSLOPE(805*OVERSAMPLENR, 800, 862*OVERSAMPLENR, 900),
+  TSLOPE(862*OVERSAMPLENR, 900, 917*OVERSAMPLENR, 1000),
+  TSLOPE(917*OVERSAMPLENR, 1000, 968*OVERSAMPLENR, 1100),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 51) || (THERMISTORHEATER_1 == 51) || (THERMISTORHEATER_2 == 51) || (THERMISTORHEATER_3 == 51) || (THERMISTORBED == 51)
+const float tempslope_51[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 350, 190*OVERSAMPLENR, 250),
+  TSLOPE(190*OVERSAMPLENR, 250, 203*OVERSAMPLENR, 245),
+  TSLOPE(203*OVERSAMPLENR, 245, 217*OVERSAMPLENR, 240),
+  TSLOPE(217*OVERSAMPLENR, 240, 232*OVERSAMPLENR, 235),
+  TSLOPE(232*OVERSAMPLENR, 235, 248*OVERSAMPLENR, 230),
+  TSLOPE(248*OVERSAMPLENR, 230, 265*OVERSAMPLENR, 225),
+  TSLOPE(265*OVERSAMPLENR, 225, 283*OVERSAMPLENR, 220),
+  TSLOPE(283*OVERSAMPLENR, 220, 302*OVERSAMPLENR, 215),
+  TSLOPE(302*OVERSAMPLENR, 215, 322*OVERSAMPLENR, 210),
+  TSLOPE(322*OVERSAMPLENR, 210, 344*OVERSAMPLENR, 205),
+  TSLOPE(344*OVERSAMPLENR, 205, 366*OVERSAMPLENR, 200),
+  TSLOPE(366*OVERSAMPLENR, 200, 390*OVERSAMPLENR, 195),
+  TSLOPE(390*OVERSAMPLENR, 195, 415*OVERSAMPLENR, 190),
+  TSLOPE(415*OVERSAMPLENR, 190, 440*OVERSAMPLENR, 185),
+  TSLOPE(440*OVERSAMPLENR, 185, 467*OVERSAMPLENR, 180),
+  TSLOPE(467*OVERSAMPLENR, 180, 494*OVERSAMPLENR, 175),
+  TSLOPE(494*OVERSAMPLENR, 175, 522*OVERSAMPLENR, 170),
+  TSLOPE(522*OVERSAMPLENR, 170, 551*OVERSAMPLENR, 165),
+  TSLOPE(551*OVERSAMPLENR, 165, 580*OVERSAMPLENR, 160),
+  TSLOPE(580*OVERSAMPLENR, 160, 609*OVERSAMPLENR, 155),
+  TSLOPE(609*OVERSAMPLENR, 155, 638*OVERSAMPLENR, 150),
+  TSLOPE(638*OVERSAMPLENR, 150, 666*OVERSAMPLENR, 145),
+  TSLOPE(666*OVERSAMPLENR, 145, 695*OVERSAMPLENR, 140),
+  TSLOPE(695*OVERSAMPLENR, 140, 722*OVERSAMPLENR, 135),
+  TSLOPE(722*OVERSAMPLENR, 135, 749*OVERSAMPLENR, 130),
+  TSLOPE(749*OVERSAMPLENR, 130, 775*OVERSAMPLENR, 125),
+  TSLOPE(775*OVERSAMPLENR, 125, 800*OVERSAMPLENR, 120),
+  TSLOPE(800*OVERSAMPLENR, 120, 823*OVERSAMPLENR, 115),
+  TSLOPE(823*OVERSAMPLENR, 115, 845*OVERSAMPLENR, 110),
+  TSLOPE(845*OVERSAMPLENR, 110, 865*OVERSAMPLENR, 105),
+  TSLOPE(865*OVERSAMPLENR, 105, 884*OVERSAMPLENR, 100),
+  TSLOPE(884*OVERSAMPLENR, 100, 901*OVERSAMPLENR, 95),
+  TSLOPE(901*OVERSAMPLENR, 95, 917*OVERSAMPLENR, 90),
+  TSLOPE(917*OVERSAMPLENR, 90, 932*OVERSAMPLENR, 85),
+  TSLOPE(932*OVERSAMPLENR, 85, 944*OVERSAMPLENR, 80),
+  TSLOPE(944*OVERSAMPLENR, 80, 956*OVERSAMPLENR, 75),
+  TSLOPE(956*OVERSAMPLENR, 75, 966*OVERSAMPLENR, 70),
+  TSLOPE(966*OVERSAMPLENR, 70, 975*OVERSAMPLENR, 65),
+  TSLOPE(975*OVERSAMPLENR, 65, 982*OVERSAMPLENR, 60),
+  TSLOPE(982*OVERSAMPLENR, 60, 989*OVERSAMPLENR, 55),
+  TSLOPE(989*OVERSAMPLENR, 55, 995*OVERSAMPLENR, 50),
+  TSLOPE(995*OVERSAMPLENR, 50, 1000*OVERSAMPLENR, 45),
+  TSLOPE(1000*OVERSAMPLENR, 45, 1004*OVERSAMPLENR, 40),
+  TSLOPE(1004*OVERSAMPLENR, 40, 1007*OVERSAMPLENR, 35),
+  TSLOPE(1007*OVERSAMPLENR, 35, 1010*OVERSAMPLENR, 30),
+  TSLOPE(1010*OVERSAMPLENR, 30, 1013*OVERSAMPLENR, 25),
+  TSLOPE(1013*OVERSAMPLENR, 25, 1015*OVERSAMPLENR, 20),
+  TSLOPE(1015*OVERSAMPLENR, 20, 1017*OVERSAMPLENR, 15),
+  TSLOPE(1017*OVERSAMPLENR, 15, 1018*OVERSAMPLENR, 10),
+  TSLOPE(1018*OVERSAMPLENR, 10, 1019*OVERSAMPLENR, 5),
+  TSLOPE(1019*OVERSAMPLENR, 5, 1020*OVERSAMPLENR, 0),
+  TSLOPE(1020*OVERSAMPLENR, 0, 1021*OVERSAMPLENR, -5),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 52) || (THERMISTORHEATER_1 == 52) || (THERMISTORHEATER_2 == 52) || (THERMISTORHEATER_3 == 52) || (THERMISTORBED == 52)
+const float tempslope_52[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 500, 125*OVERSAMPLENR, 300),
+  TSLOPE(125*OVERSAMPLENR, 300, 142*OVERSAMPLENR, 290),
+  TSLOPE(142*OVERSAMPLENR, 290, 162*OVERSAMPLENR, 280),
+  TSLOPE(162*OVERSAMPLENR, 280, 185*OVERSAMPLENR, 270),
+  TSLOPE(185*OVERSAMPLENR, 270, 211*OVERSAMPLENR, 260),
+  TSLOPE(211*OVERSAMPLENR, 260, 240*OVERSAMPLENR, 250),
+  TSLOPE(240*OVERSAMPLENR, 250, 274*OVERSAMPLENR, 240),
+  TSLOPE(274*OVERSAMPLENR, 240, 312*OVERSAMPLENR, 230),
+  TSLOPE(312*OVERSAMPLENR, 230, 355*OVERSAMPLENR, 220),
+  TSLOPE(355*OVERSAMPLENR, 220, 401*OVERSAMPLENR, 210),
+  TSLOPE(401*OVERSAMPLENR, 210, 452*OVERSAMPLENR, 200),
+  TSLOPE(452*OVERSAMPLENR, 200, 506*OVERSAMPLENR, 190),
+  TSLOPE(506*OVERSAMPLENR, 190, 563*OVERSAMPLENR, 180),
+  TSLOPE(563*OVERSAMPLENR, 180, 620*OVERSAMPLENR, 170),
+  TSLOPE(620*OVERSAMPLENR, 170, 677*OVERSAMPLENR, 160),
+  TSLOPE(677*OVERSAMPLENR, 160, 732*OVERSAMPLENR, 150),
+  TSLOPE(732*OVERSAMPLENR, 150, 783*OVERSAMPLENR, 140),
+  TSLOPE(783*OVERSAMPLENR, 140, 830*OVERSAMPLENR, 130),
+  TSLOPE(830*OVERSAMPLENR, 130, 871*OVERSAMPLENR, 120),
+  TSLOPE(871*OVERSAMPLENR, 120, 906*OVERSAMPLENR, 110),
+  TSLOPE(906*OVERSAMPLENR, 110, 935*OVERSAMPLENR, 100),
+  TSLOPE(935*OVERSAMPLENR, 100, 958*OVERSAMPLENR, 90),
+  TSLOPE(958*OVERSAMPLENR, 90, 976*OVERSAMPLENR, 80),
+  TSLOPE(976*OVERSAMPLENR, 80, 990*OVERSAMPLENR, 70),
+  TSLOPE(990*OVERSAMPLENR, 70, 1000*OVERSAMPLENR, 60),
+  TSLOPE(1000*OVERSAMPLENR, 60, 1008*OVERSAMPLENR, 50),
+  TSLOPE(1008*OVERSAMPLENR, 50, 1013*OVERSAMPLENR, 40),
+  TSLOPE(1013*OVERSAMPLENR, 40, 1017*OVERSAMPLENR, 30),
+  TSLOPE(1017*OVERSAMPLENR, 30, 1019*OVERSAMPLENR, 20),
+  TSLOPE(1019*OVERSAMPLENR, 20, 1021*OVERSAMPLENR, 10),
+  TSLOPE(1021*OVERSAMPLENR, 10, 1022*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 55) || (THERMISTORHEATER_1 == 55) || (THERMISTORHEATER_2 == 55) || (THERMISTORHEATER_3 == 55) || (THERMISTORBED == 55)
+const float tempslope_55[] PROGMEM = {
+  TSLOPE(1*OVERSAMPLENR, 500, 76*OVERSAMPLENR, 300),
+  TSLOPE(76*OVERSAMPLENR, 300, 87*OVERSAMPLENR, 290),
+  TSLOPE(87*OVERSAMPLENR, 290, 100*OVERSAMPLENR, 280),
+  TSLOPE(100*OVERSAMPLENR, 280, 114*OVERSAMPLENR, 270),
+  TSLOPE(114*OVERSAMPLENR, 270, 131*OVERSAMPLENR, 260),
+  TSLOPE(131*OVERSAMPLENR, 260, 152*OVERSAMPLENR, 250),
+  TSLOPE(152*OVERSAMPLENR, 250, 175*OVERSAMPLENR, 240),
+  TSLOPE(175*OVERSAMPLENR, 240, 202*OVERSAMPLENR, 230),
+  TSLOPE(202*OVERSAMPLENR, 230, 234*OVERSAMPLENR, 220),
+  TSLOPE(234*OVERSAMPLENR, 220, 271*OVERSAMPLENR, 210),
+  TSLOPE(271*OVERSAMPLENR, 210, 312*OVERSAMPLENR, 200),
+  TSLOPE(312*OVERSAMPLENR, 200, 359*OVERSAMPLENR, 190),
+  TSLOPE(359*OVERSAMPLENR, 190, 411*OVERSAMPLENR, 180),
+  TSLOPE(411*OVERSAMPLENR, 180, 467*OVERSAMPLENR, 170),
+  TSLOPE(467*OVERSAMPLENR, 170, 527*OVERSAMPLENR, 160),
+  TSLOPE(527*OVERSAMPLENR, 160, 590*OVERSAMPLENR, 150),
+  TSLOPE(590*OVERSAMPLENR, 150, 652*OVERSAMPLENR, 140),
+  TSLOPE(652*OVERSAMPLENR, 140, 713*OVERSAMPLENR, 130),
+  TSLOPE(713*OVERSAMPLENR, 130, 770*OVERSAMPLENR, 120),
+  TSLOPE(770*OVERSAMPLENR, 120, 822*OVERSAMPLENR, 110),
+  TSLOPE(822*OVERSAMPLENR, 110, 867*OVERSAMPLENR, 100),
+  TSLOPE(867*OVERSAMPLENR, 100, 905*OVERSAMPLENR, 90),
+  TSLOPE(905*OVERSAMPLENR, 90, 936*OVERSAMPLENR, 80),
+  TSLOPE(936*OVERSAMPLENR, 80, 961*OVERSAMPLENR, 70),
+  TSLOPE(961*OVERSAMPLENR, 70, 979*OVERSAMPLENR, 60),
+  TSLOPE(979*OVERSAMPLENR, 60, 993*OVERSAMPLENR, 50),
+  TSLOPE(993*OVERSAMPLENR, 50, 1003*OVERSAMPLENR, 40),
+  TSLOPE(1003*OVERSAMPLENR, 40, 1010*OVERSAMPLENR, 30),
+  TSLOPE(1010*OVERSAMPLENR, 30, 1015*OVERSAMPLENR, 20),
+  TSLOPE(1015*OVERSAMPLENR, 20, 1018*OVERSAMPLENR, 10),
+  TSLOPE(1018*OVERSAMPLENR, 10, 1020*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 60) || (THERMISTORHEATER_1 == 60) || (THERMISTORHEATER_2 == 60) || (THERMISTORHEATER_3 == 60) || (THERMISTORBED == 60) // Maker's Tool Works Kapton Bed Thermister
+const float tempslope_60[] PROGMEM = {
+  TSLOPE(51*OVERSAMPLENR, 272, 61*OVERSAMPLENR, 258),
+  TSLOPE(61*OVERSAMPLENR, 258, 71*OVERSAMPLENR, 247),
+  TSLOPE(71*OVERSAMPLENR, 247, 81*OVERSAMPLENR, 237),
+  TSLOPE(81*OVERSAMPLENR, 237, 91*OVERSAMPLENR, 229),
+  TSLOPE(91*OVERSAMPLENR, 229, 101*OVERSAMPLENR, 221),
+  TSLOPE(101*OVERSAMPLENR, 221, 131*OVERSAMPLENR, 204),
+  TSLOPE(131*OVERSAMPLENR, 204, 161*OVERSAMPLENR, 190),
+  TSLOPE(161*OVERSAMPLENR, 190, 191*OVERSAMPLENR, 179),
+  TSLOPE(191*OVERSAMPLENR, 179, 231*OVERSAMPLENR, 167),
+  TSLOPE(231*OVERSAMPLENR, 167, 271*OVERSAMPLENR, 157),
+  TSLOPE(271*OVERSAMPLENR, 157, 311*OVERSAMPLENR, 148),
+  TSLOPE(311*OVERSAMPLENR, 148, 351*OVERSAMPLENR, 140),
+  TSLOPE(351*OVERSAMPLENR, 140, 381*OVERSAMPLENR, 135),
+  TSLOPE(381*OVERSAMPLENR, 135, 411*OVERSAMPLENR, 130),
+  TSLOPE(411*OVERSAMPLENR, 130, 441*OVERSAMPLENR, 125),
+  TSLOPE(441*OVERSAMPLENR, 125, 451*OVERSAMPLENR, 123),
+  TSLOPE(451*OVERSAMPLENR, 123, 461*OVERSAMPLENR, 122),
+  TSLOPE(461*OVERSAMPLENR, 122, 471*OVERSAMPLENR, 120),
+  TSLOPE(471*OVERSAMPLENR, 120, 481*OVERSAMPLENR, 119),
+  TSLOPE(481*OVERSAMPLENR, 119, 491*OVERSAMPLENR, 117),
+  TSLOPE(491*OVERSAMPLENR, 117, 501*OVERSAMPLENR, 116),
+  TSLOPE(501*OVERSAMPLENR, 116, 511*OVERSAMPLENR, 114),
+  TSLOPE(511*OVERSAMPLENR, 114, 521*OVERSAMPLENR, 113),
+  TSLOPE(521*OVERSAMPLENR, 113, 531*OVERSAMPLENR, 111),
+  TSLOPE(531*OVERSAMPLENR, 111, 541*OVERSAMPLENR, 110),
+  TSLOPE(541*OVERSAMPLENR, 110, 551*OVERSAMPLENR, 108),
+  TSLOPE(551*OVERSAMPLENR, 108, 561*OVERSAMPLENR, 107),
+  TSLOPE(561*OVERSAMPLENR, 107, 571*OVERSAMPLENR, 105),
+  TSLOPE(571*OVERSAMPLENR, 105, 581*OVERSAMPLENR, 104),
+  TSLOPE(581*OVERSAMPLENR, 104, 591*OVERSAMPLENR, 102),
+  TSLOPE(591*OVERSAMPLENR, 102, 601*OVERSAMPLENR, 101),
+  TSLOPE(601*OVERSAMPLENR, 101, 611*OVERSAMPLENR, 100),
+  TSLOPE(611*OVERSAMPLENR, 100, 621*OVERSAMPLENR, 98),
+  TSLOPE(621*OVERSAMPLENR, 98, 631*OVERSAMPLENR, 97),
+  TSLOPE(631*OVERSAMPLENR, 97, 641*OVERSAMPLENR, 95),
+  TSLOPE(641*OVERSAMPLENR, 95, 651*OVERSAMPLENR, 94),
+  TSLOPE(651*OVERSAMPLENR, 94, 661*OVERSAMPLENR, 92),
+  TSLOPE(661*OVERSAMPLENR, 92, 671*OVERSAMPLENR, 91),
+  TSLOPE(671*OVERSAMPLENR, 91, 681*OVERSAMPLENR, 90),
+  TSLOPE(681*OVERSAMPLENR, 90, 691*OVERSAMPLENR, 88),
+  TSLOPE(691*OVERSAMPLENR, 88, 701*OVERSAMPLENR, 87),
+  TSLOPE(701*OVERSAMPLENR, 87, 711*OVERSAMPLENR, 85),
+  TSLOPE(711*OVERSAMPLENR, 85, 721*OVERSAMPLENR, 84),
+  TSLOPE(721*OVERSAMPLENR, 84, 731*OVERSAMPLENR, 82),
+  TSLOPE(731*OVERSAMPLENR, 82, 741*OVERSAMPLENR, 81),
+  TSLOPE(741*OVERSAMPLENR, 81, 751*OVERSAMPLENR, 79),
+  TSLOPE(751*OVERSAMPLENR, 79, 761*OVERSAMPLENR, 77),
+  TSLOPE(761*OVERSAMPLENR, 77, 771*OVERSAMPLENR, 76),
+  TSLOPE(771*OVERSAMPLENR, 76, 781*OVERSAMPLENR, 74),
+  TSLOPE(781*OVERSAMPLENR, 74, 791*OVERSAMPLENR, 72),
+  TSLOPE(791*OVERSAMPLENR, 72, 801*OVERSAMPLENR, 71),
+  TSLOPE(801*OVERSAMPLENR, 71, 811*OVERSAMPLENR, 69),
+  TSLOPE(811*OVERSAMPLENR, 69, 821*OVERSAMPLENR, 67),
+  TSLOPE(821*OVERSAMPLENR, 67, 831*OVERSAMPLENR, 65),
+  TSLOPE(831*OVERSAMPLENR, 65, 841*OVERSAMPLENR, 63),
+  TSLOPE(841*OVERSAMPLENR, 63, 851*OVERSAMPLENR, 62),
+  TSLOPE(851*OVERSAMPLENR, 62, 861*OVERSAMPLENR, 60),
+  TSLOPE(861*OVERSAMPLENR, 60, 871*OVERSAMPLENR, 57),
+  TSLOPE(871*OVERSAMPLENR, 57, 881*OVERSAMPLENR, 55),
+  TSLOPE(881*OVERSAMPLENR, 55, 891*OVERSAMPLENR, 53),
+  TSLOPE(891*OVERSAMPLENR, 53, 901*OVERSAMPLENR, 51),
+  TSLOPE(901*OVERSAMPLENR, 51, 911*OVERSAMPLENR, 48),
+  TSLOPE(911*OVERSAMPLENR, 48, 921*OVERSAMPLENR, 45),
+  TSLOPE(921*OVERSAMPLENR, 45, 931*OVERSAMPLENR, 42),
+  TSLOPE(931*OVERSAMPLENR, 42, 941*OVERSAMPLENR, 39),
+  TSLOPE(941*OVERSAMPLENR, 39, 951*OVERSAMPLENR, 36),
+  TSLOPE(951*OVERSAMPLENR, 36, 961*OVERSAMPLENR, 32),
+  TSLOPE(961*OVERSAMPLENR, 32, 981*OVERSAMPLENR, 23),
+  TSLOPE(981*OVERSAMPLENR, 23, 991*OVERSAMPLENR, 17),
+  TSLOPE(991*OVERSAMPLENR, 17, 1001*OVERSAMPLENR, 9),
+  TSLOPE(1001*OVERSAMPLENR, 9, 1008*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 14) || (THERMISTORHEATER_1 == 14) || (THERMISTORHEATER_2 == 14) || (THERMISTORHEATER_3 == 14) || (THERMISTORBED == 14)
+const float tempslope_14[] PROGMEM = {
+  TSLOPE(91*OVERSAMPLENR, 220, 97*OVERSAMPLENR, 216),
+  TSLOPE(97*OVERSAMPLENR, 216, 103*OVERSAMPLENR, 212),
+  TSLOPE(103*OVERSAMPLENR, 212, 110*OVERSAMPLENR, 208),
+  TSLOPE(110*OVERSAMPLENR, 208, 117*OVERSAMPLENR, 204),
+  TSLOPE(117*OVERSAMPLENR, 204, 125*OVERSAMPLENR, 200),
+  TSLOPE(125*OVERSAMPLENR, 200, 134*OVERSAMPLENR, 196),
+  TSLOPE(134*OVERSAMPLENR, 196, 143*OVERSAMPLENR, 192),
+  TSLOPE(143*OVERSAMPLENR, 192, 153*OVERSAMPLENR, 188),
+  TSLOPE(153*OVERSAMPLENR, 188, 164*OVERSAMPLENR, 184),
+  TSLOPE(164*OVERSAMPLENR, 184, 175*OVERSAMPLENR, 180),
+  TSLOPE(175*OVERSAMPLENR, 180, 187*OVERSAMPLENR, 176),
+  TSLOPE(187*OVERSAMPLENR, 176, 200*OVERSAMPLENR, 172),
+  TSLOPE(200*OVERSAMPLENR, 172, 214*OVERSAMPLENR, 168),
+  TSLOPE(214*OVERSAMPLENR, 168, 229*OVERSAMPLENR, 164),
+  TSLOPE(229*OVERSAMPLENR, 164, 245*OVERSAMPLENR, 160),
+  TSLOPE(245*OVERSAMPLENR, 160, 262*OVERSAMPLENR, 156),
+  TSLOPE(262*OVERSAMPLENR, 156, 281*OVERSAMPLENR, 152),
+  TSLOPE(281*OVERSAMPLENR, 152, 300*OVERSAMPLENR, 148),
+  TSLOPE(300*OVERSAMPLENR, 148, 320*OVERSAMPLENR, 144),
+  TSLOPE(320*OVERSAMPLENR, 144, 341*OVERSAMPLENR, 140),
+  TSLOPE(341*OVERSAMPLENR, 140, 364*OVERSAMPLENR, 136),
+  TSLOPE(364*OVERSAMPLENR, 136, 387*OVERSAMPLENR, 132),
+  TSLOPE(387*OVERSAMPLENR, 132, 412*OVERSAMPLENR, 128),
+  TSLOPE(412*OVERSAMPLENR, 128, 437*OVERSAMPLENR, 124),
+  TSLOPE(437*OVERSAMPLENR, 124, 463*OVERSAMPLENR, 120),
+  TSLOPE(463*OVERSAMPLENR, 120, 491*OVERSAMPLENR, 116),
+  TSLOPE(491*OVERSAMPLENR, 116, 518*OVERSAMPLENR, 112),
+  TSLOPE(518*OVERSAMPLENR, 112, 547*OVERSAMPLENR, 108),
+  TSLOPE(547*OVERSAMPLENR, 108, 575*OVERSAMPLENR, 104),
+  TSLOPE(575*OVERSAMPLENR, 104, 604*OVERSAMPLENR, 100),
+  TSLOPE(604*OVERSAMPLENR, 100, 633*OVERSAMPLENR, 96),
+  TSLOPE(633*OVERSAMPLENR, 96, 661*OVERSAMPLENR, 92),
+  TSLOPE(661*OVERSAMPLENR, 92, 690*OVERSAMPLENR, 88),
+  TSLOPE(690*OVERSAMPLENR, 88, 717*OVERSAMPLENR, 84),
+  TSLOPE(717*OVERSAMPLENR, 84, 744*OVERSAMPLENR, 80),
+  TSLOPE(744*OVERSAMPLENR, 80, 770*OVERSAMPLENR, 76),
+  TSLOPE(770*OVERSAMPLENR, 76, 794*OVERSAMPLENR, 72),
+  TSLOPE(794*OVERSAMPLENR, 72, 817*OVERSAMPLENR, 68),
+  TSLOPE(817*OVERSAMPLENR, 68, 839*OVERSAMPLENR, 64),
+  TSLOPE(839*OVERSAMPLENR, 64, 860*OVERSAMPLENR, 60),
+  TSLOPE(860*OVERSAMPLENR, 60, 879*OVERSAMPLENR, 56),
+  TSLOPE(879*OVERSAMPLENR, 56, 896*OVERSAMPLENR, 52),
+  TSLOPE(896*OVERSAMPLENR, 52, 912*OVERSAMPLENR, 48),
+  TSLOPE(912*OVERSAMPLENR, 48, 926*OVERSAMPLENR, 44),
+  TSLOPE(926*OVERSAMPLENR, 44, 939*OVERSAMPLENR, 40),
+  TSLOPE(939*OVERSAMPLENR, 40, 951*OVERSAMPLENR, 36),
+  TSLOPE(951*OVERSAMPLENR, 36, 961*OVERSAMPLENR, 32),
+  TSLOPE(961*OVERSAMPLENR, 32, 970*OVERSAMPLENR, 28),
+  TSLOPE(970*OVERSAMPLENR, 28, 978*OVERSAMPLENR, 24),
+  TSLOPE(978*OVERSAMPLENR, 24, 985*OVERSAMPLENR, 20),
+  TSLOPE(985*OVERSAMPLENR, 20, 991*OVERSAMPLENR, 16),
+  TSLOPE(991*OVERSAMPLENR, 16, 996*OVERSAMPLENR, 12),
+  TSLOPE(996*OVERSAMPLENR, 12, 1001*OVERSAMPLENR, 8),
+  TSLOPE(1001*OVERSAMPLENR, 8, 1004*OVERSAMPLENR, 4),
+  TSLOPE(1004*OVERSAMPLENR, 4, 1008*OVERSAMPLENR, 0),
+  0
+};
+#endif
+
+#if (THERMISTORBED == 12)
+const float tempslope_12[] PROGMEM = {
+  TSLOPE(35*OVERSAMPLENR, 180, 211*OVERSAMPLENR, 140),
+  TSLOPE(211*OVERSAMPLENR, 140, 233*OVERSAMPLENR, 135),
+  TSLOPE(233*OVERSAMPLENR, 135, 261*OVERSAMPLENR, 130),
+  TSLOPE(261*OVERSAMPLENR, 130, 290*OVERSAMPLENR, 125),
+  TSLOPE(290*OVERSAMPLENR, 125, 328*OVERSAMPLENR, 120),
+  TSLOPE(328*OVERSAMPLENR, 120, 362*OVERSAMPLENR, 115),
+  TSLOPE(362*OVERSAMPLENR, 115, 406*OVERSAMPLENR, 110),
+  TSLOPE(406*OVERSAMPLENR, 110, 446*OVERSAMPLENR, 105),
+  TSLOPE(446*OVERSAMPLENR, 105, 496*OVERSAMPLENR, 100),
+  TSLOPE(496*OVERSAMPLENR, 100, 539*OVERSAMPLENR, 95),
+  TSLOPE(539*OVERSAMPLENR, 95, 585*OVERSAMPLENR, 90),
+  TSLOPE(585*OVERSAMPLENR, 90, 629*OVERSAMPLENR, 85),
+  TSLOPE(629*OVERSAMPLENR, 85, 675*OVERSAMPLENR, 80),
+  TSLOPE(675*OVERSAMPLENR, 80, 718*OVERSAMPLENR, 75),
+  TSLOPE(718*OVERSAMPLENR, 75, 758*OVERSAMPLENR, 70),
+  TSLOPE(758*OVERSAMPLENR, 70, 793*OVERSAMPLENR, 65),
+  TSLOPE(793*OVERSAMPLENR, 65, 822*OVERSAMPLENR, 60),
+  TSLOPE(822*OVERSAMPLENR, 60, 841*OVERSAMPLENR, 55),
+  TSLOPE(841*OVERSAMPLENR, 55, 875*OVERSAMPLENR, 50),
+  TSLOPE(875*OVERSAMPLENR, 50, 899*OVERSAMPLENR, 45),
+  TSLOPE(899*OVERSAMPLENR, 45, 926*OVERSAMPLENR, 40),
+  TSLOPE(926*OVERSAMPLENR, 40, 946*OVERSAMPLENR, 35),
+  TSLOPE(946*OVERSAMPLENR, 35, 962*OVERSAMPLENR, 30),
+  TSLOPE(962*OVERSAMPLENR, 30, 977*OVERSAMPLENR, 25),
+  TSLOPE(977*OVERSAMPLENR, 25, 987*OVERSAMPLENR, 20),
+  TSLOPE(987*OVERSAMPLENR, 20, 995*OVERSAMPLENR, 15),
+  TSLOPE(995*OVERSAMPLENR, 15, 1001*OVERSAMPLENR, 10),
+  TSLOPE(1001*OVERSAMPLENR, 10, 1010*OVERSAMPLENR, 0),
+  TSLOPE(1010*OVERSAMPLENR, 0, 1023*OVERSAMPLENR, -40),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 110) || (THERMISTORHEATER_1 == 110) || (THERMISTORHEATER_2 == 110) || (THERMISTORHEATER_3 == 110) || (THERMISTORBED == 110) // Pt100 with 1k0 pullup
+const float tempslope_110[] PROGMEM = {
+  TSLOPE(PtAdVal(0,100,1000)*OVERSAMPLENR, 0, PtAdVal(50,100,1000)*OVERSAMPLENR, 50),
+  TSLOPE(PtAdVal(50,100,1000)*OVERSAMPLENR, 50, PtAdVal(100,100,1000)*OVERSAMPLENR, 100),
+  TSLOPE(PtAdVal(100,100,1000)*OVERSAMPLENR, 100, PtAdVal(150,100,1000)*OVERSAMPLENR, 150),
+  TSLOPE(PtAdVal(150,100,1000)*OVERSAMPLENR, 150, PtAdVal(200,100,1000)*OVERSAMPLENR, 200),
+  TSLOPE(PtAdVal(200,100,1000)*OVERSAMPLENR, 200, PtAdVal(250,100,1000)*OVERSAMPLENR, 250),
+  TSLOPE(PtAdVal(250,100,1000)*OVERSAMPLENR, 250, PtAdVal(300,100,1000)*OVERSAMPLENR, 300),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 147) || (THERMISTORHEATER_1 == 147) || (THERMISTORHEATER_2 == 147) || (THERMISTORHEATER_3 == 147) || (THERMISTORBED == 147) // Pt100 with 4k7 pullup
+const float tempslope_147[] PROGMEM = {
+  TSLOPE(PtAdVal(0,100,4700)*OVERSAMPLENR, 0, PtAdVal(50,100,4700)*OVERSAMPLENR, 50),
+  TSLOPE(PtAdVal(50,100,4700)*OVERSAMPLENR, 50, PtAdVal(100,100,4700)*OVERSAMPLENR, 100),
+  TSLOPE(PtAdVal(100,100,4700)*OVERSAMPLENR, 100, PtAdVal(150,100,4700)*OVERSAMPLENR, 150),
+  TSLOPE(PtAdVal(150,100,4700)*OVERSAMPLENR, 150, PtAdVal(200,100,4700)*OVERSAMPLENR, 200),
+  TSLOPE(PtAdVal(200,100,4700)*OVERSAMPLENR, 200, PtAdVal(250,100,4700)*OVERSAMPLENR, 250),
+  TSLOPE(PtAdVal(250,100,4700)*OVERSAMPLENR, 250, PtAdVal(300,100,4700)*OVERSAMPLENR, 300),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 1010) || (THERMISTORHEATER_1 == 1010) || (THERMISTORHEATER_2 == 1010) || (THERMISTORHEATER_3 == 1010) || (THERMISTORBED == 1010) // Pt1000 with 1k0 pullup
+const float tempslope_1010[] PROGMEM = {
+  TSLOPE(PtAdVal(0,1000,1000)*OVERSAMPLENR, 0, PtAdVal(25,1000,1000)*OVERSAMPLENR, 25),
+  TSLOPE(PtAdVal(25,1000,1000)*OVERSAMPLENR, 25, PtAdVal(50,1000,1000)*OVERSAMPLENR, 50),
+  TSLOPE(PtAdVal(50,1000,1000)*OVERSAMPLENR, 50, PtAdVal(75,1000,1000)*OVERSAMPLENR, 75),
+  TSLOPE(PtAdVal(75,1000,1000)*OVERSAMPLENR, 75, PtAdVal(100,1000,1000)*OVERSAMPLENR, 100),
+  TSLOPE(PtAdVal(100,1000,1000)*OVERSAMPLENR, 100, PtAdVal(125,1000,1000)*OVERSAMPLENR, 125),
+  TSLOPE(PtAdVal(125,1000,1000)*OVERSAMPLENR, 125, PtAdVal(150,1000,1000)*OVERSAMPLENR, 150),
+  TSLOPE(PtAdVal(150,1000,1000)*OVERSAMPLENR, 150, PtAdVal(175,1000,1000)*OVERSAMPLENR, 175),
+  TSLOPE(PtAdVal(175,1000,1000)*OVERSAMPLENR, 175, PtAdVal(200,1000,1000)*OVERSAMPLENR, 200),
+  TSLOPE(PtAdVal(200,1000,1000)*OVERSAMPLENR, 200, PtAdVal(225,1000,1000)*OVERSAMPLENR, 225),
+  TSLOPE(PtAdVal(225,1000,1000)*OVERSAMPLENR, 225, PtAdVal(250,1000,1000)*OVERSAMPLENR, 250),
+  TSLOPE(PtAdVal(250,1000,1000)*OVERSAMPLENR, 250, PtAdVal(275,1000,1000)*OVERSAMPLENR, 275),
+  TSLOPE(PtAdVal(275,1000,1000)*OVERSAMPLENR, 275, PtAdVal(300,1000,1000)*OVERSAMPLENR, 300),
+  0
+};
+#endif
+
+#if (THERMISTORHEATER_0 == 1047) || (THERMISTORHEATER_1 == 1047) || (THERMISTORHEATER_2 == 1047) || (THERMISTORHEATER_3 == 1047) || (THERMISTORBED == 1047) // Pt1000 with 4k7 pullup
+const float tempslope_1047[] PROGMEM = {
+  TSLOPE(PtAdVal(0,1000,4700)*OVERSAMPLENR, 0, PtAdVal(50,1000,4700)*OVERSAMPLENR, 50),
+  TSLOPE(PtAdVal(50,1000,4700)*OVERSAMPLENR, 50, PtAdVal(100,1000,4700)*OVERSAMPLENR, 100),
+  TSLOPE(PtAdVal(100,1000,4700)*OVERSAMPLENR, 100, PtAdVal(150,1000,4700)*OVERSAMPLENR, 150),
+  TSLOPE(PtAdVal(150,1000,4700)*OVERSAMPLENR, 150, PtAdVal(200,1000,4700)*OVERSAMPLENR, 200),
+  TSLOPE(PtAdVal(200,1000,4700)*OVERSAMPLENR, 200, PtAdVal(250,1000,4700)*OVERSAMPLENR, 250),
+  TSLOPE(PtAdVal(250,1000,4700)*OVERSAMPLENR, 250, PtAdVal(300,1000,4700)*OVERSAMPLENR, 300),
+  0
+};
+#endif
+
+#endif // THERMISTORSLOPES_H_
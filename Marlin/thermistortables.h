@@ -1222,15 +1222,39 @@ const short regulatortable_2[][2] PROGMEM = {
 #define _RT_NAME(_N) regulatortable_ ## _N
 #define RT_NAME(_N) _RT_NAME(_N)
 
+// Per segment slopes of the temptables, from scripts/createThermistorSlopes.py
+#include "thermistorslopes.h"
+
+#define _TS_NAME(_N) tempslope_ ## _N
+#define TS_NAME(_N) _TS_NAME(_N)
+
+/**
+ * Converts a raw sum on a temptable and its slopes, the same as scanning the
+ * table for the first entry above raw. The binary search finds the last entry
+ * at or below raw; the first one also covers anything below it and the slope
+ * of the last one is 0, holding its value.
+ */
+FORCE_INLINE float temptable_lookup(const short (*table)[2], const float *slopes, uint8_t length, int raw) {
+  uint8_t lo = 0, hi = length;
+  while (hi - lo > 1) {
+    uint8_t mid = (lo + hi) >> 1;
+    if ((short)pgm_read_word(&table[mid][0]) <= raw) lo = mid; else hi = mid;
+  }
+  return (short)pgm_read_word(&table[lo][1]) +
+    (raw - (short)pgm_read_word(&table[lo][0])) * pgm_read_float(&slopes[lo]);
+}
+
 #ifdef THERMISTORHEATER_0
 # define HEATER_0_TEMPTABLE TT_NAME(THERMISTORHEATER_0)
 # define HEATER_0_TEMPTABLE_LEN COUNT(HEATER_0_TEMPTABLE)
+# define HEATER_0_TEMPSLOPES TS_NAME(THERMISTORHEATER_0)
 #else
 # ifdef HEATER_0_USES_THERMISTOR
 #  error No heater 0 thermistor table specified
 # else  // HEATER_0_USES_THERMISTOR
 #  define HEATER_0_TEMPTABLE NULL
 #  define HEATER_0_TEMPTABLE_LEN 0
+#  define HEATER_0_TEMPSLOPES NULL
 # endif // HEATER_0_USES_THERMISTOR
 #endif
 
@@ -1248,12 +1272,14 @@ const short regulatortable_2[][2] PROGMEM = {
 #ifdef THERMISTORHEATER_1
 # define HEATER_1_TEMPTABLE TT_NAME(THERMISTORHEATER_1)
 # define HEATER_1_TEMPTABLE_LEN COUNT(HEATER_1_TEMPTABLE)
+# define HEATER_1_TEMPSLOPES TS_NAME(THERMISTORHEATER_1)
 #else
 # ifdef HEATER_1_USES_THERMISTOR
 #  error No heater 1 thermistor table specified
 # else  // HEATER_1_USES_THERMISTOR
 #  define HEATER_1_TEMPTABLE NULL
 #  define HEATER_1_TEMPTABLE_LEN 0
+#  define HEATER_1_TEMPSLOPES NULL
 # endif // HEATER_1_USES_THERMISTOR
 #endif
 
@@ -1271,12 +1297,14 @@ const short regulatortable_2[][2] PROGMEM = {
 #ifdef THERMISTORHEATER_2
 # define HEATER_2_TEMPTABLE TT_NAME(THERMISTORHEATER_2)
 # define HEATER_2_TEMPTABLE_LEN COUNT(HEATER_2_TEMPTABLE)
+# define HEATER_2_TEMPSLOPES TS_NAME(THERMISTORHEATER_2)
 #else
 # ifdef HEATER_2_USES_THERMISTOR
 #  error No heater 2 thermistor table specified
 # else  // HEATER_2_USES_THERMISTOR
 #  define HEATER_2_TEMPTABLE NULL
 #  define HEATER_2_TEMPTABLE_LEN 0
+#  define HEATER_2_TEMPSLOPES NULL
 # endif // HEATER_2_USES_THERMISTOR
 #endif
 
@@ -1294,12 +1322,14 @@ const short regulatortable_2[][2] PROGMEM = {
 #ifdef THERMISTORHEATER_3
 # define HEATER_3_TEMPTABLE TT_NAME(THERMISTORHEATER_3)
 # define HEATER_3_TEMPTABLE_LEN COUNT(HEATER_3_TEMPTABLE)
+# define HEATER_3_TEMPSLOPES TS_NAME(THERMISTORHEATER_3)
 #else
 # ifdef HEATER_3_USES_THERMISTOR
 #  error No heater 3 thermistor table specified
 # else  // HEATER_3_USES_THERMISTOR
 #  define HEATER_3_TEMPTABLE NULL
 #  define HEATER_3_TEMPTABLE_LEN 0
+#  define HEATER_3_TEMPSLOPES NULL
 # endif // HEATER_3_USES_THERMISTOR
 #endif
 
@@ -1317,6 +1347,7 @@ const short regulatortable_2[][2] PROGMEM = {
 #ifdef THERMISTORBED
 # define BEDTEMPTABLE TT_NAME(THERMISTORBED)
 # define BEDTEMPTABLE_LEN COUNT(BEDTEMPTABLE)
+# define BEDTEMPSLOPES TS_NAME(THERMISTORBED)
 #else
 # ifdef BED_USES_THERMISTOR
 #  error No bed thermistor table specified
@@ -0,0 +1,165 @@
+#include <cmath>
+
+#include "gtest_marlin.h"
+#include "../../Marlin/BedScan.h"
+#include "../../Marlin/ADC.h"
+
+//===========================================================================
+//================== Firmware stand-ins (stepper, planner, ADC) ==============
+//===========================================================================
+
+float current_position[NUM_AXIS];
+float axis_steps_per_unit[NUM_AXIS] = DEFAULT_AXIS_STEPS_PER_UNIT;
+
+static long motor_count[NUM_AXIS];
+static uint16_t sample_count;
+static uint16_t sample_raw;
+
+long st_get_position(uint8_t axis) { return motor_count[axis]; }
+uint16_t ADC_sampler_count(void) { return sample_count; }
+uint16_t ADC_sampler_latest(void) { return sample_raw; }
+uint16_t readADC_SingleEnded(uint8_t) { return 0; }
+uint16_t readADC_Differential(uint8_t, uint8_t) { return 0; }
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+// Laser spot position of the nozzle position (x, y)
+static float spot_x(float x) { return x + X_PROBE_OFFSET_FROM_EXTRUDER; }
+static float spot_y(float y) { return y + Y_PROBE_OFFSET_FROM_EXTRUDER; }
+
+// Raw reading for a bed that rises bed_slope (10) counts per mm of X
+static int bed_slope = 10;
+static uint16_t bed_raw(float spot_x) { return 20000 + bed_slope * spot_x; }
+
+static float bed_height(float spot_x) {
+  return ((float)get_dist_from_raw(bed_raw(spot_x)) - LDIST_OFFSET) / LDIST_UNIT_DIVISOR;
+}
+
+// Puts the motors at nozzle position (x, y), as COREXY counts them
+static void move_motors(float x, float y) {
+  long sx = lround(x * axis_steps_per_unit[X_AXIS]),
+       sy = lround(y * axis_steps_per_unit[Y_AXIS]);
+  motor_count[X_AXIS] = sx + sy;
+  motor_count[Y_AXIS] = sx - sy;
+}
+
+// Sweeps one row at nozzle y from x0 to x1, with one conversion per step
+static void sweep(uint8_t row, float y, float x0, float x1, float step) {
+  current_position[X_AXIS] = x0;
+  current_position[Y_AXIS] = y;
+  move_motors(x0, y);
+  BedScan__BeginRow(row);
+
+  float dir = x1 > x0 ? step : -step;
+  for (float x = x0; (x1 - x) * dir >= 0; x += dir) {
+    move_motors(x, y);
+    sample_raw = bed_raw(spot_x(x - dir / 2)); // Conversion centered between samples
+    sample_count++;
+    BedScan__Update();
+  }
+}
+
+static float row_y(uint8_t j) {
+  return FRONT_SCAN_BED_POSITION - Y_PROBE_OFFSET_FROM_EXTRUDER + j * SCAN_Y_DIST;
+}
+
+class bed_scan_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		BedScan__Start();
+		sample_count = 0;
+		bed_slope = 10;
+	}
+	float left() { return LEFT_SCAN_BED_POSITION - X_PROBE_OFFSET_FROM_EXTRUDER - SCAN_X_DIST / 2; }
+	float right() { return RIGHT_SCAN_BED_POSITION - X_PROBE_OFFSET_FROM_EXTRUDER + SCAN_X_DIST / 2; }
+};
+
+TEST_F(bed_scan_test, raster_bins_samples_into_cells)
+{
+	for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++) {
+		if (j & 1) sweep(j, row_y(j), right(), left(), 0.5);
+		else sweep(j, row_y(j), left(), right(), 0.5);
+		EXPECT_EQ(BedScan__EndRow(), 0);
+	}
+	ASSERT_TRUE(BedScan__Finish());
+
+	for (uint8_t i = 0; i < SCAN_GRID_POINTS; i++) {
+		float x = LEFT_SCAN_BED_POSITION + i * SCAN_X_DIST;
+		for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++)
+			EXPECT_NEAR(BedScan__Height(i, j), bed_height(x), 0.005) << "cell " << (int)i << "," << (int)j;
+	}
+	EXPECT_NEAR(BedScan__PlaneHeight(LEFT_SCAN_BED_POSITION, 100), bed_height(LEFT_SCAN_BED_POSITION), 0.005);
+	EXPECT_NEAR(BedScan__PlaneHeight(RIGHT_SCAN_BED_POSITION, 0), bed_height(RIGHT_SCAN_BED_POSITION), 0.005);
+}
+
+TEST_F(bed_scan_test, samples_off_the_row_are_dropped)
+{
+	// The row 0 band ends half a grid spacing from its center
+	sweep(0, row_y(0) + SCAN_Y_DIST, left(), right(), 0.5);
+	EXPECT_EQ(BedScan__EndRow(), SCAN_GRID_POINTS);
+	EXPECT_FALSE(BedScan__Finish());
+}
+
+TEST_F(bed_scan_test, empty_rows_are_copied)
+{
+	sweep(0, row_y(0), left(), right(), 0.5);
+	EXPECT_EQ(BedScan__EndRow(), 0);
+	ASSERT_TRUE(BedScan__Finish());
+
+	float x = LEFT_SCAN_BED_POSITION + 3 * SCAN_X_DIST;
+	EXPECT_NEAR(BedScan__Height(3, SCAN_GRID_POINTS - 1), bed_height(x), 0.005);
+}
+
+#if ENABLED(LASER_MESH_LEVELING)
+
+TEST_F(bed_scan_test, mesh_follows_the_grid)
+{
+	EXPECT_FALSE(BedScan__SetMeshActive(true)); // No grid yet
+
+	for (uint8_t j = 0; j < SCAN_GRID_POINTS; j++) {
+		sweep(j, row_y(j), left(), right(), 0.5);
+		EXPECT_EQ(BedScan__EndRow(), 0);
+	}
+	ASSERT_TRUE(BedScan__Finish());
+	EXPECT_FALSE(BedScan__SetMeshActive(true)); // Not stored yet
+	BedScan__StoreMesh();
+	EXPECT_TRUE(BedScan__SetMeshActive(true));
+
+	// The bed is linear in X, so bilinear interpolation is exact between grid
+	// points and the mean is the height at the center
+	float mean = bed_height((LEFT_SCAN_BED_POSITION + RIGHT_SCAN_BED_POSITION) / 2.0);
+	float x = LEFT_SCAN_BED_POSITION + 4.5 * SCAN_X_DIST;
+	EXPECT_NEAR(BedScan__MeshZ(x, 50), bed_height(x) - mean, 0.005);
+	EXPECT_NEAR(BedScan__MeshZ(RIGHT_SCAN_BED_POSITION, BACK_SCAN_BED_POSITION), bed_height(RIGHT_SCAN_BED_POSITION) - mean, 0.005);
+
+	// Outside the grid the edge is held
+	EXPECT_NEAR(BedScan__MeshZ(LEFT_SCAN_BED_POSITION - 20, FRONT_SCAN_BED_POSITION - 20), bed_height(LEFT_SCAN_BED_POSITION) - mean, 0.005);
+
+	// A scan that isn't stored, as in a G29 dry run, leaves the mesh alone
+	float stored = BedScan__MeshZ(x, 50);
+	bed_slope = 20;
+	BedScan__Start();
+	sweep(0, row_y(0), left(), right(), 0.5);
+	EXPECT_EQ(BedScan__EndRow(), 0);
+	ASSERT_TRUE(BedScan__Finish());
+	EXPECT_TRUE(BedScan__MeshActive());
+	EXPECT_EQ(BedScan__MeshZ(x, 50), stored);
+
+	BedScan__StoreMesh();
+	EXPECT_NE(BedScan__MeshZ(x, 50), stored);
+}
+
+TEST_F(bed_scan_test, cell_index_is_clamped)
+{
+	EXPECT_EQ(BedScan__CellX(LEFT_SCAN_BED_POSITION - 5), 0);
+	EXPECT_EQ(BedScan__CellX(LEFT_SCAN_BED_POSITION + 2.5 * SCAN_X_DIST), 2);
+	EXPECT_EQ(BedScan__CellX(RIGHT_SCAN_BED_POSITION), SCAN_GRID_POINTS - 2);
+	EXPECT_EQ(BedScan__CellY(BACK_SCAN_BED_POSITION + 5), SCAN_GRID_POINTS - 2);
+	EXPECT_NEAR(BedScan__GridX(SCAN_GRID_POINTS - 1), RIGHT_SCAN_BED_POSITION, 0.001);
+}
+
+#endif // LASER_MESH_LEVELING
@@ -0,0 +1,129 @@
+#include <string>
+
+#include "gtest_marlin.h"
+#include "mocks/hardware.h"
+#include "../../Marlin/BinaryProtocol.h"
+#include "../../Marlin/language.h"
+
+const char errormagic[] PROGMEM = "Error:";
+
+static std::string frame(uint8_t seq, uint8_t type, const std::string& payload)
+{
+	std::string out;
+	out += (char)BINARY_FRAME_SYNC;
+	out += (char)seq;
+	out += (char)type;
+	out += (char)payload.size();
+	out += payload;
+	uint16_t crc = 0xFFFF;
+	for (size_t i = 1; i < out.size(); i++) crc = BinaryProtocol__Crc16(crc, out[i]);
+	out += (char)(crc & 0xFF);
+	out += (char)(crc >> 8);
+	return out;
+}
+
+static void receive(const std::string& bytes)
+{
+	Hardware__SerialInject(bytes.data(), bytes.size());
+	Hardware__SerialPoll();
+}
+
+class binary_protocol_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		customizedSerial.begin(BAUDRATE);
+		customizedSerial.flush();
+		BinaryProtocol__SetEnabled(true);
+	}
+};
+
+TEST_F(binary_protocol_test, crc16_ccitt_check_value)
+{
+	const char *check = "123456789";
+	uint16_t crc = 0xFFFF;
+	while (*check) crc = BinaryProtocol__Crc16(crc, *check++);
+	EXPECT_EQ(crc, 0x29B1);
+}
+
+TEST_F(binary_protocol_test, line_frame_is_queued_and_acked)
+{
+	char buffer[MAX_CMD_SIZE];
+	receive(frame(0, BINARY_FRAME_LINE, "M105"));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_LINE);
+	EXPECT_STREQ(buffer, "M105");
+
+	BinaryProtocol__SendAck(3);
+	EXPECT_EQ(Hardware__SerialTake(), frame(0, BINARY_FRAME_ACK, std::string(1, 3)));
+
+	// Nothing new to report
+	BinaryProtocol__SendAck(3);
+	EXPECT_EQ(Hardware__SerialTake(), "");
+}
+
+TEST_F(binary_protocol_test, move_frame_decodes_fields)
+{
+	char buffer[MAX_CMD_SIZE];
+	float x = 12.5, f = 3000;
+	std::string payload(1, (char)(BIT(X_AXIS) | BIT(BINARY_MOVE_F)));
+	payload.append((const char *)&x, sizeof(x));
+	payload.append((const char *)&f, sizeof(f));
+	receive(frame(0, BINARY_FRAME_MOVE, payload));
+	ASSERT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_MOVE);
+
+	float values[BINARY_MOVE_FIELDS] = { 0 };
+	uint8_t fields = BinaryProtocol__DecodeMove(buffer, values);
+	EXPECT_EQ(fields, BIT(X_AXIS) | BIT(BINARY_MOVE_F));
+	EXPECT_EQ(values[X_AXIS], 12.5);
+	EXPECT_EQ(values[Y_AXIS], 0);
+	EXPECT_EQ(values[BINARY_MOVE_F], 3000);
+}
+
+TEST_F(binary_protocol_test, corrupt_frame_is_nakked_once)
+{
+	char buffer[MAX_CMD_SIZE];
+	std::string bad = frame(0, BINARY_FRAME_LINE, "G1 X1");
+	bad[5] ^= 0x01;
+	receive(bad + frame(1, BINARY_FRAME_LINE, "G1 X2"));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_NONE);
+	EXPECT_EQ(Hardware__SerialTake(), frame(0, BINARY_FRAME_NAK, ""));
+
+	// Go-back-N: the resend from the expected sequence number is accepted
+	receive(frame(0, BINARY_FRAME_LINE, "G1 X1"));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_LINE);
+	EXPECT_STREQ(buffer, "G1 X1");
+}
+
+TEST_F(binary_protocol_test, move_frame_of_the_wrong_length_is_nakked)
+{
+	char buffer[MAX_CMD_SIZE];
+	float x = 12.5, f = 3000;
+	std::string payload(1, (char)(BIT(X_AXIS) | BIT(BINARY_MOVE_F)));
+	payload.append((const char *)&x, sizeof(x));
+	receive(frame(0, BINARY_FRAME_MOVE, payload));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_NONE);
+	EXPECT_EQ(Hardware__SerialTake(), std::string("Error:") + MSG_ERR_BINARY_FRAME + "\n" + frame(0, BINARY_FRAME_NAK, ""));
+
+	// Not acked, and the resend is taken under the same sequence number
+	BinaryProtocol__SendAck(3);
+	EXPECT_EQ(Hardware__SerialTake(), "");
+	payload.append((const char *)&f, sizeof(f));
+	receive(frame(0, BINARY_FRAME_MOVE, payload));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_MOVE);
+}
+
+TEST_F(binary_protocol_test, duplicate_frame_is_acked_again)
+{
+	char buffer[MAX_CMD_SIZE];
+	receive(frame(0, BINARY_FRAME_LINE, "G28"));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_LINE);
+	BinaryProtocol__SendAck(3);
+	Hardware__SerialTake();
+
+	receive(frame(0, BINARY_FRAME_LINE, "G28"));
+	EXPECT_EQ(BinaryProtocol__Read(buffer), BINARY_FRAME_NONE);
+	BinaryProtocol__SendAck(3);
+	EXPECT_EQ(Hardware__SerialTake(), frame(0, BINARY_FRAME_ACK, std::string(1, 3)));
+}
@@ -0,0 +1,111 @@
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/TwiQueue.h"
+#include "../../Marlin/Voxel8_I2C_Commands.h"
+#include "mocks/hardware.h"
+
+void idle() {}
+
+// Replies of a cartridge to the commands read into the cache, in order:
+// serial number, programmer station, type, size, material, firmware version
+static const std::string info_replies("\x03\x01\x00\x2A" "\x05" "\x02" "\x04" "\x07" "\x0B", 9);
+
+static const char diagnostics[] =
+	"Serial Number = 130042\n\n"
+	"Programmer Station = 5\n"
+	"I2C_target_address Type = 2\n"
+	"Cartridge Size = 4\n"
+	"Cartridge Material = 7\n"
+	"Cartridge Firmware Version = 11\n";
+
+static void run_updates(int count)
+{
+	for (int i = 0; i < count; i++) {
+		I2C__UpdateCartridgeInfo();
+		Hardware__AdvanceMs(1);
+	}
+}
+
+class cartridge_info_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		TwiQueue__Init();
+		I2C__InvalidateCartridgeInfo(0);
+		I2C__InvalidateCartridgeInfo(1);
+		run_updates(1);
+		cartridge = MockTwiDevice();
+		Hardware__TwiAttach(CART0_ADDR, &cartridge);
+	}
+
+	MockTwiDevice cartridge;
+};
+
+TEST_F(cartridge_info_test, read_in_the_background_once)
+{
+	cartridge.response = info_replies;
+	EXPECT_EQ(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+
+	I2C__RequestCartridgeInfo(0);
+	run_updates(10);
+	const CartridgeInfo *info = I2C__GetCartridgeInfo(0);
+	ASSERT_NE(info, (const CartridgeInfo *)NULL);
+	EXPECT_EQ(info->serialProgrammerStation, 3);
+	EXPECT_EQ(info->serialType, 1);
+	EXPECT_EQ(info->serialNumber, 42);
+	EXPECT_EQ(info->programmerStation, 5);
+	EXPECT_EQ(info->type, 2);
+	EXPECT_EQ(info->size, 4);
+	EXPECT_EQ(info->material, 7);
+	EXPECT_EQ(info->firmwareVersion, 11);
+	EXPECT_EQ(cartridge.written, std::string("\x08\xFF\xFF\x12\xFF\xFF\x11\xFF\xFF"
+	                                         "\x09\xFF\xFF\x10\xFF\xFF\x14\xFF\xFF", 18));
+
+	// Served from RAM afterwards
+	cartridge.written.clear();
+	Hardware__SerialTake();
+	I2C__PrintDiagnostics(CART0_ADDR);
+	EXPECT_TRUE(cartridge.written.empty());
+	EXPECT_EQ(Hardware__SerialTake(), diagnostics);
+
+	I2C__InvalidateCartridgeInfo(0);
+	EXPECT_EQ(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+}
+
+TEST_F(cartridge_info_test, cache_prints_what_the_direct_reads_print)
+{
+	cartridge.response = info_replies;
+	Hardware__SerialTake();
+	I2C__PrintDiagnostics(CART0_ADDR);
+	EXPECT_EQ(Hardware__SerialTake(), diagnostics);
+	EXPECT_TRUE(cartridge.response.empty());
+}
+
+TEST_F(cartridge_info_test, removal_during_a_read_drops_it)
+{
+	cartridge.response = info_replies;
+	I2C__RequestCartridgeInfo(0);
+	run_updates(2);
+	I2C__InvalidateCartridgeInfo(0);
+	run_updates(10);
+	EXPECT_EQ(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+}
+
+TEST_F(cartridge_info_test, failed_read_is_retried)
+{
+	// Not answering yet, as while booting
+	Hardware__TwiAttach(CART0_ADDR, NULL);
+	I2C__RequestCartridgeInfo(0);
+	run_updates(10);
+	EXPECT_EQ(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+
+	cartridge.response = info_replies;
+	Hardware__TwiAttach(CART0_ADDR, &cartridge);
+	run_updates(10);
+	EXPECT_EQ(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+	run_updates(CARTRIDGE_INFO_RETRY);
+	ASSERT_NE(I2C__GetCartridgeInfo(0), (const CartridgeInfo *)NULL);
+	EXPECT_EQ(I2C__GetCartridgeInfo(0)->firmwareVersion, 11);
+}
@@ -85,3 +85,34 @@ TEST(cartridge_test, cartridge_enable_test) {
 	EXPECT_EQ(Cartridge__Present(FFF_INDEX),true);
 	EXPECT_EQ(Cartridge__Present(SILVER_INDEX),true);
 }
+
+//===========================================================================
+//======================= Metadata cache notifications ======================
+//===========================================================================
+
+static int info_requested[NUMBER_OF_CARTRIDGES];
+static int info_invalidated[NUMBER_OF_CARTRIDGES];
+
+void I2C__RequestCartridgeInfo(uint8_t cartNumber) { info_requested[cartNumber]++; }
+void I2C__InvalidateCartridgeInfo(uint8_t cartNumber) { info_invalidated[cartNumber]++; }
+
+TEST(cartridge_test, cartridge_info_follows_insertion)
+{
+	Cartridge__SetPresentCheck(true);
+	CART0_SIG2_PIN = LOW;
+	Cartridge__Update();
+	info_requested[FFF_INDEX] = info_invalidated[FFF_INDEX] = 0;
+
+	// Read once on insertion, not on every update
+	CART0_SIG2_PIN = HIGH;
+	Cartridge__Update();
+	Cartridge__Update();
+	EXPECT_EQ(info_requested[FFF_INDEX], 1);
+	EXPECT_EQ(info_invalidated[FFF_INDEX], 0);
+
+	CART0_SIG2_PIN = LOW;
+	Cartridge__Update();
+	Cartridge__Update();
+	EXPECT_EQ(info_requested[FFF_INDEX], 1);
+	EXPECT_EQ(info_invalidated[FFF_INDEX], 1);
+}
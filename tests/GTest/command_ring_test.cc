@@ -0,0 +1,117 @@
+#include <deque>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#include "gtest_marlin.h"
+#include "../../Marlin/CommandRing.h"
+
+class command_ring_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		CommandRing__Init(&ring, buffer, sizeof(buffer));
+	}
+
+	bool push(const std::string& command, uint8_t flags = 0)
+	{
+		return CommandRing__Push(&ring, command.c_str(), command.size() + 1, flags);
+	}
+
+	char buffer[CMD_RING_SIZE];
+	CommandRing ring;
+};
+
+TEST_F(command_ring_test, packs_short_lines_deeper_than_bufsize)
+{
+	const std::string line = "N1234 G1 X123.456 Y78.901 E0.04567*93";
+	int count = 0;
+	while (push(line)) count++;
+	EXPECT_EQ(count, CMD_RING_SIZE / (line.size() + 1 + COMMAND_RING_HEADER));
+	EXPECT_GE(count, 2 * BUFSIZE);
+	EXPECT_LT(CommandRing__Room(&ring), line.size() + 1);
+
+	// The longest command always fits in an empty ring
+	CommandRing__Clear(&ring);
+	EXPECT_TRUE(push(std::string(MAX_CMD_SIZE - 1, 'G')));
+}
+
+TEST_F(command_ring_test, keeps_order_flags_and_binary_payloads)
+{
+	const char move[] = { 0x03, 0x00, 0x00, 0x48, 0x41, 0x00, 0x00, 0x00, 0x00 };
+	EXPECT_TRUE(push("G28", 0x80));
+	EXPECT_TRUE(CommandRing__Push(&ring, move, sizeof(move), 0x02));
+	EXPECT_TRUE(push("M105"));
+	EXPECT_EQ(CommandRing__Count(&ring), 3);
+
+	uint8_t flags;
+	EXPECT_STREQ(CommandRing__Front(&ring, &flags), "G28");
+	EXPECT_EQ(flags, 0x80);
+	CommandRing__Pop(&ring);
+	EXPECT_EQ(std::string(CommandRing__Front(&ring, &flags), sizeof(move)), std::string(move, sizeof(move)));
+	EXPECT_EQ(flags, 0x02);
+	CommandRing__Pop(&ring);
+	EXPECT_STREQ(CommandRing__Front(&ring, NULL), "M105");
+	CommandRing__Pop(&ring);
+	EXPECT_EQ(CommandRing__Front(&ring, NULL), (char *)NULL);
+	EXPECT_EQ(CommandRing__Count(&ring), 0);
+}
+
+// Random lengths against a plain queue, with the ring kept near full so
+// commands keep wrapping around the end of the buffer
+TEST_F(command_ring_test, wraps_around_without_splitting_commands)
+{
+	std::deque<std::string> model;
+	srand(7);
+	for (int i = 0; i < 20000; i++) {
+		if (rand() % 3) {
+			std::string command(rand() % (MAX_CMD_SIZE - 1), 'A' + i % 26);
+			bool fits = command.size() + 1 <= CommandRing__Room(&ring);
+			ASSERT_EQ(push(command, i & 0x7F), fits) << "push " << i;
+			if (fits) model.push_back(command);
+		}
+		else if (!model.empty()) {
+			uint8_t flags;
+			const char *front = CommandRing__Front(&ring, &flags);
+			ASSERT_TRUE(front != NULL);
+			ASSERT_EQ(std::string(front), model.front()) << "pop " << i;
+			// Text is never split, so it can be parsed in place
+			ASSERT_LE(front + model.front().size() + 1, buffer + sizeof(buffer));
+			CommandRing__Pop(&ring);
+			model.pop_front();
+		}
+		ASSERT_EQ(CommandRing__Count(&ring), model.size());
+	}
+}
+
+// Pushes into a copy of the ring until it is full, at random fill levels
+TEST_F(command_ring_test, slots_count_the_commands_that_still_fit)
+{
+	char copy_buffer[CMD_RING_SIZE];
+	srand(11);
+	for (int i = 0; i < 5000; i++) {
+		if (rand() % 2) push(std::string(rand() % (MAX_CMD_SIZE - 1), 'G'));
+		else CommandRing__Pop(&ring);
+
+		uint8_t length = 1 + rand() % (MAX_CMD_SIZE - 1);
+		CommandRing copy = ring;
+		copy.buffer = copy_buffer;
+		memcpy(copy_buffer, buffer, sizeof(buffer));
+		std::string command(length - 1, 'M');
+		int pushed = 0;
+		while (CommandRing__Push(&copy, command.c_str(), length, 0)) pushed++;
+		ASSERT_EQ(CommandRing__Slots(&ring, length), pushed) << "step " << i;
+	}
+}
+
+TEST_F(command_ring_test, full_ring_takes_commands_again_once_drained)
+{
+	const std::string line(60, 'G');
+	while (push(line)) {}
+	EXPECT_FALSE(push("M105"));
+	CommandRing__Pop(&ring);
+	EXPECT_TRUE(push("M105"));
+	while (CommandRing__Count(&ring)) CommandRing__Pop(&ring);
+	EXPECT_EQ(CommandRing__Room(&ring), CMD_RING_SIZE - COMMAND_RING_HEADER);
+}
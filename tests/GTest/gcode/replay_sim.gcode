@@ -0,0 +1,1202 @@
+; Command pipeline benchmark for replay_sim: a spiral of 0.5mm segments at
+; print speed, which needs more lines per second than long moves do, with a
+; temperature query every 100 lines as a host would send
+G21
+G90
+M82
+G92 X0 Y0 Z0 E0
+G1 Z0.3 F600
+G0 X95 Y75 F9000
+G1 F3000
+G1 X94.986 Y75.500 E0.0165
+G1 X94.959 Y75.999 E0.0330
+G1 X94.920 Y76.497 E0.0495
+G1 X94.868 Y76.995 E0.0660
+G1 X94.804 Y77.491 E0.0825
+G1 X94.728 Y77.985 E0.0990
+G1 X94.639 Y78.477 E0.1155
+G1 X94.538 Y78.966 E0.1320
+G1 X94.424 Y79.453 E0.1485
+G1 X94.299 Y79.937 E0.1650
+G1 X94.161 Y80.418 E0.1815
+G1 X94.011 Y80.895 E0.1980
+G1 X93.850 Y81.368 E0.2145
+G1 X93.676 Y81.837 E0.2310
+G1 X93.491 Y82.301 E0.2475
+G1 X93.294 Y82.761 E0.2640
+G1 X93.086 Y83.215 E0.2805
+G1 X92.866 Y83.664 E0.2970
+G1 X92.635 Y84.108 E0.3135
+G1 X92.393 Y84.545 E0.3300
+G1 X92.140 Y84.976 E0.3465
+G1 X91.877 Y85.401 E0.3630
+G1 X91.602 Y85.819 E0.3795
+G1 X91.317 Y86.230 E0.3960
+G1 X91.022 Y86.633 E0.4125
+G1 X90.717 Y87.029 E0.4290
+G1 X90.402 Y87.417 E0.4455
+G1 X90.077 Y87.797 E0.4620
+G1 X89.743 Y88.169 E0.4785
+G1 X89.399 Y88.532 E0.4950
+G1 X89.046 Y88.887 E0.5114
+G1 X88.685 Y89.232 E0.5279
+G1 X88.314 Y89.568 E0.5444
+G1 X87.936 Y89.894 E0.5609
+G1 X87.549 Y90.211 E0.5774
+G1 X87.154 Y90.518 E0.5939
+G1 X86.752 Y90.815 E0.6104
+G1 X86.342 Y91.101 E0.6269
+G1 X85.926 Y91.377 E0.6434
+G1 X85.502 Y91.643 E0.6599
+G1 X85.072 Y91.897 E0.6764
+G1 X84.635 Y92.141 E0.6929
+G1 X84.192 Y92.373 E0.7094
+G1 X83.744 Y92.594 E0.7259
+G1 X83.290 Y92.803 E0.7424
+G1 X82.831 Y93.001 E0.7589
+G1 X82.367 Y93.187 E0.7754
+G1 X81.898 Y93.361 E0.7919
+G1 X81.425 Y93.524 E0.8084
+G1 X80.948 Y93.674 E0.8249
+G1 X80.468 Y93.812 E0.8414
+G1 X79.984 Y93.937 E0.8579
+G1 X79.497 Y94.050 E0.8744
+G1 X79.007 Y94.151 E0.8909
+G1 X78.515 Y94.239 E0.9074
+G1 X78.021 Y94.315 E0.9239
+G1 X77.525 Y94.377 E0.9404
+G1 X77.027 Y94.428 E0.9569
+G1 X76.529 Y94.465 E0.9734
+G1 X76.029 Y94.490 E0.9899
+G1 X75.529 Y94.501 E1.0064
+G1 X75.030 Y94.500 E1.0229
+G1 X74.530 Y94.487 E1.0394
+G1 X74.031 Y94.460 E1.0559
+G1 X73.532 Y94.421 E1.0724
+G1 X73.035 Y94.368 E1.0889
+G1 X72.539 Y94.303 E1.1054
+G1 X72.045 Y94.226 E1.1219
+G1 X71.554 Y94.135 E1.1384
+G1 X71.064 Y94.032 E1.1549
+G1 X70.578 Y93.917 E1.1714
+G1 X70.095 Y93.789 E1.1879
+G1 X69.615 Y93.649 E1.2044
+G1 X69.139 Y93.496 E1.2209
+G1 X68.667 Y93.331 E1.2374
+G1 X68.199 Y93.154 E1.2539
+G1 X67.736 Y92.965 E1.2704
+G1 X67.279 Y92.764 E1.2869
+G1 X66.826 Y92.551 E1.3034
+G1 X66.379 Y92.327 E1.3199
+G1 X65.939 Y92.091 E1.3364
+G1 X65.504 Y91.844 E1.3529
+G1 X65.076 Y91.586 E1.3694
+G1 X64.654 Y91.317 E1.3859
+G1 X64.240 Y91.037 E1.4024
+G1 X63.834 Y90.746 E1.4189
+G1 X63.434 Y90.445 E1.4354
+G1 X63.043 Y90.134 E1.4519
+G1 X62.660 Y89.812 E1.4684
+G1 X62.286 Y89.481 E1.4848
+G1 X61.920 Y89.140 E1.5013
+G1 X61.563 Y88.790 E1.5178
+G1 X61.215 Y88.431 E1.5343
+G1 X60.877 Y88.063 E1.5508
+G1 X60.549 Y87.686 E1.5673
+G1 X60.230 Y87.301 E1.5838
+G1 X59.922 Y86.907 E1.6003
+G1 X59.624 Y86.506 E1.6168
+G1 X59.336 Y86.097 E1.6333
+G1 X59.059 Y85.680 E1.6498
+M105
+G1 X58.793 Y85.257 E1.6663
+G1 X58.539 Y84.827 E1.6828
+G1 X58.295 Y84.390 E1.6993
+G1 X58.063 Y83.947 E1.7158
+G1 X57.843 Y83.498 E1.7323
+G1 X57.635 Y83.044 E1.7488
+G1 X57.438 Y82.584 E1.7653
+G1 X57.253 Y82.120 E1.7818
+G1 X57.081 Y81.650 E1.7983
+G1 X56.921 Y81.177 E1.8148
+G1 X56.774 Y80.699 E1.8313
+G1 X56.639 Y80.218 E1.8478
+G1 X56.517 Y79.733 E1.8643
+G1 X56.407 Y79.245 E1.8808
+G1 X56.310 Y78.755 E1.8973
+G1 X56.226 Y78.262 E1.9138
+G1 X56.156 Y77.767 E1.9303
+G1 X56.098 Y77.270 E1.9468
+G1 X56.053 Y76.772 E1.9633
+G1 X56.021 Y76.273 E1.9798
+G1 X56.003 Y75.774 E1.9963
+G1 X55.997 Y75.274 E2.0128
+G1 X56.005 Y74.774 E2.0293
+G1 X56.026 Y74.274 E2.0458
+G1 X56.060 Y73.776 E2.0623
+G1 X56.107 Y73.278 E2.0788
+G1 X56.168 Y72.782 E2.0953
+G1 X56.241 Y72.287 E2.1118
+G1 X56.327 Y71.795 E2.1283
+G1 X56.427 Y71.305 E2.1448
+G1 X56.539 Y70.818 E2.1613
+G1 X56.664 Y70.333 E2.1778
+G1 X56.802 Y69.853 E2.1943
+G1 X56.952 Y69.376 E2.2108
+G1 X57.115 Y68.903 E2.2273
+G1 X57.291 Y68.435 E2.2438
+G1 X57.478 Y67.972 E2.2603
+G1 X57.678 Y67.514 E2.2768
+G1 X57.890 Y67.061 E2.2933
+G1 X58.114 Y66.614 E2.3098
+G1 X58.350 Y66.173 E2.3263
+G1 X58.598 Y65.739 E2.3428
+G1 X58.856 Y65.311 E2.3593
+G1 X59.126 Y64.890 E2.3758
+G1 X59.408 Y64.477 E2.3923
+G1 X59.700 Y64.071 E2.4087
+G1 X60.002 Y63.673 E2.4252
+G1 X60.316 Y63.284 E2.4417
+G1 X60.639 Y62.903 E2.4582
+G1 X60.973 Y62.530 E2.4747
+G1 X61.316 Y62.167 E2.4912
+G1 X61.669 Y61.813 E2.5077
+G1 X62.031 Y61.468 E2.5242
+G1 X62.402 Y61.133 E2.5407
+G1 X62.782 Y60.808 E2.5572
+G1 X63.171 Y60.494 E2.5737
+G1 X63.568 Y60.190 E2.5902
+G1 X63.973 Y59.896 E2.6067
+G1 X64.385 Y59.614 E2.6232
+G1 X64.805 Y59.343 E2.6397
+G1 X65.232 Y59.083 E2.6562
+G1 X65.666 Y58.834 E2.6727
+G1 X66.107 Y58.598 E2.6892
+G1 X66.553 Y58.373 E2.7057
+G1 X67.006 Y58.160 E2.7222
+G1 X67.464 Y57.960 E2.7387
+G1 X67.927 Y57.771 E2.7552
+G1 X68.395 Y57.596 E2.7717
+G1 X68.867 Y57.433 E2.7882
+G1 X69.344 Y57.282 E2.8047
+G1 X69.825 Y57.145 E2.8212
+G1 X70.309 Y57.021 E2.8377
+G1 X70.796 Y56.909 E2.8542
+G1 X71.287 Y56.811 E2.8707
+G1 X71.779 Y56.726 E2.8872
+G1 X72.274 Y56.654 E2.9037
+G1 X72.771 Y56.596 E2.9202
+G1 X73.269 Y56.551 E2.9367
+G1 X73.768 Y56.520 E2.9532
+G1 X74.267 Y56.502 E2.9697
+G1 X74.767 Y56.497 E2.9862
+G1 X75.267 Y56.507 E3.0027
+G1 X75.766 Y56.529 E3.0192
+G1 X76.265 Y56.565 E3.0357
+G1 X76.762 Y56.615 E3.0522
+G1 X77.258 Y56.678 E3.0687
+G1 X77.753 Y56.754 E3.0852
+G1 X78.244 Y56.844 E3.1017
+G1 X78.734 Y56.947 E3.1182
+G1 X79.220 Y57.063 E3.1347
+G1 X79.703 Y57.193 E3.1512
+G1 X80.182 Y57.335 E3.1677
+G1 X80.657 Y57.491 E3.1842
+G1 X81.128 Y57.659 E3.2007
+G1 X81.594 Y57.840 E3.2172
+G1 X82.055 Y58.034 E3.2337
+G1 X82.510 Y58.240 E3.2502
+G1 X82.960 Y58.458 E3.2667
+G1 X83.403 Y58.689 E3.2831
+G1 X83.841 Y58.931 E3.2996
+M105
+G1 X84.271 Y59.186 E3.3161
+G1 X84.694 Y59.452 E3.3326
+G1 X85.110 Y59.730 E3.3491
+G1 X85.518 Y60.018 E3.3656
+G1 X85.918 Y60.318 E3.3821
+G1 X86.310 Y60.629 E3.3986
+G1 X86.693 Y60.950 E3.4151
+G1 X87.067 Y61.282 E3.4316
+G1 X87.432 Y61.623 E3.4481
+G1 X87.787 Y61.975 E3.4646
+G1 X88.133 Y62.336 E3.4811
+G1 X88.469 Y62.707 E3.4976
+G1 X88.794 Y63.086 E3.5141
+G1 X89.109 Y63.475 E3.5306
+G1 X89.413 Y63.871 E3.5471
+G1 X89.706 Y64.276 E3.5636
+G1 X89.988 Y64.689 E3.5801
+G1 X90.258 Y65.110 E3.5966
+G1 X90.517 Y65.538 E3.6131
+G1 X90.764 Y65.973 E3.6296
+G1 X90.998 Y66.414 E3.6461
+G1 X91.221 Y66.862 E3.6626
+G1 X91.431 Y67.315 E3.6791
+G1 X91.629 Y67.775 E3.6956
+G1 X91.813 Y68.239 E3.7121
+G1 X91.985 Y68.709 E3.7286
+G1 X92.144 Y69.183 E3.7451
+G1 X92.290 Y69.661 E3.7616
+G1 X92.422 Y70.143 E3.7781
+G1 X92.541 Y70.628 E3.7946
+G1 X92.647 Y71.117 E3.8111
+G1 X92.739 Y71.609 E3.8276
+G1 X92.817 Y72.102 E3.8441
+G1 X92.882 Y72.598 E3.8606
+G1 X92.933 Y73.095 E3.8771
+G1 X92.970 Y73.594 E3.8936
+G1 X92.993 Y74.093 E3.9101
+G1 X93.003 Y74.593 E3.9266
+G1 X92.998 Y75.093 E3.9431
+G1 X92.980 Y75.593 E3.9596
+G1 X92.947 Y76.092 E3.9761
+G1 X92.901 Y76.589 E3.9926
+G1 X92.841 Y77.086 E4.0091
+G1 X92.768 Y77.580 E4.0256
+G1 X92.680 Y78.072 E4.0421
+G1 X92.579 Y78.562 E4.0586
+G1 X92.464 Y79.049 E4.0751
+G1 X92.336 Y79.532 E4.0916
+G1 X92.194 Y80.011 E4.1080
+G1 X92.039 Y80.487 E4.1245
+G1 X91.871 Y80.957 E4.1410
+G1 X91.690 Y81.423 E4.1575
+G1 X91.495 Y81.884 E4.1740
+G1 X91.288 Y82.339 E4.1905
+G1 X91.069 Y82.788 E4.2070
+G1 X90.836 Y83.231 E4.2235
+G1 X90.592 Y83.667 E4.2400
+G1 X90.335 Y84.096 E4.2565
+G1 X90.066 Y84.517 E4.2730
+G1 X89.786 Y84.931 E4.2895
+G1 X89.494 Y85.337 E4.3060
+G1 X89.191 Y85.735 E4.3225
+G1 X88.877 Y86.124 E4.3390
+G1 X88.552 Y86.504 E4.3555
+G1 X88.216 Y86.874 E4.3720
+G1 X87.871 Y87.235 E4.3885
+G1 X87.515 Y87.586 E4.4050
+G1 X87.149 Y87.927 E4.4215
+G1 X86.774 Y88.258 E4.4380
+G1 X86.390 Y88.578 E4.4545
+G1 X85.997 Y88.886 E4.4710
+G1 X85.595 Y89.184 E4.4875
+G1 X85.185 Y89.470 E4.5040
+G1 X84.767 Y89.745 E4.5205
+G1 X84.342 Y90.007 E4.5370
+G1 X83.909 Y90.258 E4.5535
+G1 X83.469 Y90.496 E4.5700
+G1 X83.023 Y90.721 E4.5865
+G1 X82.571 Y90.934 E4.6030
+G1 X82.113 Y91.134 E4.6195
+G1 X81.649 Y91.321 E4.6360
+G1 X81.180 Y91.494 E4.6525
+G1 X80.706 Y91.655 E4.6690
+G1 X80.228 Y91.801 E4.6855
+G1 X79.747 Y91.934 E4.7020
+G1 X79.261 Y92.054 E4.7185
+G1 X78.772 Y92.159 E4.7350
+G1 X78.281 Y92.251 E4.7515
+G1 X77.787 Y92.328 E4.7680
+G1 X77.291 Y92.391 E4.7845
+G1 X76.794 Y92.441 E4.8010
+G1 X76.295 Y92.476 E4.8175
+G1 X75.795 Y92.496 E4.8340
+G1 X75.295 Y92.503 E4.8505
+G1 X74.796 Y92.495 E4.8670
+G1 X74.296 Y92.473 E4.8835
+G1 X73.798 Y92.437 E4.9000
+G1 X73.300 Y92.386 E4.9164
+G1 X72.804 Y92.321 E4.9329
+G1 X72.311 Y92.242 E4.9494
+M105
+G1 X71.820 Y92.149 E4.9659
+G1 X71.331 Y92.042 E4.9824
+G1 X70.846 Y91.921 E4.9989
+G1 X70.365 Y91.786 E5.0154
+G1 X69.888 Y91.637 E5.0319
+G1 X69.415 Y91.475 E5.0484
+G1 X68.947 Y91.299 E5.0649
+G1 X68.484 Y91.110 E5.0814
+G1 X68.027 Y90.907 E5.0979
+G1 X67.576 Y90.692 E5.1144
+G1 X67.131 Y90.463 E5.1309
+G1 X66.693 Y90.222 E5.1474
+G1 X66.263 Y89.968 E5.1639
+G1 X65.839 Y89.702 E5.1804
+G1 X65.424 Y89.424 E5.1969
+G1 X65.017 Y89.134 E5.2134
+G1 X64.618 Y88.832 E5.2299
+G1 X64.228 Y88.519 E5.2464
+G1 X63.848 Y88.195 E5.2629
+G1 X63.477 Y87.860 E5.2794
+G1 X63.116 Y87.514 E5.2959
+G1 X62.765 Y87.158 E5.3124
+G1 X62.424 Y86.792 E5.3289
+G1 X62.094 Y86.416 E5.3454
+G1 X61.776 Y86.031 E5.3619
+G1 X61.468 Y85.637 E5.3784
+G1 X61.172 Y85.234 E5.3949
+G1 X60.888 Y84.823 E5.4114
+G1 X60.617 Y84.403 E5.4279
+G1 X60.357 Y83.976 E5.4444
+G1 X60.110 Y83.541 E5.4609
+G1 X59.876 Y83.099 E5.4774
+G1 X59.654 Y82.651 E5.4939
+G1 X59.446 Y82.197 E5.5104
+G1 X59.252 Y81.736 E5.5269
+G1 X59.070 Y81.270 E5.5434
+G1 X58.903 Y80.799 E5.5599
+G1 X58.749 Y80.324 E5.5764
+G1 X58.609 Y79.844 E5.5929
+G1 X58.484 Y79.360 E5.6094
+G1 X58.372 Y78.872 E5.6259
+G1 X58.275 Y78.382 E5.6424
+G1 X58.192 Y77.889 E5.6589
+G1 X58.124 Y77.394 E5.6753
+G1 X58.070 Y76.897 E5.6918
+G1 X58.031 Y76.398 E5.7083
+G1 X58.007 Y75.899 E5.7248
+G1 X57.997 Y75.399 E5.7413
+G1 X58.002 Y74.899 E5.7578
+G1 X58.022 Y74.400 E5.7743
+G1 X58.056 Y73.901 E5.7908
+G1 X58.105 Y73.403 E5.8073
+G1 X58.169 Y72.907 E5.8238
+G1 X58.247 Y72.414 E5.8403
+G1 X58.340 Y71.922 E5.8568
+G1 X58.447 Y71.434 E5.8733
+G1 X58.569 Y70.949 E5.8898
+G1 X58.705 Y70.468 E5.9063
+G1 X58.855 Y69.991 E5.9228
+G1 X59.019 Y69.519 E5.9393
+G1 X59.197 Y69.052 E5.9558
+G1 X59.389 Y68.590 E5.9723
+G1 X59.594 Y68.134 E5.9888
+G1 X59.813 Y67.685 E6.0053
+G1 X60.045 Y67.242 E6.0218
+G1 X60.290 Y66.806 E6.0383
+G1 X60.548 Y66.378 E6.0548
+G1 X60.818 Y65.957 E6.0713
+G1 X61.101 Y65.545 E6.0878
+G1 X61.396 Y65.142 E6.1043
+G1 X61.703 Y64.747 E6.1208
+G1 X62.022 Y64.362 E6.1373
+G1 X62.351 Y63.986 E6.1538
+G1 X62.692 Y63.620 E6.1703
+G1 X63.044 Y63.265 E6.1868
+G1 X63.406 Y62.920 E6.2033
+G1 X63.778 Y62.586 E6.2198
+G1 X64.160 Y62.264 E6.2363
+G1 X64.552 Y61.953 E6.2528
+G1 X64.952 Y61.654 E6.2693
+G1 X65.362 Y61.367 E6.2858
+G1 X65.780 Y61.093 E6.3023
+G1 X66.205 Y60.831 E6.3188
+G1 X66.639 Y60.582 E6.3353
+G1 X67.080 Y60.346 E6.3518
+G1 X67.527 Y60.123 E6.3683
+G1 X67.981 Y59.914 E6.3847
+G1 X68.442 Y59.719 E6.4012
+G1 X68.908 Y59.538 E6.4177
+G1 X69.379 Y59.370 E6.4342
+G1 X69.855 Y59.217 E6.4507
+G1 X70.335 Y59.079 E6.4672
+G1 X70.819 Y58.955 E6.4837
+G1 X71.307 Y58.845 E6.5002
+G1 X71.798 Y58.751 E6.5167
+G1 X72.291 Y58.671 E6.5332
+G1 X72.787 Y58.606 E6.5497
+G1 X73.285 Y58.556 E6.5662
+G1 X73.783 Y58.521 E6.5827
+G1 X74.283 Y58.502 E6.5992
+M105
+G1 X74.783 Y58.497 E6.6157
+G1 X75.283 Y58.508 E6.6322
+G1 X75.782 Y58.534 E6.6487
+G1 X76.280 Y58.575 E6.6652
+G1 X76.777 Y58.631 E6.6817
+G1 X77.272 Y58.702 E6.6982
+G1 X77.764 Y58.788 E6.7147
+G1 X78.254 Y58.889 E6.7312
+G1 X78.740 Y59.005 E6.7477
+G1 X79.223 Y59.135 E6.7642
+G1 X79.701 Y59.280 E6.7807
+G1 X80.175 Y59.440 E6.7972
+G1 X80.643 Y59.614 E6.8137
+G1 X81.106 Y59.803 E6.8302
+G1 X81.564 Y60.005 E6.8467
+G1 X82.014 Y60.221 E6.8632
+G1 X82.458 Y60.451 E6.8797
+G1 X82.895 Y60.694 E6.8962
+G1 X83.324 Y60.951 E6.9127
+G1 X83.745 Y61.221 E6.9292
+G1 X84.157 Y61.503 E6.9457
+G1 X84.561 Y61.798 E6.9622
+G1 X84.956 Y62.105 E6.9787
+G1 X85.340 Y62.424 E6.9952
+G1 X85.715 Y62.755 E7.0117
+G1 X86.080 Y63.097 E7.0282
+G1 X86.433 Y63.451 E7.0447
+G1 X86.776 Y63.814 E7.0612
+G1 X87.108 Y64.189 E7.0776
+G1 X87.427 Y64.573 E7.0941
+G1 X87.735 Y64.967 E7.1106
+G1 X88.031 Y65.370 E7.1271
+G1 X88.313 Y65.783 E7.1436
+G1 X88.583 Y66.203 E7.1601
+G1 X88.840 Y66.632 E7.1766
+G1 X89.084 Y67.069 E7.1931
+G1 X89.313 Y67.513 E7.2096
+G1 X89.529 Y67.964 E7.2261
+G1 X89.731 Y68.421 E7.2426
+G1 X89.919 Y68.884 E7.2591
+G1 X90.092 Y69.353 E7.2756
+G1 X90.251 Y69.827 E7.2921
+G1 X90.395 Y70.306 E7.3086
+G1 X90.523 Y70.789 E7.3251
+G1 X90.637 Y71.276 E7.3416
+G1 X90.736 Y71.766 E7.3581
+G1 X90.819 Y72.259 E7.3746
+G1 X90.887 Y72.755 E7.3911
+G1 X90.939 Y73.252 E7.4076
+G1 X90.976 Y73.750 E7.4241
+G1 X90.997 Y74.250 E7.4406
+G1 X91.003 Y74.750 E7.4571
+G1 X90.993 Y75.249 E7.4736
+G1 X90.968 Y75.749 E7.4901
+G1 X90.926 Y76.247 E7.5066
+G1 X90.870 Y76.744 E7.5231
+G1 X90.797 Y77.238 E7.5396
+G1 X90.710 Y77.730 E7.5561
+G1 X90.607 Y78.220 E7.5726
+G1 X90.488 Y78.705 E7.5891
+G1 X90.355 Y79.187 E7.6056
+G1 X90.206 Y79.664 E7.6221
+G1 X90.042 Y80.137 E7.6386
+G1 X89.864 Y80.604 E7.6551
+G1 X89.671 Y81.065 E7.6716
+G1 X89.464 Y81.520 E7.6881
+G1 X89.242 Y81.968 E7.7046
+G1 X89.006 Y82.409 E7.7211
+G1 X88.757 Y82.842 E7.7375
+G1 X88.494 Y83.267 E7.7540
+G1 X88.218 Y83.684 E7.7705
+G1 X87.928 Y84.092 E7.7870
+G1 X87.626 Y84.490 E7.8035
+G1 X87.312 Y84.878 E7.8200
+G1 X86.985 Y85.257 E7.8365
+G1 X86.646 Y85.625 E7.8530
+G1 X86.296 Y85.982 E7.8695
+G1 X85.935 Y86.327 E7.8860
+G1 X85.563 Y86.661 E7.9025
+G1 X85.181 Y86.983 E7.9190
+G1 X84.788 Y87.293 E7.9355
+G1 X84.386 Y87.590 E7.9520
+G1 X83.975 Y87.874 E7.9685
+G1 X83.555 Y88.145 E7.9850
+G1 X83.126 Y88.402 E8.0015
+G1 X82.690 Y88.646 E8.0180
+G1 X82.245 Y88.875 E8.0345
+G1 X81.794 Y89.091 E8.0510
+G1 X81.336 Y89.291 E8.0675
+G1 X80.872 Y89.477 E8.0840
+G1 X80.402 Y89.648 E8.1005
+G1 X79.927 Y89.804 E8.1170
+G1 X79.448 Y89.944 E8.1335
+G1 X78.964 Y90.069 E8.1500
+G1 X78.476 Y90.179 E8.1665
+G1 X77.985 Y90.273 E8.1830
+G1 X77.491 Y90.350 E8.1995
+G1 X76.995 Y90.412 E8.2160
+G1 X76.497 Y90.458 E8.2325
+G1 X75.998 Y90.488 E8.2490
+M105
+G1 X75.498 Y90.502 E8.2655
+G1 X74.998 Y90.500 E8.2820
+G1 X74.499 Y90.482 E8.2985
+G1 X74.000 Y90.447 E8.3150
+G1 X73.503 Y90.397 E8.3315
+G1 X73.007 Y90.330 E8.3480
+G1 X72.514 Y90.247 E8.3644
+G1 X72.024 Y90.149 E8.3809
+G1 X71.537 Y90.034 E8.3974
+G1 X71.055 Y89.904 E8.4139
+G1 X70.577 Y89.759 E8.4304
+G1 X70.103 Y89.598 E8.4469
+G1 X69.636 Y89.421 E8.4634
+G1 X69.174 Y89.230 E8.4799
+G1 X68.718 Y89.023 E8.4964
+G1 X68.270 Y88.802 E8.5129
+G1 X67.829 Y88.567 E8.5294
+G1 X67.396 Y88.317 E8.5459
+G1 X66.971 Y88.053 E8.5624
+G1 X66.556 Y87.776 E8.5789
+G1 X66.149 Y87.485 E8.5954
+G1 X65.752 Y87.181 E8.6119
+G1 X65.366 Y86.864 E8.6284
+G1 X64.990 Y86.534 E8.6449
+G1 X64.624 Y86.193 E8.6614
+G1 X64.271 Y85.840 E8.6779
+G1 X63.929 Y85.475 E8.6944
+G1 X63.599 Y85.099 E8.7109
+G1 X63.282 Y84.713 E8.7274
+G1 X62.977 Y84.316 E8.7439
+G1 X62.686 Y83.910 E8.7604
+G1 X62.408 Y83.494 E8.7769
+G1 X62.144 Y83.070 E8.7934
+G1 X61.895 Y82.637 E8.8099
+G1 X61.659 Y82.196 E8.8264
+G1 X61.439 Y81.747 E8.8429
+G1 X61.233 Y81.291 E8.8594
+G1 X61.042 Y80.829 E8.8759
+G1 X60.867 Y80.361 E8.8924
+G1 X60.708 Y79.887 E8.9089
+G1 X60.564 Y79.408 E8.9254
+G1 X60.436 Y78.925 E8.9419
+G1 X60.324 Y78.438 E8.9583
+G1 X60.228 Y77.947 E8.9748
+G1 X60.149 Y77.454 E8.9913
+G1 X60.086 Y76.958 E9.0078
+G1 X60.040 Y76.460 E9.0243
+G1 X60.010 Y75.961 E9.0408
+G1 X59.997 Y75.461 E9.0573
+G1 X60.001 Y74.961 E9.0738
+G1 X60.021 Y74.462 E9.0903
+G1 X60.058 Y73.963 E9.1068
+G1 X60.111 Y73.466 E9.1233
+G1 X60.182 Y72.971 E9.1398
+G1 X60.268 Y72.479 E9.1563
+G1 X60.371 Y71.990 E9.1728
+G1 X60.490 Y71.504 E9.1893
+G1 X60.626 Y71.023 E9.2058
+G1 X60.778 Y70.547 E9.2223
+G1 X60.945 Y70.076 E9.2388
+G1 X61.128 Y69.610 E9.2553
+G1 X61.327 Y69.152 E9.2718
+G1 X61.541 Y68.700 E9.2883
+G1 X61.770 Y68.256 E9.3048
+G1 X62.014 Y67.819 E9.3213
+G1 X62.272 Y67.391 E9.3378
+G1 X62.545 Y66.972 E9.3543
+G1 X62.832 Y66.563 E9.3708
+G1 X63.132 Y66.163 E9.3873
+G1 X63.446 Y65.774 E9.4038
+G1 X63.773 Y65.396 E9.4203
+G1 X64.112 Y65.029 E9.4368
+G1 X64.464 Y64.673 E9.4533
+G1 X64.827 Y64.330 E9.4698
+G1 X65.202 Y63.999 E9.4863
+G1 X65.588 Y63.681 E9.5028
+G1 X65.984 Y63.377 E9.5192
+G1 X66.391 Y63.086 E9.5357
+G1 X66.807 Y62.809 E9.5522
+G1 X67.232 Y62.546 E9.5687
+G1 X67.666 Y62.298 E9.5852
+G1 X68.109 Y62.065 E9.6017
+G1 X68.559 Y61.848 E9.6182
+G1 X69.016 Y61.645 E9.6347
+G1 X69.480 Y61.459 E9.6512
+G1 X69.950 Y61.288 E9.6677
+G1 X70.425 Y61.134 E9.6842
+G1 X70.905 Y60.996 E9.7007
+G1 X71.390 Y60.874 E9.7172
+G1 X71.879 Y60.769 E9.7337
+G1 X72.371 Y60.682 E9.7502
+G1 X72.866 Y60.611 E9.7667
+G1 X73.363 Y60.557 E9.7832
+G1 X73.862 Y60.520 E9.7997
+G1 X74.361 Y60.500 E9.8162
+G1 X74.861 Y60.498 E9.8327
+G1 X75.361 Y60.512 E9.8492
+G1 X75.860 Y60.544 E9.8657
+G1 X76.357 Y60.594 E9.8822
+G1 X76.853 Y60.660 E9.8987
+M105
+G1 X77.345 Y60.744 E9.9152
+G1 X77.835 Y60.844 E9.9317
+G1 X78.321 Y60.961 E9.9482
+G1 X78.803 Y61.096 E9.9647
+G1 X79.279 Y61.246 E9.9812
+G1 X79.750 Y61.414 E9.9977
+G1 X80.215 Y61.597 E10.0142
+G1 X80.674 Y61.797 E10.0307
+G1 X81.125 Y62.012 E10.0471
+G1 X81.568 Y62.243 E10.0636
+G1 X82.003 Y62.489 E10.0801
+G1 X82.429 Y62.750 E10.0966
+G1 X82.846 Y63.026 E10.1131
+G1 X83.253 Y63.317 E10.1296
+G1 X83.650 Y63.621 E10.1461
+G1 X84.035 Y63.939 E10.1626
+G1 X84.410 Y64.271 E10.1791
+G1 X84.772 Y64.615 E10.1956
+G1 X85.122 Y64.972 E10.2121
+G1 X85.460 Y65.341 E10.2286
+G1 X85.784 Y65.721 E10.2451
+G1 X86.094 Y66.113 E10.2616
+G1 X86.391 Y66.515 E10.2781
+G1 X86.673 Y66.928 E10.2946
+G1 X86.941 Y67.350 E10.3111
+G1 X87.194 Y67.781 E10.3276
+G1 X87.431 Y68.222 E10.3441
+G1 X87.652 Y68.670 E10.3606
+G1 X87.858 Y69.125 E10.3771
+G1 X88.047 Y69.588 E10.3936
+G1 X88.220 Y70.057 E10.4101
+G1 X88.376 Y70.532 E10.4266
+G1 X88.515 Y71.012 E10.4431
+G1 X88.637 Y71.497 E10.4596
+G1 X88.742 Y71.986 E10.4761
+G1 X88.829 Y72.478 E10.4926
+G1 X88.899 Y72.973 E10.5091
+G1 X88.951 Y73.470 E10.5256
+G1 X88.985 Y73.969 E10.5421
+G1 X89.002 Y74.469 E10.5585
+G1 X89.001 Y74.968 E10.5750
+G1 X88.982 Y75.468 E10.5915
+G1 X88.945 Y75.966 E10.6080
+G1 X88.890 Y76.463 E10.6245
+G1 X88.817 Y76.958 E10.6410
+G1 X88.727 Y77.450 E10.6575
+G1 X88.619 Y77.938 E10.6740
+G1 X88.494 Y78.422 E10.6905
+G1 X88.351 Y78.901 E10.7070
+G1 X88.192 Y79.375 E10.7235
+G1 X88.015 Y79.842 E10.7400
+G1 X87.822 Y80.303 E10.7565
+G1 X87.612 Y80.757 E10.7730
+G1 X87.386 Y81.203 E10.7895
+G1 X87.144 Y81.640 E10.8060
+G1 X86.886 Y82.069 E10.8225
+G1 X86.613 Y82.487 E10.8390
+G1 X86.325 Y82.896 E10.8555
+G1 X86.023 Y83.294 E10.8720
+G1 X85.706 Y83.681 E10.8885
+G1 X85.375 Y84.056 E10.9050
+G1 X85.031 Y84.419 E10.9215
+G1 X84.675 Y84.769 E10.9380
+G1 X84.305 Y85.105 E10.9545
+G1 X83.924 Y85.428 E10.9710
+G1 X83.531 Y85.737 E10.9875
+G1 X83.127 Y86.032 E11.0040
+G1 X82.712 Y86.311 E11.0205
+G1 X82.288 Y86.576 E11.0370
+G1 X81.854 Y86.824 E11.0534
+G1 X81.412 Y87.057 E11.0699
+G1 X80.961 Y87.273 E11.0864
+G1 X80.503 Y87.472 E11.1029
+G1 X80.037 Y87.655 E11.1194
+G1 X79.565 Y87.820 E11.1359
+G1 X79.088 Y87.968 E11.1524
+G1 X78.605 Y88.098 E11.1689
+G1 X78.118 Y88.211 E11.1854
+G1 X77.627 Y88.305 E11.2019
+G1 X77.133 Y88.381 E11.2184
+G1 X76.637 Y88.439 E11.2349
+G1 X76.138 Y88.479 E11.2514
+G1 X75.639 Y88.500 E11.2679
+G1 X75.139 Y88.503 E11.2844
+G1 X74.639 Y88.487 E11.3009
+G1 X74.141 Y88.452 E11.3174
+G1 X73.644 Y88.399 E11.3339
+G1 X73.149 Y88.328 E11.3504
+G1 X72.657 Y88.239 E11.3669
+G1 X72.169 Y88.131 E11.3834
+G1 X71.685 Y88.005 E11.3999
+G1 X71.206 Y87.861 E11.4164
+G1 X70.733 Y87.699 E11.4329
+G1 X70.267 Y87.520 E11.4494
+G1 X69.807 Y87.324 E11.4659
+G1 X69.355 Y87.110 E11.4824
+G1 X68.911 Y86.880 E11.4989
+G1 X68.477 Y86.633 E11.5153
+G1 X68.051 Y86.370 E11.5318
+G1 X67.636 Y86.092 E11.5483
+M105
+G1 X67.232 Y85.798 E11.5648
+G1 X66.839 Y85.489 E11.5813
+G1 X66.458 Y85.165 E11.5978
+G1 X66.089 Y84.827 E11.6143
+G1 X65.734 Y84.476 E11.6308
+G1 X65.392 Y84.112 E11.6473
+G1 X65.064 Y83.734 E11.6638
+G1 X64.750 Y83.345 E11.6803
+G1 X64.451 Y82.944 E11.6968
+G1 X64.168 Y82.532 E11.7133
+G1 X63.901 Y82.110 E11.7298
+G1 X63.649 Y81.678 E11.7463
+G1 X63.415 Y81.237 E11.7628
+G1 X63.197 Y80.787 E11.7793
+G1 X62.997 Y80.329 E11.7958
+G1 X62.814 Y79.863 E11.8123
+G1 X62.649 Y79.392 E11.8288
+G1 X62.502 Y78.914 E11.8453
+G1 X62.373 Y78.431 E11.8618
+G1 X62.263 Y77.943 E11.8783
+G1 X62.172 Y77.452 E11.8948
+G1 X62.100 Y76.957 E11.9113
+G1 X62.046 Y76.460 E11.9278
+G1 X62.012 Y75.961 E11.9443
+G1 X61.997 Y75.461 E11.9607
+G1 X62.001 Y74.962 E11.9772
+G1 X62.024 Y74.462 E11.9937
+G1 X62.067 Y73.964 E12.0102
+G1 X62.129 Y73.468 E12.0267
+G1 X62.209 Y72.975 E12.0432
+G1 X62.309 Y72.485 E12.0597
+G1 X62.428 Y71.999 E12.0762
+G1 X62.565 Y71.519 E12.0927
+G1 X62.721 Y71.044 E12.1092
+G1 X62.895 Y70.575 E12.1257
+G1 X63.087 Y70.114 E12.1422
+G1 X63.297 Y69.660 E12.1587
+G1 X63.524 Y69.215 E12.1752
+G1 X63.769 Y68.779 E12.1917
+G1 X64.030 Y68.353 E12.2082
+G1 X64.308 Y67.937 E12.2247
+G1 X64.602 Y67.533 E12.2412
+G1 X64.911 Y67.140 E12.2577
+G1 X65.235 Y66.760 E12.2742
+G1 X65.575 Y66.392 E12.2907
+G1 X65.928 Y66.039 E12.3072
+G1 X66.294 Y65.699 E12.3237
+G1 X66.674 Y65.374 E12.3402
+G1 X67.067 Y65.064 E12.3567
+G1 X67.471 Y64.770 E12.3731
+G1 X67.886 Y64.492 E12.3896
+G1 X68.312 Y64.231 E12.4061
+G1 X68.748 Y63.986 E12.4226
+G1 X69.194 Y63.759 E12.4391
+G1 X69.648 Y63.550 E12.4556
+G1 X70.110 Y63.359 E12.4721
+G1 X70.579 Y63.186 E12.4886
+G1 X71.054 Y63.032 E12.5051
+G1 X71.536 Y62.897 E12.5216
+G1 X72.022 Y62.782 E12.5381
+G1 X72.512 Y62.685 E12.5546
+G1 X73.006 Y62.609 E12.5711
+G1 X73.503 Y62.552 E12.5876
+G1 X74.001 Y62.514 E12.6041
+G1 X74.501 Y62.497 E12.6206
+G1 X75.001 Y62.500 E12.6371
+G1 X75.500 Y62.523 E12.6536
+G1 X75.998 Y62.566 E12.6701
+G1 X76.494 Y62.628 E12.6866
+G1 X76.987 Y62.711 E12.7031
+G1 X77.477 Y62.813 E12.7196
+G1 X77.961 Y62.935 E12.7361
+G1 X78.441 Y63.076 E12.7526
+G1 X78.914 Y63.236 E12.7691
+G1 X79.381 Y63.416 E12.7855
+G1 X79.840 Y63.614 E12.8020
+G1 X80.290 Y63.830 E12.8185
+G1 X80.732 Y64.065 E12.8350
+G1 X81.163 Y64.317 E12.8515
+G1 X81.584 Y64.587 E12.8680
+G1 X81.994 Y64.873 E12.8845
+G1 X82.392 Y65.176 E12.9010
+G1 X82.777 Y65.494 E12.9175
+G1 X83.149 Y65.828 E12.9340
+G1 X83.507 Y66.177 E12.9505
+G1 X83.850 Y66.541 E12.9670
+G1 X84.178 Y66.918 E12.9835
+G1 X84.491 Y67.308 E13.0000
+G1 X84.787 Y67.710 E13.0165
+G1 X85.067 Y68.125 E13.0330
+G1 X85.329 Y68.550 E13.0495
+G1 X85.574 Y68.986 E13.0660
+G1 X85.801 Y69.432 E13.0825
+G1 X86.009 Y69.886 E13.0990
+G1 X86.198 Y70.349 E13.1155
+G1 X86.368 Y70.819 E13.1320
+G1 X86.518 Y71.296 E13.1485
+G1 X86.649 Y71.778 E13.1649
+G1 X86.759 Y72.266 E13.1814
+G1 X86.849 Y72.757 E13.1979
+M105
+G1 X86.919 Y73.252 E13.2144
+G1 X86.968 Y73.750 E13.2309
+G1 X86.996 Y74.249 E13.2474
+G1 X87.004 Y74.749 E13.2639
+G1 X86.991 Y75.248 E13.2804
+G1 X86.957 Y75.747 E13.2969
+G1 X86.902 Y76.244 E13.3134
+G1 X86.827 Y76.738 E13.3299
+G1 X86.730 Y77.228 E13.3464
+G1 X86.614 Y77.715 E13.3629
+G1 X86.477 Y78.195 E13.3794
+G1 X86.320 Y78.670 E13.3959
+G1 X86.144 Y79.138 E13.4124
+G1 X85.947 Y79.597 E13.4289
+G1 X85.732 Y80.048 E13.4454
+G1 X85.498 Y80.490 E13.4619
+G1 X85.245 Y80.921 E13.4784
+G1 X84.975 Y81.342 E13.4949
+G1 X84.686 Y81.750 E13.5114
+G1 X84.381 Y82.146 E13.5278
+G1 X84.059 Y82.528 E13.5443
+G1 X83.722 Y82.897 E13.5608
+G1 X83.369 Y83.251 E13.5773
+G1 X83.001 Y83.590 E13.5938
+G1 X82.619 Y83.912 E13.6103
+G1 X82.224 Y84.218 E13.6268
+G1 X81.816 Y84.507 E13.6433
+G1 X81.396 Y84.778 E13.6598
+G1 X80.965 Y85.031 E13.6763
+G1 X80.524 Y85.265 E13.6928
+G1 X80.072 Y85.481 E13.7093
+G1 X79.612 Y85.676 E13.7258
+G1 X79.144 Y85.852 E13.7423
+G1 X78.669 Y86.007 E13.7588
+G1 X78.188 Y86.142 E13.7753
+G1 X77.701 Y86.255 E13.7918
+G1 X77.210 Y86.348 E13.8083
+G1 X76.715 Y86.419 E13.8248
+G1 X76.218 Y86.469 E13.8413
+G1 X75.719 Y86.497 E13.8578
+G1 X75.219 Y86.504 E13.8742
+G1 X74.719 Y86.489 E13.8907
+G1 X74.221 Y86.452 E13.9072
+G1 X73.724 Y86.393 E13.9237
+G1 X73.231 Y86.313 E13.9402
+G1 X72.742 Y86.212 E13.9567
+G1 X72.257 Y86.089 E13.9732
+G1 X71.778 Y85.945 E13.9897
+G1 X71.307 Y85.780 E14.0062
+G1 X70.842 Y85.594 E14.0227
+G1 X70.387 Y85.389 E14.0392
+G1 X69.941 Y85.163 E14.0557
+G1 X69.505 Y84.918 E14.0722
+G1 X69.080 Y84.655 E14.0887
+G1 X68.668 Y84.372 E14.1052
+G1 X68.268 Y84.072 E14.1217
+G1 X67.882 Y83.754 E14.1382
+G1 X67.511 Y83.420 E14.1547
+G1 X67.155 Y83.069 E14.1712
+G1 X66.814 Y82.703 E14.1877
+G1 X66.491 Y82.322 E14.2041
+G1 X66.184 Y81.927 E14.2206
+G1 X65.896 Y81.519 E14.2371
+G1 X65.626 Y81.099 E14.2536
+G1 X65.375 Y80.666 E14.2701
+G1 X65.143 Y80.223 E14.2866
+G1 X64.932 Y79.770 E14.3031
+G1 X64.741 Y79.308 E14.3196
+G1 X64.572 Y78.838 E14.3361
+G1 X64.423 Y78.361 E14.3526
+G1 X64.296 Y77.877 E14.3691
+G1 X64.192 Y77.389 E14.3856
+G1 X64.109 Y76.896 E14.4021
+G1 X64.049 Y76.399 E14.4186
+G1 X64.011 Y75.901 E14.4351
+G1 X63.996 Y75.401 E14.4516
+G1 X64.003 Y74.902 E14.4681
+G1 X64.034 Y74.403 E14.4846
+G1 X64.087 Y73.906 E14.5011
+G1 X64.162 Y73.412 E14.5175
+G1 X64.260 Y72.921 E14.5340
+G1 X64.380 Y72.436 E14.5505
+G1 X64.523 Y71.957 E14.5670
+G1 X64.687 Y71.485 E14.5835
+G1 X64.873 Y71.021 E14.6000
+G1 X65.080 Y70.566 E14.6165
+G1 X65.307 Y70.121 E14.6330
+G1 X65.555 Y69.687 E14.6495
+G1 X65.822 Y69.265 E14.6660
+G1 X66.109 Y68.855 E14.6825
+G1 X66.415 Y68.460 E14.6990
+G1 X66.738 Y68.079 E14.7155
+G1 X67.079 Y67.713 E14.7320
+G1 X67.436 Y67.363 E14.7485
+G1 X67.809 Y67.031 E14.7650
+G1 X68.198 Y66.716 E14.7815
+G1 X68.600 Y66.420 E14.7980
+G1 X69.016 Y66.143 E14.8144
+G1 X69.445 Y65.885 E14.8309
+G1 X69.885 Y65.648 E14.8474
+M105
+G1 X70.335 Y65.432 E14.8639
+G1 X70.796 Y65.237 E14.8804
+G1 X71.265 Y65.065 E14.8969
+G1 X71.741 Y64.914 E14.9134
+G1 X72.224 Y64.786 E14.9299
+G1 X72.713 Y64.681 E14.9464
+G1 X73.206 Y64.599 E14.9629
+G1 X73.703 Y64.541 E14.9794
+G1 X74.201 Y64.506 E14.9959
+G1 X74.701 Y64.495 E15.0124
+G1 X75.201 Y64.508 E15.0289
+G1 X75.699 Y64.545 E15.0454
+G1 X76.195 Y64.605 E15.0619
+G1 X76.688 Y64.689 E15.0784
+G1 X77.176 Y64.796 E15.0948
+G1 X77.658 Y64.927 E15.1113
+G1 X78.134 Y65.081 E15.1278
+G1 X78.602 Y65.257 E15.1443
+G1 X79.060 Y65.456 E15.1608
+G1 X79.509 Y65.676 E15.1773
+G1 X79.946 Y65.918 E15.1938
+G1 X80.371 Y66.181 E15.2103
+G1 X80.783 Y66.464 E15.2268
+G1 X81.181 Y66.767 E15.2433
+G1 X81.564 Y67.089 E15.2598
+G1 X81.930 Y67.429 E15.2763
+G1 X82.279 Y67.786 E15.2928
+G1 X82.611 Y68.160 E15.3093
+G1 X82.924 Y68.550 E15.3258
+G1 X83.217 Y68.954 E15.3423
+G1 X83.491 Y69.373 E15.3588
+G1 X83.743 Y69.804 E15.3752
+G1 X83.974 Y70.247 E15.3917
+G1 X84.183 Y70.701 E15.4082
+G1 X84.369 Y71.165 E15.4247
+G1 X84.532 Y71.638 E15.4412
+G1 X84.672 Y72.118 E15.4577
+G1 X84.787 Y72.604 E15.4742
+G1 X84.879 Y73.095 E15.4907
+G1 X84.945 Y73.591 E15.5072
+G1 X84.987 Y74.089 E15.5237
+G1 X85.005 Y74.588 E15.5402
+G1 X84.997 Y75.088 E15.5567
+G1 X84.964 Y75.587 E15.5732
+G1 X84.906 Y76.083 E15.5897
+G1 X84.824 Y76.576 E15.6062
+G1 X84.717 Y77.064 E15.6226
+G1 X84.585 Y77.546 E15.6391
+G1 X84.429 Y78.021 E15.6556
+G1 X84.250 Y78.488 E15.6721
+G1 X84.047 Y78.944 E15.6886
+G1 X83.821 Y79.390 E15.7051
+G1 X83.573 Y79.824 E15.7216
+G1 X83.303 Y80.245 E15.7381
+G1 X83.012 Y80.651 E15.7546
+G1 X82.701 Y81.042 E15.7711
+G1 X82.370 Y81.417 E15.7876
+G1 X82.020 Y81.774 E15.8041
+G1 X81.653 Y82.113 E15.8206
+G1 X81.269 Y82.432 E15.8371
+G1 X80.868 Y82.732 E15.8536
+G1 X80.453 Y83.010 E15.8700
+G1 X80.024 Y83.267 E15.8865
+G1 X79.583 Y83.501 E15.9030
+G1 X79.130 Y83.712 E15.9195
+G1 X78.666 Y83.899 E15.9360
+G1 X78.194 Y84.062 E15.9525
+G1 X77.713 Y84.199 E15.9690
+G1 X77.226 Y84.312 E15.9855
+G1 X76.734 Y84.399 E16.0020
+G1 X76.238 Y84.461 E16.0185
+G1 X75.740 Y84.496 E16.0350
+G1 X75.240 Y84.505 E16.0515
+G1 X74.741 Y84.488 E16.0680
+G1 X74.243 Y84.444 E16.0845
+G1 X73.748 Y84.374 E16.1009
+G1 X73.257 Y84.279 E16.1174
+G1 X72.773 Y84.157 E16.1339
+G1 X72.295 Y84.010 E16.1504
+G1 X71.826 Y83.837 E16.1669
+G1 X71.367 Y83.640 E16.1834
+G1 X70.918 Y83.419 E16.1999
+G1 X70.483 Y83.174 E16.2164
+G1 X70.061 Y82.906 E16.2329
+G1 X69.654 Y82.616 E16.2494
+G1 X69.263 Y82.305 E16.2659
+G1 X68.890 Y81.972 E16.2824
+G1 X68.535 Y81.621 E16.2989
+G1 X68.199 Y81.250 E16.3154
+G1 X67.884 Y80.862 E16.3318
+G1 X67.591 Y80.458 E16.3483
+G1 X67.320 Y80.038 E16.3648
+G1 X67.072 Y79.604 E16.3813
+G1 X66.849 Y79.157 E16.3978
+G1 X66.650 Y78.698 E16.4143
+G1 X66.476 Y78.230 E16.4308
+G1 X66.328 Y77.752 E16.4473
+G1 X66.207 Y77.267 E16.4638
+G1 X66.113 Y76.776 E16.4803
+G1 X66.046 Y76.281 E16.4968
+M105
+G1 X66.006 Y75.783 E16.5133
+G1 X65.994 Y75.283 E16.5298
+G1 X66.010 Y74.784 E16.5462
+G1 X66.054 Y74.286 E16.5627
+G1 X66.125 Y73.791 E16.5792
+G1 X66.224 Y73.301 E16.5957
+G1 X66.350 Y72.818 E16.6122
+G1 X66.502 Y72.342 E16.6287
+G1 X66.682 Y71.876 E16.6452
+G1 X66.887 Y71.420 E16.6617
+G1 X67.118 Y70.977 E16.6782
+G1 X67.373 Y70.547 E16.6947
+G1 X67.652 Y70.132 E16.7112
+G1 X67.955 Y69.735 E16.7277
+G1 X68.279 Y69.354 E16.7441
+G1 X68.624 Y68.993 E16.7606
+G1 X68.990 Y68.653 E16.7771
+G1 X69.374 Y68.333 E16.7936
+G1 X69.777 Y68.037 E16.8101
+G1 X70.195 Y67.763 E16.8266
+G1 X70.629 Y67.515 E16.8431
+G1 X71.076 Y67.292 E16.8596
+G1 X71.535 Y67.095 E16.8761
+G1 X72.005 Y66.925 E16.8926
+G1 X72.484 Y66.782 E16.9091
+G1 X72.970 Y66.668 E16.9255
+G1 X73.463 Y66.582 E16.9420
+G1 X73.959 Y66.525 E16.9585
+G1 X74.458 Y66.497 E16.9750
+G1 X74.958 Y66.499 E16.9915
+G1 X75.457 Y66.529 E17.0080
+G1 X75.953 Y66.590 E17.0245
+G1 X76.444 Y66.679 E17.0410
+G1 X76.930 Y66.797 E17.0575
+G1 X77.407 Y66.944 E17.0740
+G1 X77.875 Y67.120 E17.0905
+G1 X78.332 Y67.322 E17.1070
+G1 X78.776 Y67.552 E17.1234
+G1 X79.205 Y67.808 E17.1399
+G1 X79.619 Y68.089 E17.1564
+G1 X80.014 Y68.394 E17.1729
+G1 X80.390 Y68.723 E17.1894
+G1 X80.746 Y69.074 E17.2059
+G1 X81.080 Y69.445 E17.2224
+G1 X81.391 Y69.837 E17.2389
+G1 X81.678 Y70.246 E17.2554
+G1 X81.938 Y70.672 E17.2719
+G1 X82.173 Y71.114 E17.2883
+G1 X82.380 Y71.568 E17.3048
+G1 X82.558 Y72.035 E17.3213
+G1 X82.708 Y72.512 E17.3378
+G1 X82.828 Y72.997 E17.3543
+G1 X82.917 Y73.489 E17.3708
+G1 X82.976 Y73.985 E17.3873
+G1 X83.004 Y74.484 E17.4038
+G1 X83.001 Y74.984 E17.4203
+G1 X82.966 Y75.482 E17.4368
+G1 X82.901 Y75.977 E17.4532
+G1 X82.804 Y76.468 E17.4697
+G1 X82.677 Y76.951 E17.4862
+G1 X82.519 Y77.425 E17.5027
+G1 X82.332 Y77.888 E17.5192
+G1 X82.116 Y78.339 E17.5357
+G1 X81.872 Y78.775 E17.5522
+G1 X81.600 Y79.194 E17.5687
+G1 X81.302 Y79.595 E17.5852
+G1 X80.979 Y79.976 E17.6017
+G1 X80.632 Y80.336 E17.6181
+G1 X80.263 Y80.673 E17.6346
+G1 X79.873 Y80.985 E17.6511
+G1 X79.463 Y81.271 E17.6676
+G1 X79.036 Y81.530 E17.6841
+G1 X78.592 Y81.760 E17.7006
+G1 X78.135 Y81.961 E17.7171
+G1 X77.665 Y82.132 E17.7336
+G1 X77.185 Y82.272 E17.7501
+G1 X76.697 Y82.379 E17.7665
+G1 X76.204 Y82.454 E17.7830
+G1 X75.706 Y82.497 E17.7995
+G1 X75.206 Y82.506 E17.8160
+G1 X74.707 Y82.482 E17.8325
+G1 X74.211 Y82.424 E17.8490
+G1 X73.719 Y82.334 E17.8655
+G1 X73.235 Y82.211 E17.8820
+G1 X72.760 Y82.055 E17.8985
+G1 X72.297 Y81.868 E17.9149
+G1 X71.848 Y81.650 E17.9314
+G1 X71.414 Y81.401 E17.9479
+G1 X70.998 Y81.124 E17.9644
+G1 X70.602 Y80.819 E17.9809
+G1 X70.229 Y80.488 E17.9974
+G1 X69.878 Y80.132 E18.0139
+G1 X69.553 Y79.752 E18.0304
+G1 X69.255 Y79.351 E18.0468
+G1 X68.986 Y78.930 E18.0633
+G1 X68.747 Y78.492 E18.0798
+G1 X68.538 Y78.038 E18.0963
+G1 X68.363 Y77.570 E18.1128
+G1 X68.220 Y77.091 E18.1293
+G1 X68.111 Y76.603 E18.1458
+M105
+G1 X68.038 Y76.109 E18.1623
+G1 X67.999 Y75.611 E18.1787
+G1 X67.996 Y75.112 E18.1952
+G1 X68.028 Y74.613 E18.2117
+G1 X68.097 Y74.118 E18.2282
+G1 X68.200 Y73.629 E18.2447
+G1 X68.339 Y73.149 E18.2612
+G1 X68.511 Y72.681 E18.2777
+G1 X68.718 Y72.226 E18.2941
+G1 X68.957 Y71.787 E18.3106
+G1 X69.227 Y71.367 E18.3271
+G1 X69.527 Y70.968 E18.3436
+G1 X69.856 Y70.592 E18.3601
+G1 X70.212 Y70.241 E18.3766
+G1 X70.593 Y69.917 E18.3931
+G1 X70.996 Y69.623 E18.4095
+G1 X71.421 Y69.360 E18.4260
+G1 X71.864 Y69.129 E18.4425
+G1 X72.323 Y68.932 E18.4590
+G1 X72.796 Y68.770 E18.4755
+G1 X73.279 Y68.645 E18.4920
+G1 X73.771 Y68.556 E18.5085
+G1 X74.268 Y68.505 E18.5249
+G1 X74.767 Y68.493 E18.5414
+G1 X75.266 Y68.519 E18.5579
+G1 X75.761 Y68.583 E18.5744
+G1 X76.250 Y68.685 E18.5909
+G1 X76.730 Y68.825 E18.6074
+G1 X77.197 Y69.001 E18.6239
+G1 X77.649 Y69.214 E18.6403
+G1 X78.083 Y69.462 E18.6568
+G1 X78.496 Y69.743 E18.6733
+G1 X78.885 Y70.056 E18.6898
+G1 X79.248 Y70.399 E18.7063
+G1 X79.583 Y70.769 E18.7228
+G1 X79.887 Y71.166 E18.7392
+G1 X80.158 Y71.585 E18.7557
+G1 X80.395 Y72.025 E18.7722
+G1 X80.594 Y72.483 E18.7887
+G1 X80.756 Y72.956 E18.8052
+G1 X80.879 Y73.440 E18.8217
+G1 X80.962 Y73.932 E18.8381
+G1 X81.003 Y74.430 E18.8546
+G1 X81.003 Y74.930 E18.8711
+G1 X80.962 Y75.427 E18.8876
+G1 X80.879 Y75.920 E18.9041
+G1 X80.755 Y76.404 E18.9205
+G1 X80.591 Y76.875 E18.9370
+G1 X80.387 Y77.331 E18.9535
+G1 X80.145 Y77.768 E18.9700
+G1 X79.867 Y78.183 E18.9865
+G1 X79.554 Y78.572 E19.0029
+G1 X79.209 Y78.933 E19.0194
+G1 X78.834 Y79.263 E19.0359
+G1 X78.431 Y79.558 E19.0524
+G1 X78.004 Y79.817 E19.0689
+G1 X77.556 Y80.038 E19.0854
+G1 X77.091 Y80.218 E19.1018
+G1 X76.611 Y80.356 E19.1183
+G1 X76.120 Y80.451 E19.1348
+G1 X75.623 Y80.501 E19.1513
+G1 X75.124 Y80.506 E19.1677
+G1 X74.626 Y80.466 E19.1842
+G1 X74.134 Y80.380 E19.2007
+G1 X73.652 Y80.250 E19.2172
+G1 X73.184 Y80.076 E19.2337
+G1 X72.735 Y79.859 E19.2501
+G1 X72.307 Y79.601 E19.2666
+G1 X71.905 Y79.305 E19.2831
+G1 X71.533 Y78.971 E19.2996
+G1 X71.195 Y78.604 E19.3160
+G1 X70.893 Y78.207 E19.3325
+G1 X70.630 Y77.782 E19.3490
+G1 X70.410 Y77.334 E19.3655
+G1 X70.234 Y76.867 E19.3820
+G1 X70.104 Y76.385 E19.3984
+G1 X70.023 Y75.892 E19.4149
+G1 X69.990 Y75.394 E19.4314
+G1 X70.008 Y74.895 E19.4478
+G1 Z10 F600
+M400
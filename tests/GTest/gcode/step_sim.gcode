@@ -0,0 +1,94 @@
+; Motion benchmark for step_sim: travel, extrusion, short arc segments and Z hops
+G21
+G90
+M82
+G92 X0 Y0 Z0 E0
+G1 Z0.3 F600
+G0 X10 Y10 F9000
+G1 X90 Y10 E2 F2400
+G1 X90 Y90 E4
+G1 X10 Y90 E6
+G1 X10 Y10 E8
+; Circle of 72 one-degree-ish segments at print speed
+G1 X69.924 Y51.743 E8.0600 F1800
+G1 X69.696 Y53.473 E8.1200 F1800
+G1 X69.319 Y55.176 E8.1800 F1800
+G1 X68.794 Y56.840 E8.2400 F1800
+G1 X68.126 Y58.452 E8.3000 F1800
+G1 X67.321 Y60.000 E8.3600 F1800
+G1 X66.383 Y61.472 E8.4200 F1800
+G1 X65.321 Y62.856 E8.4800 F1800
+G1 X64.142 Y64.142 E8.5400 F1800
+G1 X62.856 Y65.321 E8.6000 F1800
+G1 X61.472 Y66.383 E8.6600 F1800
+G1 X60.000 Y67.321 E8.7200 F1800
+G1 X58.452 Y68.126 E8.7800 F1800
+G1 X56.840 Y68.794 E8.8400 F1800
+G1 X55.176 Y69.319 E8.9000 F1800
+G1 X53.473 Y69.696 E8.9600 F1800
+G1 X51.743 Y69.924 E9.0200 F1800
+G1 X50.000 Y70.000 E9.0800 F1800
+G1 X48.257 Y69.924 E9.1400 F1800
+G1 X46.527 Y69.696 E9.2000 F1800
+G1 X44.824 Y69.319 E9.2600 F1800
+G1 X43.160 Y68.794 E9.3200 F1800
+G1 X41.548 Y68.126 E9.3800 F1800
+G1 X40.000 Y67.321 E9.4400 F1800
+G1 X38.528 Y66.383 E9.5000 F1800
+G1 X37.144 Y65.321 E9.5600 F1800
+G1 X35.858 Y64.142 E9.6200 F1800
+G1 X34.679 Y62.856 E9.6800 F1800
+G1 X33.617 Y61.472 E9.7400 F1800
+G1 X32.679 Y60.000 E9.8000 F1800
+G1 X31.874 Y58.452 E9.8600 F1800
+G1 X31.206 Y56.840 E9.9200 F1800
+G1 X30.681 Y55.176 E9.9800 F1800
+G1 X30.304 Y53.473 E10.0400 F1800
+G1 X30.076 Y51.743 E10.1000 F1800
+G1 X30.000 Y50.000 E10.1600 F1800
+G1 X30.076 Y48.257 E10.2200 F1800
+G1 X30.304 Y46.527 E10.2800 F1800
+G1 X30.681 Y44.824 E10.3400 F1800
+G1 X31.206 Y43.160 E10.4000 F1800
+G1 X31.874 Y41.548 E10.4600 F1800
+G1 X32.679 Y40.000 E10.5200 F1800
+G1 X33.617 Y38.528 E10.5800 F1800
+G1 X34.679 Y37.144 E10.6400 F1800
+G1 X35.858 Y35.858 E10.7000 F1800
+G1 X37.144 Y34.679 E10.7600 F1800
+G1 X38.528 Y33.617 E10.8200 F1800
+G1 X40.000 Y32.679 E10.8800 F1800
+G1 X41.548 Y31.874 E10.9400 F1800
+G1 X43.160 Y31.206 E11.0000 F1800
+G1 X44.824 Y30.681 E11.0600 F1800
+G1 X46.527 Y30.304 E11.1200 F1800
+G1 X48.257 Y30.076 E11.1800 F1800
+G1 X50.000 Y30.000 E11.2400 F1800
+G1 X51.743 Y30.076 E11.3000 F1800
+G1 X53.473 Y30.304 E11.3600 F1800
+G1 X55.176 Y30.681 E11.4200 F1800
+G1 X56.840 Y31.206 E11.4800 F1800
+G1 X58.452 Y31.874 E11.5400 F1800
+G1 X60.000 Y32.679 E11.6000 F1800
+G1 X61.472 Y33.617 E11.6600 F1800
+G1 X62.856 Y34.679 E11.7200 F1800
+G1 X64.142 Y35.858 E11.7800 F1800
+G1 X65.321 Y37.144 E11.8400 F1800
+G1 X66.383 Y38.528 E11.9000 F1800
+G1 X67.321 Y40.000 E11.9600 F1800
+G1 X68.126 Y41.548 E12.0200 F1800
+G1 X68.794 Y43.160 E12.0800 F1800
+G1 X69.319 Y44.824 E12.1400 F1800
+G1 X69.696 Y46.527 E12.2000 F1800
+G1 X69.924 Y48.257 E12.2600 F1800
+G1 X70.000 Y50.000 E12.3200 F1800
+G1 Z1.3 F600
+G0 X120 Y120 F12000
+G0 X0 Y0
+G1 E6 F2400
+G1 E8
+G1 Z10 F600
+G28
+; Slow moves, down to the slowest rate Timer1 can time
+G1 X2 F12
+G1 Y1 F6
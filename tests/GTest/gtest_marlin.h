@@ -0,0 +1,14 @@
+/**
+ * gtest_marlin.h - GoogleTest for the firmware tests. Include it ahead of
+ * the firmware headers: Marlin's macros.h has its own TEST(n, b) bit test,
+ * so gtest's TEST is dropped here and the tests are written with TEST_F.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef GTEST_MARLIN_H
+#define GTEST_MARLIN_H
+
+#include "gtest/gtest.h"
+#undef TEST
+
+#endif // GTEST_MARLIN_H
@@ -0,0 +1,79 @@
+#include <math.h>
+#include <stdlib.h>
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/HeaterModel.h"
+
+// A first order plus dead time step from 25C, with optional sensor noise
+static uint8_t step(float *samples, float gain, float tau, float dead_time, float power,
+                    float interval, float until, float noise)
+{
+	srand(1);
+	uint8_t count = 0;
+	while (count < HEATER_MODEL_MAX_SAMPLES) {
+		float t = count * interval - dead_time,
+		      y = t > 0 ? gain * power * (1 - exp(-t / tau)) : 0;
+		samples[count++] = 25 + y + noise * (rand() / (float)RAND_MAX - 0.5);
+		if (samples[count - 1] >= until) break;
+	}
+	return count;
+}
+
+class heater_model_test : public ::testing::Test {};
+
+TEST_F(heater_model_test, recovers_a_hot_end)
+{
+	float samples[HEATER_MODEL_MAX_SAMPLES];
+	uint8_t count = step(samples, 1.4, 90, 2.5, 255, 0.75, 210, 0);
+	HeaterModel model;
+	ASSERT_TRUE(HeaterModel__Fit(samples, count, 0.75, 255, &model));
+	EXPECT_NEAR(model.gain, 1.4, 0.01);
+	EXPECT_NEAR(model.tau, 90, 1);
+	EXPECT_NEAR(model.dead_time, 2.5, 0.1);
+	EXPECT_LT(model.rms, 0.05);
+}
+
+TEST_F(heater_model_test, recovers_a_noisy_bed)
+{
+	float samples[HEATER_MODEL_MAX_SAMPLES];
+	uint8_t count = step(samples, 0.45, 250, 8, 255, 4, 90, 0.5);
+	HeaterModel model;
+	ASSERT_TRUE(HeaterModel__Fit(samples, count, 4, 255, &model));
+	EXPECT_NEAR(model.gain, 0.45, 0.45 * 0.1);
+	EXPECT_NEAR(model.tau, 250, 250 * 0.1);
+	EXPECT_NEAR(model.dead_time, 8, 4);
+	EXPECT_LT(model.rms, 0.5);
+}
+
+TEST_F(heater_model_test, rejects_a_heater_that_does_not_respond)
+{
+	float samples[HEATER_MODEL_MAX_SAMPLES];
+	uint8_t count = step(samples, 0, 90, 2.5, 255, 0.75, 210, 0.5);
+	HeaterModel model;
+	EXPECT_FALSE(HeaterModel__Fit(samples, count, 0.75, 255, &model));
+}
+
+TEST_F(heater_model_test, rejects_a_rise_that_does_not_slow_down)
+{
+	float samples[40];
+	for (int i = 0; i < 40; i++) samples[i] = 25 + i * i * 0.1;
+	HeaterModel model;
+	EXPECT_FALSE(HeaterModel__Fit(samples, 40, 1, 255, &model));
+}
+
+TEST_F(heater_model_test, slower_heaters_get_higher_gains)
+{
+	HeaterModel fast = { 1.4, 90, 2.5, 0, 0 }, slow = { 1.4, 180, 2.5, 0, 0 }, late = { 1.4, 90, 5, 0, 0 };
+	float kp, ki, kd, slow_kp, slow_ki, slow_kd, late_kp, late_ki, late_kd;
+	HeaterModel__Gains(&fast, &kp, &ki, &kd);
+	HeaterModel__Gains(&slow, &slow_kp, &slow_ki, &slow_kd);
+	HeaterModel__Gains(&late, &late_kp, &late_ki, &late_kd);
+
+	EXPECT_NEAR(kp, 90 / (1.4 * 5), 1e-3);
+	EXPECT_NEAR(ki, kp / 20, 1e-3);
+	EXPECT_NEAR(kd, kp * 1.25, 1e-3);
+	EXPECT_GT(slow_kp, kp);
+	// A longer dead time backs the controller off
+	EXPECT_LT(late_kp, kp);
+	EXPECT_LT(late_ki, ki);
+}
@@ -0,0 +1,127 @@
+#include <string>
+
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "mocks/hardware.h"
+
+// Built twice, with the default policy of waiting for room and with
+// TX_BUFFER_DROP (marlin_serial_drop_test)
+
+void idle() {}
+
+class marlin_serial_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		MYSERIAL.end();
+		MYSERIAL.begin(BAUDRATE);
+		MYSERIAL.flush();
+		queued = MYSERIAL.txQueued();
+		dropped = MYSERIAL.txDropped();
+	}
+
+	virtual void TearDown()
+	{
+		MYSERIAL.end();
+	}
+
+	// Bytes waiting in the ring
+	int waiting()
+	{
+		return (tx_buffer.head - tx_buffer.tail) & (TX_BUFFER_SIZE - 1);
+	}
+
+	// Fills the ring while the transmitter is busy
+	std::string fill()
+	{
+		std::string text;
+		for (int i = 0; i < TX_BUFFER_SIZE - 1; i++) text += 'a' + i % 26;
+		Hardware__SerialHoldTx(true);
+		MYSERIAL.write(text.c_str());
+		return text;
+	}
+
+	uint32_t queued;
+	uint32_t dropped;
+};
+
+TEST_F(marlin_serial_test, idle_uart_takes_bytes_directly)
+{
+	MYSERIAL.write("ok\n");
+	EXPECT_EQ(waiting(), 0);
+	EXPECT_FALSE(UCSR0B & _BV(UDRIE0));
+	EXPECT_EQ(Hardware__SerialTake(), "ok\n");
+	EXPECT_EQ(MYSERIAL.txQueued() - queued, 3);
+}
+
+TEST_F(marlin_serial_test, busy_uart_queues_for_the_interrupt)
+{
+	Hardware__SerialHoldTx(true);
+	MYSERIAL.write("ok T:");
+	MYSERIAL.print(210);
+	EXPECT_EQ(waiting(), 8);
+	EXPECT_TRUE(UCSR0B & _BV(UDRIE0));
+	EXPECT_EQ(Hardware__SerialTake(), "");
+
+	// Later bytes queue behind the waiting ones even once the UART is free
+	Hardware__SerialHoldTx(false);
+	MYSERIAL.write('\n');
+	EXPECT_EQ(waiting(), 9);
+	EXPECT_EQ(Hardware__SerialTake(), "ok T:210\n");
+	EXPECT_EQ(waiting(), 0);
+	EXPECT_FALSE(UCSR0B & _BV(UDRIE0));
+	EXPECT_EQ(MYSERIAL.txQueued() - queued, 9);
+}
+
+TEST_F(marlin_serial_test, full_ring_with_interrupts_off_sends_from_write)
+{
+	std::string text = fill();
+	Hardware__SerialHoldTx(false);
+	cli();
+	MYSERIAL.write('!');
+	EXPECT_EQ(waiting(), TX_BUFFER_SIZE - 1);
+	EXPECT_EQ(Hardware__SerialTake(), text + "!");
+	EXPECT_EQ(MYSERIAL.txDropped(), dropped);
+}
+
+TEST_F(marlin_serial_test, full_rx_ring_counts_dropped_bytes)
+{
+	uint16_t overflows = MYSERIAL.rxOverflows();
+	std::string burst(RX_BUFFER_SIZE + 9, 'G');
+	Hardware__SerialInject(burst.data(), burst.size());
+	Hardware__SerialPoll();
+	EXPECT_EQ(MYSERIAL.available(), RX_BUFFER_SIZE - 1);
+	EXPECT_EQ(MYSERIAL.rxOverflows() - overflows, 10);
+
+	// Reading makes room again, across the end of the ring
+	for (int i = 0; i < RX_BUFFER_SIZE - 1; i++) EXPECT_EQ(MYSERIAL.read(), 'G');
+	Hardware__SerialInject("ok\n", 3);
+	Hardware__SerialPoll();
+	EXPECT_EQ(MYSERIAL.available(), 3);
+	EXPECT_EQ(MYSERIAL.read(), 'o');
+	EXPECT_EQ(MYSERIAL.peek(), 'k');
+	EXPECT_EQ(MYSERIAL.read(), 'k');
+	EXPECT_EQ(MYSERIAL.read(), '\n');
+	EXPECT_EQ(MYSERIAL.read(), -1);
+	EXPECT_EQ(MYSERIAL.rxOverflows() - overflows, 10);
+}
+
+#if ENABLED(TX_BUFFER_DROP)
+
+TEST_F(marlin_serial_test, full_ring_drops_and_counts)
+{
+	std::string text = fill();
+	sei();
+	MYSERIAL.write("lost");
+	EXPECT_EQ(MYSERIAL.txDropped() - dropped, 4);
+	EXPECT_EQ(MYSERIAL.txQueued() - queued, TX_BUFFER_SIZE - 1);
+
+	Hardware__SerialHoldTx(false);
+	EXPECT_EQ(Hardware__SerialTake(), text);
+	MYSERIAL.write("ok\n");
+	EXPECT_EQ(Hardware__SerialTake(), "ok\n");
+}
+
+#endif
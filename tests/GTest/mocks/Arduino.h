@@ -0,0 +1,55 @@
+/**
+ * Arduino.h - Host stand-in for the Arduino core.
+ * Time is virtual: millis()/micros() follow the simulated Timer1 clock kept in
+ * mocks/hardware.cpp, and delay() advances it instead of blocking.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "avr/io.h"
+#include "avr/interrupt.h"
+#include "avr/pgmspace.h"
+#include "WString.h"
+
+#ifndef F_CPU
+  #define F_CPU 16000000L
+#endif
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define square(x) ((x)*(x))
+#define sq(x) ((x)*(x))
+
+#define NOT_A_PIN 0
+#define digitalPinToTimer(P) NOT_A_PIN
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+#endif // MOCK_ARDUINO_H
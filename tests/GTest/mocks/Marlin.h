@@ -7,6 +7,7 @@ using namespace std;
 
 
 #define SERIAL_PROTOCOLLNPGM(x) cout << x << endl
+#define SERIAL_PROTOCOLPGM(x) cout << x
 #define SERIAL_EOL cout << endl;
 #define READ(x)  x
 #define LOW 0
@@ -15,6 +16,18 @@ using namespace std;
 #define PSTR(x) x
 #define SERIAL_ERROR_START cout << "error start" << endl;
 
+#define _CAT(a, ...) a ## __VA_ARGS__
+#define SWITCH_ENABLED_  1
+#define ENABLED(b) _CAT(SWITCH_ENABLED_, b)
+
+#define E_AXIS 3
+#define DIGIPOT_MOTOR_CURRENT {135,135,191,75,135}
+#define AUGER_CURRENT 75
+#define PREVENT_DANGEROUS_EXTRUDE
+#define EXTRUDE_MINTEMP 170
+
+float extrude_min_temp = EXTRUDE_MINTEMP;
+
 bool Running = true;
 
 int CART0_SIG2_PIN = LOW;
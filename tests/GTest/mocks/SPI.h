@@ -0,0 +1,19 @@
+/**
+ * SPI.h - Host stand-in for the Arduino SPI library (digipot writes).
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_SPI_H
+#define MOCK_SPI_H
+
+#include <stdint.h>
+
+class SPIClass {
+  public:
+    void begin(void) {}
+    uint8_t transfer(uint8_t data) { return data; }
+};
+
+extern SPIClass SPI;
+
+#endif // MOCK_SPI_H
@@ -0,0 +1,21 @@
+/**
+ * WString.h - Host stand-in for the Arduino String class.
+ * Only the members used by MarlinSerial are provided.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_WSTRING_H
+#define MOCK_WSTRING_H
+
+#include <string.h>
+
+class String {
+  public:
+    String(const char *s = "") : str(s) {}
+    unsigned int length(void) const { return strlen(str); }
+    char operator[](unsigned int index) const { return str[index]; }
+  private:
+    const char *str;
+};
+
+#endif // MOCK_WSTRING_H
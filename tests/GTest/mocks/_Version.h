@@ -0,0 +1,9 @@
+/**
+ * _Version.h - Fixed version strings for host builds.
+ * On the printer this file is generated by build.sh.
+ */
+
+#define SHORT_BUILD_VERSION "1.1.0-V8 host"
+#define DETAILED_BUILD_VERSION "1.1.0-V8 host build"
+#define STRING_DISTRIBUTION_DATE "2016-01-01 12:00"
+#define SOURCE_CODE_URL  "https://github.com/Voxel8/Marlin"
@@ -0,0 +1,18 @@
+/**
+ * avr/eeprom.h - Host stand-in for the AVR EEPROM routines.
+ * Backed by a 4 KiB array in mocks/hardware.cpp.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_AVR_EEPROM_H
+#define MOCK_AVR_EEPROM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+uint8_t eeprom_read_byte(const uint8_t *addr);
+void eeprom_write_byte(uint8_t *addr, uint8_t value);
+void eeprom_read_block(void *dst, const void *src, size_t n);
+void eeprom_write_block(const void *src, void *dst, size_t n);
+
+#endif // MOCK_AVR_EEPROM_H
@@ -0,0 +1,19 @@
+/**
+ * avr/interrupt.h - Host stand-in for the AVR interrupt helpers.
+ * Interrupt vectors become plain functions named after the vector so that a
+ * host driver can invoke them, e.g. TIMER1_COMPA_vect().
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_AVR_INTERRUPT_H
+#define MOCK_AVR_INTERRUPT_H
+
+#include "avr/io.h"
+
+#define ISR(vector, ...) extern "C" void vector(void)
+#define SIGNAL(vector) extern "C" void vector(void)
+
+#define cli() do{ SREG &= (uint8_t)~0x80; }while(0)
+#define sei() do{ SREG |= 0x80; }while(0)
+
+#endif // MOCK_AVR_INTERRUPT_H
@@ -0,0 +1,216 @@
+/**
+ * avr/io.h - Host stand-in for the ATmega2560 register file.
+ * Used to build the firmware sources natively for simulation. Every register
+ * is a plain variable defined in mocks/hardware.cpp, except the USART0
+ * registers, which are backed by the host serial model so that the firmware's
+ * polled TX and RX paths behave like the real UART, and TWCR, which drives the
+ * host TWI bus model.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_AVR_IO_H
+#define MOCK_AVR_IO_H
+
+#include <stdint.h>
+
+#ifndef __AVR_ATmega2560__
+  #define __AVR_ATmega2560__
+#endif
+
+#define _BV(bit) (1 << (bit))
+#define _SFR_BYTE(sfr) (sfr)
+
+//===========================================================================
+//============================ Register storage =============================
+//===========================================================================
+
+#define MOCK_REGISTERS_8(REG) \
+  REG(SREG) \
+  REG(PINA)  REG(DDRA)  REG(PORTA) \
+  REG(PINB)  REG(DDRB)  REG(PORTB) \
+  REG(PINC)  REG(DDRC)  REG(PORTC) \
+  REG(PIND)  REG(DDRD)  REG(PORTD) \
+  REG(PINE)  REG(DDRE)  REG(PORTE) \
+  REG(PINF)  REG(DDRF)  REG(PORTF) \
+  REG(PING)  REG(DDRG)  REG(PORTG) \
+  REG(PINH)  REG(DDRH)  REG(PORTH) \
+  REG(PINJ)  REG(DDRJ)  REG(PORTJ) \
+  REG(PINK)  REG(DDRK)  REG(PORTK) \
+  REG(PINL)  REG(DDRL)  REG(PORTL) \
+  REG(TCCR0A) REG(TCCR0B) REG(TCNT0) REG(OCR0A) REG(OCR0B) REG(TIMSK0) REG(TIFR0) \
+  REG(TCCR1A) REG(TCCR1B) REG(TCCR1C) REG(TIMSK1) REG(TIFR1) \
+  REG(OCR1AL) REG(OCR1BL) REG(OCR1CL) \
+  REG(TCCR2A) REG(TCCR2B) REG(TCNT2) REG(OCR2A) REG(OCR2B) REG(TIMSK2) REG(TIFR2) \
+  REG(TCCR3A) REG(TCCR3B) REG(TIMSK3) REG(TIFR3) REG(OCR3AL) REG(OCR3BL) REG(OCR3CL) \
+  REG(TCCR4A) REG(TCCR4B) REG(TIMSK4) REG(TIFR4) REG(OCR4AL) REG(OCR4BL) REG(OCR4CL) \
+  REG(TCCR5A) REG(TCCR5B) REG(TIMSK5) REG(TIFR5) REG(OCR5AL) REG(OCR5BL) REG(OCR5CL) \
+  REG(OCR0AL) REG(OCR2AL) \
+  REG(ADCSRA) REG(ADCSRB) REG(ADMUX) REG(DIDR0) REG(DIDR2) \
+  REG(UCSR0B) REG(UCSR0C) REG(UBRR0H) REG(UBRR0L) \
+  REG(TWBR) REG(TWSR) REG(TWDR) REG(TWAR) \
+  REG(MCUSR) REG(WDTCSR) REG(SPCR) REG(SPSR) REG(SPDR)
+
+#define MOCK_REGISTERS_16(REG) \
+  REG(TCNT1) REG(OCR1A) REG(OCR1B) REG(OCR1C) \
+  REG(TCNT3) REG(OCR3A) REG(OCR3B) REG(OCR3C) \
+  REG(TCNT4) REG(OCR4A) REG(OCR4B) REG(OCR4C) \
+  REG(TCNT5) REG(OCR5A) REG(OCR5B) REG(OCR5C) \
+  REG(ADC)
+
+#define MOCK_DECLARE_8(name) extern volatile uint8_t name;
+#define MOCK_DECLARE_16(name) extern volatile uint16_t name;
+MOCK_REGISTERS_8(MOCK_DECLARE_8)
+MOCK_REGISTERS_16(MOCK_DECLARE_16)
+
+#define ADCL ((uint8_t)(ADC & 0xFF))
+#define ADCH ((uint8_t)(ADC >> 8))
+
+/**
+ * USART0 status register. UDRE0 reads as set (the host never has to wait for
+ * the shift register) unless held with Hardware__SerialHoldTx(), and RXC0
+ * reflects the pending host RX bytes.
+ */
+class MockUCSRA {
+  public:
+    MockUCSRA& operator=(uint8_t value);
+    MockUCSRA& operator|=(uint8_t value);
+    MockUCSRA& operator&=(uint8_t value);
+    operator uint8_t() const;
+};
+
+/**
+ * USART0 data register. Writes go to the host TX sink, reads pop the next
+ * byte injected with Hardware__SerialInject().
+ */
+class MockUDR {
+  public:
+    MockUDR& operator=(uint8_t value);
+    operator uint8_t();
+};
+
+/**
+ * TWI control register. Writing TWINT runs the requested bus action on the
+ * host TWI model, which then raises TWI_vect like the peripheral would.
+ */
+class MockTWCR {
+  public:
+    MockTWCR& operator=(uint8_t value);
+    MockTWCR& operator|=(uint8_t value);
+    MockTWCR& operator&=(uint8_t value);
+    operator uint8_t() const;
+};
+
+extern MockUCSRA UCSR0A;
+extern MockUDR UDR0;
+extern MockTWCR TWCR;
+
+// MarlinSerial probes for a UART with #if defined(UBRR0H)
+#define UBRR0H UBRR0H
+#define UDR0 UDR0
+
+//===========================================================================
+//================================ Bit names ================================
+//===========================================================================
+
+#define MOCK_PORT_BITS(P) \
+  enum { P##0 = 0, P##1 = 1, P##2 = 2, P##3 = 3, P##4 = 4, P##5 = 5, P##6 = 6, P##7 = 7 };
+MOCK_PORT_BITS(PINA) MOCK_PORT_BITS(PINB) MOCK_PORT_BITS(PINC) MOCK_PORT_BITS(PIND)
+MOCK_PORT_BITS(PINE) MOCK_PORT_BITS(PINF) MOCK_PORT_BITS(PING) MOCK_PORT_BITS(PINH)
+MOCK_PORT_BITS(PINJ) MOCK_PORT_BITS(PINK) MOCK_PORT_BITS(PINL)
+
+// SREG
+#define SREG_I 7
+
+// Timers
+#define WGM00 0
+#define WGM01 1
+#define WGM02 3
+#define WGM10 0
+#define WGM11 1
+#define WGM12 3
+#define WGM13 4
+#define COM0A0 6
+#define COM0B0 4
+#define COM1A0 6
+#define COM1B0 4
+#define COM1C0 2
+#define CS00 0
+#define CS01 1
+#define CS02 2
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define CS30 0
+#define CS31 1
+#define CS32 2
+#define CS40 0
+#define CS41 1
+#define CS42 2
+#define CS50 0
+#define CS51 1
+#define CS52 2
+#define TOIE0 0
+#define OCIE0A 1
+#define OCIE0B 2
+#define OCIE1A 1
+#define OCIE1B 2
+#define OCIE3A 1
+#define OCIE4A 1
+#define OCIE5A 1
+#define OCF1A 1
+#define OCF3A 1
+#define OCF4A 1
+#define OCF5A 1
+
+// ADC
+#define ADPS0 0
+#define ADPS1 1
+#define ADPS2 2
+#define ADIE 3
+#define ADIF 4
+#define ADATE 5
+#define ADSC 6
+#define ADEN 7
+#define MUX5 3
+#define REFS0 6
+#define REFS1 7
+
+// USART0
+#define MPCM0 0
+#define U2X0 1
+#define UPE0 2
+#define DOR0 3
+#define FE0 4
+#define UDRE0 5
+#define TXC0 6
+#define RXC0 7
+#define TXB80 0
+#define RXB80 1
+#define UCSZ02 2
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define TXCIE0 6
+#define RXCIE0 7
+
+// MCUSR
+#define PORF 0
+#define EXTRF 1
+#define BORF 2
+#define WDRF 3
+
+// TWI
+#define TWPS0 0
+#define TWPS1 1
+#define TWIE 0
+#define TWEN 2
+#define TWWC 3
+#define TWSTO 4
+#define TWSTA 5
+#define TWEA 6
+#define TWINT 7
+
+#endif // MOCK_AVR_IO_H
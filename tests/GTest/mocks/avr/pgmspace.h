@@ -0,0 +1,36 @@
+/**
+ * avr/pgmspace.h - Host stand-in for AVR program memory access.
+ * The host has a single address space, so flash reads are plain loads.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_AVR_PGMSPACE_H
+#define MOCK_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) (*(void * const *)(addr))
+#define pgm_read_byte_near(addr) pgm_read_byte(addr)
+#define pgm_read_word_near(addr) pgm_read_word(addr)
+#define pgm_read_float_near(addr) pgm_read_float(addr)
+
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strchr_P strchr
+#define strstr_P strstr
+#define sprintf_P sprintf
+#define memcpy_P memcpy
+
+#endif // MOCK_AVR_PGMSPACE_H
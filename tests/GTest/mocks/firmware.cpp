@@ -0,0 +1,77 @@
+/**
+ * firmware.cpp - The parts of Marlin_main.cpp the host build of the motion
+ * core links against: the globals planner.cpp and stepper.cpp read, and
+ * stand-ins for the functions they call.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include "../../../Marlin/Marlin.h"
+#include "../../../Marlin/planner.h"
+#include "../../../Marlin/stepper.h"
+#include "../../../Marlin/temperature.h"
+#include "firmware.h"
+
+//===========================================================================
+//======================= Firmware globals (Marlin_main) ====================
+//===========================================================================
+
+const char echomagic[] PROGMEM = "echo:";
+uint8_t marlin_debug_flags = DEBUG_INFO|DEBUG_ERRORS;
+bool axis_known_position[3] = { false };
+int fanSpeed = 0;
+int extruder_multiplier[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(100);
+float volumetric_multiplier[EXTRUDERS] = ARRAY_BY_EXTRUDERS1(1.0);
+#if ENABLED(PREVENT_DANGEROUS_EXTRUDE)
+  float extrude_min_temp = EXTRUDE_MINTEMP;
+#endif
+int target_temperature[4] = { 0 };
+float current_temperature[4] = { 250, 250, 250, 250 }; // Hot, so extrusion is never blocked
+
+#if ENABLED(PNEUMATICS)
+  uint8_t solenoid_state = 0;
+#endif
+#if ENABLED(E_REGULATOR)
+  float regulator_setpoint = 0;
+  void set_regulator_setpoint(float psi) { regulator_setpoint = psi; }
+#endif
+
+void serial_echopair_P(const char *s_P, int v)           { serialprintPGM(s_P); SERIAL_ECHO(v); }
+void serial_echopair_P(const char *s_P, long v)          { serialprintPGM(s_P); SERIAL_ECHO(v); }
+void serial_echopair_P(const char *s_P, float v)         { serialprintPGM(s_P); SERIAL_ECHO(v); }
+void serial_echopair_P(const char *s_P, double v)        { serialprintPGM(s_P); SERIAL_ECHO(v); }
+void serial_echopair_P(const char *s_P, unsigned long v) { serialprintPGM(s_P); SERIAL_ECHO(v); }
+
+void disable_all_steppers() {}
+void start_watching_heater(int e) { (void)e; }
+
+// The laser mesh (BedScan.cpp) is never active on the host
+#if ENABLED(LASER_MESH_LEVELING)
+  bool BedScan__MeshActive(void) { return false; }
+  float BedScan__MeshZ(float x, float y) { (void)x; (void)y; return 0; }
+#endif
+
+//===========================================================================
+//============================== Motion defaults ============================
+//===========================================================================
+
+void Firmware__ResetMotion() {
+  float steps[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  float feedrates[] = DEFAULT_MAX_FEEDRATE;
+  long accelerations[] = DEFAULT_MAX_ACCELERATION;
+  for (uint8_t i = 0; i < NUM_AXIS; i++) {
+    axis_steps_per_unit[i] = steps[i];
+    max_feedrate[i] = feedrates[i];
+    max_acceleration_units_per_sq_second[i] = accelerations[i];
+  }
+  reset_acceleration_rates();
+
+  acceleration = DEFAULT_ACCELERATION;
+  retract_acceleration = DEFAULT_RETRACT_ACCELERATION;
+  travel_acceleration = DEFAULT_TRAVEL_ACCELERATION;
+  minimumfeedrate = DEFAULT_MINIMUMFEEDRATE;
+  minsegmenttime = DEFAULT_MINSEGMENTTIME;
+  mintravelfeedrate = DEFAULT_MINTRAVELFEEDRATE;
+  max_xy_jerk = DEFAULT_XYJERK;
+  max_z_jerk = DEFAULT_ZJERK;
+  max_e_jerk = DEFAULT_EJERK;
+}
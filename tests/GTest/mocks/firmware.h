@@ -0,0 +1,14 @@
+/**
+ * firmware.h - Helpers for the stand-in firmware globals in firmware.cpp.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_FIRMWARE_H
+#define MOCK_FIRMWARE_H
+
+/**
+ * Load the motion defaults from Configuration.h, as Config_ResetDefault() does
+ */
+void Firmware__ResetMotion();
+
+#endif // MOCK_FIRMWARE_H
@@ -0,0 +1,307 @@
+/**
+ * hardware.cpp - Host model of the ATmega2560 peripherals used by the motion core.
+ * Provides storage for the register file declared in mocks/avr/io.h, the
+ * virtual clock behind millis()/micros(), the USART0 data path, the TWI bus,
+ * the EEPROM array and the handful of Arduino core functions the firmware
+ * calls.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include <deque>
+#include <map>
+#include <string>
+
+// Arduino.h defines min()/max() as macros, so the STL goes first
+#include "hardware.h"
+#include "Arduino.h"
+#include "SPI.h"
+#include "avr/eeprom.h"
+#include "util/delay.h"
+#include "util/twi.h"
+
+extern "C" void USART0_RX_vect(void);
+extern "C" void USART0_UDRE_vect(void);
+extern "C" void TWI_vect(void);
+
+//===========================================================================
+//============================ Register storage =============================
+//===========================================================================
+
+#define MOCK_DEFINE_8(name) volatile uint8_t name;
+#define MOCK_DEFINE_16(name) volatile uint16_t name;
+MOCK_REGISTERS_8(MOCK_DEFINE_8)
+MOCK_REGISTERS_16(MOCK_DEFINE_16)
+
+MockUCSRA UCSR0A;
+MockUDR UDR0;
+MockTWCR TWCR;
+
+SPIClass SPI;
+
+static uint64_t ticks = 0;
+static void (*clock_hook)() = NULL;
+static bool in_clock_hook = false;
+static uint8_t ucsr0a = _BV(UDRE0);
+static std::deque<uint8_t> rx_pending;
+static std::string tx_sink;
+static bool tx_held = false;
+static uint8_t pin_state[256];
+static uint8_t pin_pwm[256];
+static uint16_t pin_adc[256];
+static uint8_t eeprom_data[4096];
+
+enum TwiState { TWI_IDLE, TWI_STARTED, TWI_WRITING, TWI_READING, TWI_NOT_ADDRESSED };
+static uint8_t twcr = 0;
+static TwiState twi_state = TWI_IDLE;
+static MockTwiDevice *twi_device = NULL;
+static std::map<uint8_t, MockTwiDevice *> twi_devices;
+static bool twi_stalled = false;
+static bool twi_in_isr = false;
+static bool twi_interrupt = false;
+
+//===========================================================================
+//============================== Virtual clock ==============================
+//===========================================================================
+
+void Hardware__Reset() {
+  ticks = 0;
+  clock_hook = NULL;
+  ucsr0a = _BV(UDRE0);
+  rx_pending.clear();
+  tx_sink.clear();
+  tx_held = false;
+  memset(pin_state, 0, sizeof(pin_state));
+  memset(pin_pwm, 0, sizeof(pin_pwm));
+  memset(pin_adc, 0, sizeof(pin_adc));
+  SREG = 0;
+  twcr = 0;
+  twi_state = TWI_IDLE;
+  twi_devices.clear();
+  twi_stalled = false;
+}
+
+uint64_t Hardware__Ticks() { return ticks; }
+
+void Hardware__AdvanceTicks(uint64_t count) { ticks += count; }
+
+void Hardware__AdvanceMs(unsigned long ms) { Hardware__AdvanceTicks((uint64_t)ms * (HARDWARE_TICKS_PER_SECOND / 1000)); }
+
+void Hardware__SetClockHook(void (*hook)()) { clock_hook = hook; }
+
+static void run_clock_hook() {
+  if (!clock_hook || in_clock_hook) return;
+  in_clock_hook = true;
+  clock_hook();
+  in_clock_hook = false;
+}
+
+unsigned long millis(void) {
+  run_clock_hook();
+  return (unsigned long)(ticks / (HARDWARE_TICKS_PER_SECOND / 1000));
+}
+
+unsigned long micros(void) {
+  run_clock_hook();
+  return (unsigned long)(ticks / (HARDWARE_TICKS_PER_SECOND / 1000000));
+}
+
+void delay(unsigned long ms) { ticks += (uint64_t)ms * (HARDWARE_TICKS_PER_SECOND / 1000); }
+
+void delayMicroseconds(unsigned int us) { ticks += (uint64_t)us * (HARDWARE_TICKS_PER_SECOND / 1000000); }
+
+//===========================================================================
+//================================== USART0 =================================
+//===========================================================================
+
+MockUCSRA& MockUCSRA::operator=(uint8_t value) {
+  ucsr0a = value;
+  return *this;
+}
+
+MockUCSRA& MockUCSRA::operator|=(uint8_t value) {
+  ucsr0a |= value;
+  return *this;
+}
+
+MockUCSRA& MockUCSRA::operator&=(uint8_t value) {
+  ucsr0a &= value;
+  return *this;
+}
+
+MockUCSRA::operator uint8_t() const {
+  uint8_t value = tx_held ? ucsr0a & (uint8_t)~_BV(UDRE0) : ucsr0a | _BV(UDRE0);
+  if (rx_pending.empty()) value &= (uint8_t)~_BV(RXC0);
+  else value |= _BV(RXC0);
+  return value;
+}
+
+MockUDR& MockUDR::operator=(uint8_t value) {
+  tx_sink.push_back((char)value);
+  return *this;
+}
+
+MockUDR::operator uint8_t() {
+  if (rx_pending.empty()) return 0;
+  uint8_t c = rx_pending.front();
+  rx_pending.pop_front();
+  return c;
+}
+
+void Hardware__SerialInject(const char* data, size_t length) {
+  rx_pending.insert(rx_pending.end(), data, data + length);
+}
+
+size_t Hardware__SerialPending() { return rx_pending.size(); }
+
+void Hardware__SerialPoll() {
+  if (!(UCSR0B & _BV(RXEN0)) || !(UCSR0B & _BV(RXCIE0))) return;
+  while (!rx_pending.empty()) USART0_RX_vect();
+}
+
+void Hardware__SerialHoldTx(bool held) { tx_held = held; }
+
+std::string Hardware__SerialTake() {
+  while (!tx_held && (UCSR0B & _BV(UDRIE0))) USART0_UDRE_vect();
+  std::string out;
+  out.swap(tx_sink);
+  return out;
+}
+
+//===========================================================================
+//==================================== TWI ==================================
+//===========================================================================
+
+// One byte plus the acknowledge, in Timer1 ticks
+static uint64_t twi_byte_ticks() {
+  return 9 * (16 + 2 * (uint64_t)TWBR) / 8;
+}
+
+// Sets TWINT and runs TWI_vect. An action requested from within TWI_vect
+// raises the next interrupt once it returns, as the AVR doesn't nest them.
+static void twi_raise(uint8_t status) {
+  TWSR = status;
+  twcr |= _BV(TWINT);
+  if (!(twcr & _BV(TWIE))) return;
+  twi_interrupt = true;
+  if (twi_in_isr) return;
+  twi_in_isr = true;
+  while (twi_interrupt) {
+    twi_interrupt = false;
+    TWI_vect();
+  }
+  twi_in_isr = false;
+}
+
+MockTWCR& MockTWCR::operator=(uint8_t value) {
+  twcr = value & (uint8_t)~_BV(TWINT);
+  if (!(value & _BV(TWEN))) {
+    twi_state = TWI_IDLE;
+    return *this;
+  }
+  if (!(value & _BV(TWINT)) || twi_stalled) return *this;
+
+  if (value & _BV(TWSTO)) {
+    twi_state = TWI_IDLE;
+    twcr &= (uint8_t)~_BV(TWSTO);
+    if (!(value & _BV(TWSTA))) return *this;
+  }
+  Hardware__AdvanceTicks(twi_byte_ticks());
+
+  if (value & _BV(TWSTA)) {
+    uint8_t status = twi_state == TWI_IDLE ? TW_START : TW_REP_START;
+    twi_state = TWI_STARTED;
+    twi_raise(status);
+    return *this;
+  }
+
+  switch (twi_state) {
+    case TWI_STARTED: {
+      bool read = TWDR & TW_READ;
+      std::map<uint8_t, MockTwiDevice *>::iterator it = twi_devices.find(TWDR >> 1);
+      twi_device = it == twi_devices.end() ? NULL : it->second;
+      if (!twi_device) {
+        twi_state = TWI_NOT_ADDRESSED;
+        twi_raise(read ? TW_MR_SLA_NACK : TW_MT_SLA_NACK);
+      }
+      else {
+        twi_state = read ? TWI_READING : TWI_WRITING;
+        twi_raise(read ? TW_MR_SLA_ACK : TW_MT_SLA_ACK);
+      }
+    } break;
+
+    case TWI_WRITING:
+      twi_device->written.push_back((char)TWDR);
+      twi_raise(TW_MT_DATA_ACK);
+      break;
+
+    case TWI_READING:
+      if (twi_device->response.empty()) TWDR = 0xFF;
+      else {
+        TWDR = (uint8_t)twi_device->response[0];
+        twi_device->response.erase(0, 1);
+      }
+      twi_raise(value & _BV(TWEA) ? TW_MR_DATA_ACK : TW_MR_DATA_NACK);
+      break;
+
+    default:
+      twi_raise(TW_BUS_ERROR);
+      break;
+  }
+  return *this;
+}
+
+MockTWCR& MockTWCR::operator|=(uint8_t value) { return *this = twcr | value; }
+
+MockTWCR& MockTWCR::operator&=(uint8_t value) { return *this = twcr & value; }
+
+MockTWCR::operator uint8_t() const { return twcr; }
+
+void Hardware__TwiAttach(uint8_t address, MockTwiDevice *device) {
+  if (device) twi_devices[address] = device;
+  else twi_devices.erase(address);
+}
+
+void Hardware__TwiStall(bool stalled) { twi_stalled = stalled; }
+
+//===========================================================================
+//================================ Pins / ADC ===============================
+//===========================================================================
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+
+void digitalWrite(uint8_t pin, uint8_t value) { pin_state[pin] = value ? HIGH : LOW; }
+
+int digitalRead(uint8_t pin) { return pin_state[pin]; }
+
+int analogRead(uint8_t pin) { return pin_adc[pin]; }
+
+void analogWrite(uint8_t pin, int value) {
+  pin_state[pin] = value ? HIGH : LOW;
+  pin_pwm[pin] = value;
+}
+
+uint8_t Hardware__AnalogOut(uint8_t pin) { return pin_pwm[pin]; }
+
+void Hardware__AnalogIn(uint8_t pin, uint16_t value) { pin_adc[pin] = value; }
+
+//===========================================================================
+//================================== EEPROM =================================
+//===========================================================================
+
+uint8_t eeprom_read_byte(const uint8_t *addr) {
+  return eeprom_data[(uintptr_t)addr % sizeof(eeprom_data)];
+}
+
+void eeprom_write_byte(uint8_t *addr, uint8_t value) {
+  eeprom_data[(uintptr_t)addr % sizeof(eeprom_data)] = value;
+}
+
+void eeprom_read_block(void *dst, const void *src, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    ((uint8_t *)dst)[i] = eeprom_read_byte((const uint8_t *)src + i);
+}
+
+void eeprom_write_block(const void *src, void *dst, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    eeprom_write_byte((uint8_t *)dst + i, ((const uint8_t *)src)[i]);
+}
@@ -0,0 +1,72 @@
+/**
+ * hardware.h - Host model of the ATmega2560 peripherals used by the motion core.
+ * Time is counted in Timer1 ticks (F_CPU / 8, i.e. 0.5us) so that the stepper
+ * ISR can be scheduled from OCR1A exactly as the hardware would.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_HARDWARE_H
+#define MOCK_HARDWARE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+#define HARDWARE_TICKS_PER_SECOND (F_CPU / 8)
+
+/**
+ * Virtual clock
+ */
+void Hardware__Reset();
+uint64_t Hardware__Ticks();
+void Hardware__AdvanceTicks(uint64_t ticks);
+void Hardware__AdvanceMs(unsigned long ms);
+
+/**
+ * Called whenever the firmware reads the clock through millis() or micros(),
+ * but not from within the hook itself. On the host no time passes while
+ * firmware code runs, so a harness that runs the whole main loop uses this
+ * to advance the clock and raise the interrupts that fall due: every wait
+ * loop in the firmware polls the clock through idle(). NULL removes it.
+ */
+void Hardware__SetClockHook(void (*hook)());
+
+/**
+ * Serial port model. Injected bytes are delivered through the USART0 RX
+ * vector when Hardware__SerialPoll() is called with the receiver enabled;
+ * transmitted bytes are collected until taken. Taking them first runs the
+ * UDRE vector while it is enabled, as the line would once the firmware
+ * goes back to waiting, unless the transmitter is held busy.
+ */
+void Hardware__SerialInject(const char* data, size_t length);
+size_t Hardware__SerialPending();
+void Hardware__SerialPoll();
+std::string Hardware__SerialTake();
+void Hardware__SerialHoldTx(bool held);
+
+/**
+ * TWI bus model. An attached device acknowledges its address, appends the
+ * bytes written to it to 'written' and answers reads from the front of
+ * 'response' (0xFF once empty). Other addresses are not acknowledged. Each
+ * byte on the bus advances the clock by nine SCL periods at the TWBR rate.
+ * A stalled bus never completes an action, as with a slave holding SCL low.
+ */
+struct MockTwiDevice {
+  std::string written;
+  std::string response;
+};
+
+void Hardware__TwiAttach(uint8_t address, MockTwiDevice *device);
+void Hardware__TwiStall(bool stalled);
+
+/**
+ * Last analogWrite() value of a pin
+ */
+uint8_t Hardware__AnalogOut(uint8_t pin);
+
+/**
+ * Sets what analogRead() returns for a pin, 0 until set
+ */
+void Hardware__AnalogIn(uint8_t pin, uint16_t value);
+
+#endif // MOCK_HARDWARE_H
@@ -0,0 +1,11 @@
+/**
+ * pins_arduino.h - Host stand-in for the Arduino Mega pin variant.
+ * The firmware addresses pins through fastio.h and pins.h, so nothing of the
+ * variant table is needed on the host.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_PINS_ARDUINO_H
+#define MOCK_PINS_ARDUINO_H
+
+#endif // MOCK_PINS_ARDUINO_H
@@ -6,3 +6,8 @@ void disable_all_steppers() {
 void quickStop() {
 
 }
+
+
+void digipot_current(uint8_t driver, int current) {
+
+}
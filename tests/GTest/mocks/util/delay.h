@@ -0,0 +1,15 @@
+/**
+ * util/delay.h - Host stand-in for the AVR busy-wait delays.
+ * Delays advance the virtual clock instead of spinning.
+ * Copyright (C) 2016 Voxel8
+ */
+
+#ifndef MOCK_UTIL_DELAY_H
+#define MOCK_UTIL_DELAY_H
+
+void delayMicroseconds(unsigned int us);
+
+#define _delay_us(us) delayMicroseconds(us)
+#define _delay_ms(ms) delayMicroseconds((ms) * 1000U)
+
+#endif // MOCK_UTIL_DELAY_H
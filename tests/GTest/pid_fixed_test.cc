@@ -0,0 +1,91 @@
+#include <math.h>
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/PidFixed.h"
+
+#define K2 (1.0 - K1)
+
+class pid_fixed_test : public ::testing::Test {};
+
+TEST_F(pid_fixed_test, multiply_rounds_down)
+{
+	const float values[] = { 0, 1, -1, 0.5, -0.5, 1.0 / 3, 19.96, -29.99, 255, -255, 0.00012, 180.5 };
+	for (size_t i = 0; i < COUNT(values); i++)
+		for (size_t j = 0; j < COUNT(values); j++) {
+			pid_fixed_t a = PID_FIXED(values[i]), b = PID_FIXED(values[j]);
+			double exact = (double)a * b / PID_FIXED_ONE;
+			if (fabs(exact) >= 32768.0 * PID_FIXED_ONE) continue; // Out of range
+			EXPECT_EQ(PidFixed__Multiply(a, b), (pid_fixed_t)floor(exact))
+				<< values[i] << " * " << values[j];
+		}
+}
+
+// The float terms of get_pid_output() on the same errors
+TEST_F(pid_fixed_test, follows_the_float_pid)
+{
+	const float kp = 19.96, ki = 1.24 * 0.2, kd = 80.47 / 0.2, i_max = PID_INTEGRAL_DRIVE_MAX / ki;
+	PidFixed pid = {};
+	PidFixed__SetGains(&pid, kp, ki, kd, K1, PID_INTEGRAL_DRIVE_MAX, PID_MAX);
+	pid.last_input = PID_FIXED(200.0);
+
+	float i_state = 0, d_state = 200, d_term = 0;
+	for (int i = 0; i < 500; i++) {
+		float input = 200 + 8 * sin(i / 15.0), error = 205 - input;
+
+		d_term = K2 * kd * (input - d_state) + K1 * d_term;
+		d_state = input;
+		i_state = constrain(i_state + error, 0, i_max);
+		float output = kp * error + ki * i_state - d_term;
+		if (output > PID_MAX) { if (error > 0) i_state -= error; output = PID_MAX; }
+		else if (output < 0) { if (error < 0) i_state -= error; output = 0; }
+
+		PidFixed__Track(&pid, PID_FIXED(input));
+		ASSERT_NEAR(PID_FIXED_TO_FLOAT(PidFixed__Output(&pid, PID_FIXED(error), 0)), output, 0.05) << "sample " << i;
+	}
+}
+
+TEST_F(pid_fixed_test, integral_is_limited_and_unwound_at_saturation)
+{
+	PidFixed pid = {};
+	PidFixed__SetGains(&pid, 10, 1, 0, K1, 100, 255);
+
+	// Saturated high: the integral gives back what it took
+	EXPECT_EQ(PidFixed__Output(&pid, PID_FIXED(30), 0), PID_FIXED(255));
+	EXPECT_EQ(pid.i_term, 0);
+
+	// Below saturation it builds up to the drive limit
+	for (int i = 0; i < 200; i++) PidFixed__Output(&pid, PID_FIXED(1), 0);
+	EXPECT_EQ(pid.i_term, PID_FIXED(100));
+
+	// A negative output does not unwind a positive error's integral
+	EXPECT_EQ(PidFixed__Output(&pid, PID_FIXED(2), PID_FIXED(-500)), 0);
+	EXPECT_EQ(pid.i_term, PID_FIXED(100));
+
+	PidFixed__ResetIntegral(&pid);
+	EXPECT_EQ(pid.i_term, 0);
+}
+
+// A float integral of errors would need PID_MAX / Ki, far out of Q16.16
+TEST_F(pid_fixed_test, small_ki_stays_in_range)
+{
+	PidFixed pid = {};
+	PidFixed__SetGains(&pid, 1, 0.0005, 0, K1, PID_MAX, PID_MAX);
+	for (long i = 0; i < 100000; i++) PidFixed__Output(&pid, PID_FIXED(20), 0);
+	EXPECT_GT(pid.i_term, PID_FIXED(200));
+	EXPECT_LE(pid.i_term, PID_FIXED(PID_MAX));
+}
+
+TEST_F(pid_fixed_test, derivative_smooths_and_limits_a_glitch)
+{
+	PidFixed pid = {};
+	PidFixed__SetGains(&pid, 0, 0, 100, K1, 0, 255);
+	pid.last_input = PID_FIXED(200.0);
+	PidFixed__Track(&pid, PID_FIXED(201.0));
+	EXPECT_NEAR(PID_FIXED_TO_FLOAT(pid.d_term), K2 * 100, 0.001);
+
+	// A jump past the limit counts as 64 C
+	pid.d_term = 0;
+	pid.last_input = 0;
+	PidFixed__Track(&pid, PID_FIXED(300.0));
+	EXPECT_NEAR(PID_FIXED_TO_FLOAT(pid.d_term), K2 * 100 * 64, 0.01);
+}
@@ -0,0 +1,306 @@
+/**
+ * pid_sim.cc - Host thermal plant simulator for the hot end and bed PIDs.
+ *
+ * Runs the float PID of get_pid_output() and the Q16.16 one of PidFixed.cpp
+ * against first order plus dead time models of the heaters, sampled every
+ * PID_dT as manage_heater() is and driven through soft_pwm as the heaters
+ * are. For each plant it reports the overshoot, the settling time into
+ * +-SETTLE_BAND and the remaining error of a step from ambient to the target
+ * with the configured gains. It then tunes the plant with the relay of
+ * PID_autotune() and with the step and model fit of PID_autotune_step(),
+ * and steps again with the gains each finds. The host time per PID
+ * update is reported too, but the host does float in hardware, so it does
+ * not show the soft-float cost the AVR saves.
+ *
+ * Fails if the fixed-point PID settles more than MAX_SETTLE_DIFF seconds or
+ * overshoots more than MAX_OVERSHOOT_DIFF degrees apart from the float one.
+ *
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/PidFixed.h"
+#include "../../Marlin/HeaterModel.h"
+
+#define PID_dT ((OVERSAMPLENR * 12.0)/(F_CPU / 64.0 / 256.0))
+#define K2 (1.0 - K1)
+
+#define AMBIENT            25.0
+#define SETTLE_BAND        1.0    // C
+#define STEP_SECONDS       600
+#define MAX_SETTLE_DIFF    2.0    // s
+#define MAX_OVERSHOOT_DIFF 0.5    // C
+
+//===========================================================================
+//============================ Thermal plant ================================
+//===========================================================================
+
+typedef struct {
+  const char *name;
+  float gain;       // Steady state rise per PID output count
+  float tau;        // s
+  float dead_time;  // s
+  float target;
+  float out_max;    // PID_MAX or MAX_BED_POWER
+  float kp, ki, kd; // Unscaled, as M301 takes them
+  bool functional_range;
+} Plant;
+
+static const Plant plants[] = {
+  // An E3D V6 with PT100 as extruder 0, with its configured gains
+  { "hotend E0", 1.40, 90, 2.5, 210, PID_MAX, DEFAULT_Kp, DEFAULT_Ki, DEFAULT_Kd, true },
+  // A heavier cartridge, on extruder 0's gains unless DEFAULT_Kp_E1 is set
+  { "hotend E1", 1.00, 150, 4.0, 210, PID_MAX, DEFAULT_Kp_E1, DEFAULT_Ki_E1, DEFAULT_Kd_E1, true },
+  { "bed", 0.45, 250, 8.0, 90, MAX_BED_POWER, DEFAULT_bedKp, DEFAULT_bedKi, DEFAULT_bedKd, false },
+};
+
+typedef struct {
+  const Plant *plant;
+  float temperature;
+  float delay_line[512]; // Heater power of the last samples, for the dead time
+  int delay, head;
+} PlantState;
+
+static void plant_reset(PlantState *s, const Plant *plant) {
+  s->plant = plant;
+  s->temperature = AMBIENT;
+  s->delay = lround(plant->dead_time / PID_dT);
+  s->head = 0;
+  for (int i = 0; i < 512; i++) s->delay_line[i] = 0;
+}
+
+// Applies the output of one sample, through soft_pwm as manage_heater() does
+static void plant_step(PlantState *s, float pid_output) {
+  int soft_pwm = (int)pid_output >> 1;
+  s->delay_line[s->head] = soft_pwm * 2;
+  float power = s->delay_line[(s->head + 512 - s->delay) % 512];
+  s->head = (s->head + 1) % 512;
+  float rise = s->plant->gain * power - (s->temperature - AMBIENT);
+  s->temperature += rise * (1 - exp(-PID_dT / s->plant->tau));
+}
+
+//===========================================================================
+//============================ Controllers ==================================
+//===========================================================================
+
+// The float PID of get_pid_output() and get_pid_output_bed()
+typedef struct {
+  float kp, ki, kd, i_state, i_max, d_state, d_term, out_max;
+  bool range, reset;
+} FloatPid;
+
+static float float_pid(FloatPid *c, float target, float input) {
+  float error = target - input, output;
+  c->d_term = K2 * c->kd * (input - c->d_state) + K1 * c->d_term;
+  c->d_state = input;
+  if (c->range && error > PID_FUNCTIONAL_RANGE) { c->reset = true; return BANG_MAX; }
+  if (c->range && error < -PID_FUNCTIONAL_RANGE) { c->reset = true; return 0; }
+  if (c->reset) { c->i_state = 0; c->reset = false; }
+  c->i_state = constrain(c->i_state + error, 0, c->i_max);
+  output = c->kp * error + c->ki * c->i_state - c->d_term;
+  if (output > c->out_max) {
+    if (error > 0) c->i_state -= error;
+    output = c->out_max;
+  }
+  else if (output < 0) {
+    if (error < 0) c->i_state -= error;
+    output = 0;
+  }
+  return output;
+}
+
+typedef struct {
+  PidFixed pid;
+  bool range, reset;
+} FixedPid;
+
+static float fixed_pid(FixedPid *c, float target, float input) {
+  float error = target - input;
+  PidFixed__Track(&c->pid, PID_FIXED(input));
+  if (c->range && error > PID_FUNCTIONAL_RANGE) { c->reset = true; return BANG_MAX; }
+  if (c->range && error < -PID_FUNCTIONAL_RANGE) { c->reset = true; return 0; }
+  if (c->reset) { PidFixed__ResetIntegral(&c->pid); c->reset = false; }
+  return PidFixed__Output(&c->pid, PID_FIXED(error), 0) >> 16;
+}
+
+typedef struct {
+  float overshoot;    // C above the target
+  float settling;     // s until it stays within SETTLE_BAND, -1 if never
+  float final_error;  // C
+  double ns;          // Host time per update
+} Response;
+
+template <typename C, typename F> static Response step(const Plant *plant, C *controller, F update) {
+  PlantState s;
+  plant_reset(&s, plant);
+  Response r = { 0, -1, 0, 0 };
+  int samples = STEP_SECONDS / PID_dT;
+  double ns = 0;
+  for (int i = 0; i < samples; i++) {
+    auto start = std::chrono::steady_clock::now();
+    float output = update(controller, plant->target, s.temperature);
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    plant_step(&s, output);
+    float error = s.temperature - plant->target;
+    NOLESS(r.overshoot, error);
+    if (fabs(error) > SETTLE_BAND) r.settling = -1;
+    else if (r.settling < 0) r.settling = (i + 1) * PID_dT;
+  }
+  r.final_error = s.temperature - plant->target;
+  r.ns = ns / samples;
+  return r;
+}
+
+static Response step_float(const Plant *plant, float kp, float ki, float kd) {
+  FloatPid c = { kp, ki * (float)PID_dT, kd / (float)PID_dT, 0, 0, AMBIENT, 0, plant->out_max, plant->functional_range, true };
+  c.i_max = (plant->functional_range ? PID_INTEGRAL_DRIVE_MAX : PID_BED_INTEGRAL_DRIVE_MAX) / c.ki;
+  return step(plant, &c, float_pid);
+}
+
+static Response step_fixed(const Plant *plant, float kp, float ki, float kd) {
+  FixedPid c = {};
+  PidFixed__SetGains(&c.pid, kp, ki * PID_dT, kd / PID_dT, K1,
+                     plant->functional_range ? PID_INTEGRAL_DRIVE_MAX : PID_BED_INTEGRAL_DRIVE_MAX, plant->out_max);
+  c.pid.last_input = PID_FIXED(AMBIENT);
+  c.range = plant->functional_range;
+  c.reset = true;
+  return step(plant, &c, fixed_pid);
+}
+
+//===========================================================================
+//============================ Autotune =====================================
+//===========================================================================
+
+/**
+ * The relay of PID_autotune() with its bias and amplitude adjustment and
+ * classic Ziegler-Nichols gains, on the plant instead of the heater.
+ * @returns false if it did not finish the cycles
+ */
+static bool autotune(const Plant *plant, int ncycles, float *kp, float *ki, float *kd, float *seconds) {
+  PlantState s;
+  plant_reset(&s, plant);
+  long max_pow = plant->out_max, bias = max_pow / 2, d = max_pow / 2;
+  // soft_pwm starts at bias, which is an output of bias + d
+  float output = bias + d, max = 0, min = 10000, temp = plant->target;
+  long ms = 0, t1 = 0, t2 = 0, t_high = 0, t_low = 0;
+  int cycles = 0;
+  bool heating = true, tuned = false;
+
+  for (; ms < 3600L * 1000; ms += lround(PID_dT * 1000)) {
+    plant_step(&s, output);
+    float input = s.temperature;
+    max = max(max, input);
+    min = min(min, input);
+    if (heating && input > temp && ms > t2 + 5000) {
+      heating = false;
+      output = bias - d;
+      t1 = ms;
+      t_high = t1 - t2;
+      max = temp;
+    }
+    if (!heating && input < temp && ms > t1 + 5000) {
+      heating = true;
+      t2 = ms;
+      t_low = t2 - t1;
+      if (cycles > 0) {
+        bias += (d * (t_high - t_low)) / (t_low + t_high);
+        bias = constrain(bias, 20, max_pow - 20);
+        d = (bias > max_pow / 2) ? max_pow - 1 - bias : bias;
+        if (cycles > 2) {
+          float Ku = (4.0 * d) / (3.14159265 * (max - min) / 2.0),
+                Tu = (t_low + t_high) / 1000.0;
+          *kp = 0.6 * Ku;
+          *ki = 2 * *kp / Tu;
+          *kd = *kp * Tu / 8;
+          tuned = true;
+        }
+      }
+      output = bias + d;
+      *seconds = ms / 1000.0;
+      if (++cycles > ncycles) return tuned;
+      min = temp;
+    }
+  }
+  return false;
+}
+
+/**
+ * The step of PID_autotune_step(): full power from rest, sampled every
+ * interval until the target or HEATER_MODEL_MAX_SAMPLES, then the model fit.
+ */
+static bool model_autotune(const Plant *plant, float *kp, float *ki, float *kd, float *seconds) {
+  PlantState s;
+  plant_reset(&s, plant);
+  float interval = (plant->functional_range ? PID_FOPDT_INTERVAL : PID_FOPDT_BED_INTERVAL) / 1000.0,
+        samples[HEATER_MODEL_MAX_SAMPLES];
+  uint8_t count = 0;
+  float t = 0, next_sample = 0;
+  for (;;) {
+    if (t >= next_sample) {
+      samples[count++] = s.temperature;
+      next_sample += interval;
+      if (s.temperature >= plant->target || count >= HEATER_MODEL_MAX_SAMPLES) break;
+    }
+    plant_step(&s, plant->out_max);
+    t += PID_dT;
+  }
+  *seconds = t;
+
+  HeaterModel model;
+  if (!HeaterModel__Fit(samples, count, interval, plant->out_max, &model)) return false;
+  printf("  model: gain %.3f C/count, tau %.1f s, dead time %.2f s, rms %.3f C from %d samples\n",
+         model.gain, model.tau, model.dead_time, model.rms, model.used);
+  HeaterModel__Gains(&model, kp, ki, kd);
+  return true;
+}
+
+//===========================================================================
+//============================ Report =======================================
+//===========================================================================
+
+static void print(const char *label, const Response &r) {
+  printf("    %-6s overshoot %5.2f C  settling %6.1f s  error %6.3f C  %5.1f ns/update\n",
+         label, r.overshoot, r.settling, r.final_error, r.ns);
+}
+
+static bool compare(const Plant *plant, const char *gains, float kp, float ki, float kd) {
+  Response f = step_float(plant, kp, ki, kd), q = step_fixed(plant, kp, ki, kd);
+  printf("  %s: P %.2f I %.3f D %.2f\n", gains, kp, ki, kd);
+  print("float", f);
+  print("fixed", q);
+  bool ok = (f.settling < 0) == (q.settling < 0) &&
+            fabs(f.settling - q.settling) <= MAX_SETTLE_DIFF &&
+            fabs(f.overshoot - q.overshoot) <= MAX_OVERSHOOT_DIFF;
+  if (!ok) printf("  FAIL: fixed point differs from float\n");
+  return ok;
+}
+
+int main() {
+  bool ok = true;
+  for (size_t i = 0; i < COUNT(plants); i++) {
+    const Plant *plant = &plants[i];
+    printf("%s: gain %.2f C/count, tau %.0f s, dead time %.1f s, target %.0f C\n",
+           plant->name, plant->gain, plant->tau, plant->dead_time, plant->target);
+    ok &= compare(plant, "configured", plant->kp, plant->ki, plant->kd);
+    float kp, ki, kd, seconds;
+    if (autotune(plant, 8, &kp, &ki, &kd, &seconds)) {
+      printf("  relay autotune took %.0f s\n", seconds);
+      ok &= compare(plant, "relay", kp, ki, kd);
+    }
+    else
+      printf("  relay autotune did not finish\n");
+    if (model_autotune(plant, &kp, &ki, &kd, &seconds)) {
+      printf("  step autotune took %.0f s\n", seconds);
+      ok &= compare(plant, "step", kp, ki, kd);
+    }
+    else {
+      printf("  FAIL: step autotune found no model\n");
+      ok = false;
+    }
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+#include <vector>
+
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+void idle() {}
+
+#define MOVES 4000
+
+// What the stepper sees of a block, and the planner's own state of it
+struct PlannedBlock {
+	float entry_speed;
+	long accelerate_until, decelerate_after;
+	unsigned long initial_rate, final_rate;
+	unsigned short initial_interval;
+	unsigned char recalculate_flag;
+};
+
+typedef std::vector<PlannedBlock> Plan;
+
+class planner_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Firmware__ResetMotion();
+		Hardware__Reset();
+		lead = 0;
+	}
+
+	uint32_t random(uint32_t range)
+	{
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 8) % range;
+	}
+
+	// The stepper starts on the oldest block, or finishes it
+	void step()
+	{
+		if (!blocks_queued()) return;
+		if (block_buffer[block_buffer_tail].busy) plan_discard_current_block();
+		plan_get_current_block();
+	}
+
+	/**
+	 * Plans the same pseudo-random print, short curved segments, corners,
+	 * travel, Z hops and retracts, while the stepper takes blocks at varying
+	 * pace. Records the plan after every move.
+	 * @param full  Forget the final blocks before every move, so the passes
+	 *              start from the tail as they did before block_buffer_planned
+	 */
+	std::vector<Plan> run(bool full)
+	{
+		plan_init();
+		plan_set_position(0, 0, 0, 0);
+		seed = 1;
+		float x = 0, y = 0, z = 0, e = 0, heading = 0;
+		std::vector<Plan> plans;
+
+		for (int move = 0; move < MOVES; move++) {
+			uint32_t pace = random(16);
+			if (pace == 0)
+				while (blocks_queued()) step();  // Drained, as after a long move
+			else if (pace < 6 || movesplanned() >= BLOCK_BUFFER_SIZE - 1)
+				for (uint32_t i = random(3) + 1; i--;) step();
+
+			float feed_rate = 30;
+			uint32_t kind = random(40);
+			if (kind == 0) {
+				z += 0.2;
+				feed_rate = 5;
+			}
+			else if (kind == 1) {
+				e -= 1;
+				feed_rate = 25;
+			}
+			else if (kind < 4) {
+				x = random(200);
+				y = random(200);
+				feed_rate = 90;
+			}
+			else {
+				heading += (kind < 8 ? (random(180) - 90.0) : (random(11) - 5.0)) * M_PI / 180;
+				float length = 0.2 + random(40) / 20.0;
+				x += length * cos(heading);
+				y += length * sin(heading);
+				e += length * 0.05;
+				feed_rate = 20 + random(3) * 10;
+			}
+
+			if (full) block_buffer_planned = block_buffer_tail;
+			plan_buffer_line(x, y, z, e, feed_rate, 0);
+			NOLESS(lead, BLOCK_MOD(block_buffer_planned - block_buffer_tail + BLOCK_BUFFER_SIZE));
+
+			Plan plan;
+			for (uint8_t i = block_buffer_tail; i != block_buffer_head; i = BLOCK_MOD(i + 1)) {
+				block_t *block = &block_buffer[i];
+				PlannedBlock planned = { block->entry_speed, block->accelerate_until, block->decelerate_after,
+				                         block->initial_rate, block->final_rate, block->initial_interval,
+				                         block->recalculate_flag };
+				plan.push_back(planned);
+			}
+			plans.push_back(plan);
+		}
+		return plans;
+	}
+
+	uint32_t seed;
+	int lead;   // Most blocks ever final before the passes
+};
+
+TEST_F(planner_test, passes_from_the_planned_block_give_the_full_plan)
+{
+	std::vector<Plan> expected = run(true);
+	std::vector<Plan> actual = run(false);
+	EXPECT_GT(lead, BLOCK_BUFFER_SIZE / 4);
+
+	ASSERT_EQ(actual.size(), expected.size());
+	for (size_t move = 0; move < expected.size(); move++) {
+		ASSERT_EQ(actual[move].size(), expected[move].size()) << "move " << move;
+		for (size_t b = 0; b < expected[move].size(); b++) {
+			const PlannedBlock &want = expected[move][b], &got = actual[move][b];
+			// Exact, not near: the plan must not change at all
+			ASSERT_EQ(got.entry_speed, want.entry_speed) << "move " << move << " block " << b;
+			ASSERT_EQ(got.accelerate_until, want.accelerate_until) << "move " << move << " block " << b;
+			ASSERT_EQ(got.decelerate_after, want.decelerate_after) << "move " << move << " block " << b;
+			ASSERT_EQ(got.initial_rate, want.initial_rate) << "move " << move << " block " << b;
+			ASSERT_EQ(got.final_rate, want.final_rate) << "move " << move << " block " << b;
+			ASSERT_EQ(got.initial_interval, want.initial_interval) << "move " << move << " block " << b;
+			ASSERT_EQ(got.recalculate_flag, want.recalculate_flag) << "move " << move << " block " << b;
+		}
+	}
+}
+
+TEST_F(planner_test, planned_block_stays_between_tail_and_head)
+{
+	plan_init();
+	plan_set_position(0, 0, 0, 0);
+	for (int i = 1; i <= 20; i++) plan_buffer_line(i * 10, 0, 0, 0, 50, 0);
+	uint8_t planned = BLOCK_MOD(block_buffer_planned - block_buffer_tail + BLOCK_BUFFER_SIZE);
+	EXPECT_GT(planned, 0);
+	EXPECT_LT(planned, movesplanned());
+
+	// The stepper takes every block, and planning starts over from the new one
+	while (blocks_queued()) plan_discard_current_block();
+	plan_buffer_line(300, 0, 0, 0, 50, 0);
+	EXPECT_EQ(block_buffer_planned, block_buffer_tail);
+	EXPECT_EQ(movesplanned(), 1);
+}
@@ -0,0 +1,164 @@
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/temperature.h"
+#include "../../Marlin/PneumaticPump.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+//===========================================================================
+//====================== Firmware stand-ins (temperature) ===================
+//===========================================================================
+
+int target_value_pneumatic = 0;
+void idle() {}
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+/**
+ * The tank as PneumaticPump.h models it, with a pump that may deliver only
+ * part of the nominal flow.
+ */
+struct Tank {
+	float pressure;     // psi
+	float draw;         // psi/s
+	float flowFactor;
+
+	void step(float dt)
+	{
+		float fill = PUMP_FLOW * 14.7 / PNEUMATIC_TANK_VOLUME * (1 - pressure / PUMP_STALL_PSI);
+		float duty = Hardware__AnalogOut(PNEUMATIC_PUMP_PIN) / 255.0;
+		pressure += (duty * fill * flowFactor - draw) * dt;
+		if (pressure < 0) pressure = 0;
+	}
+
+	// The sensor reads in tenths of a psi
+	float reading() const { return (int)(pressure * 10) / 10.0; }
+};
+
+// Runs the tank in 10 ms steps with a new reading every 164 ms, as
+// manage_heater() gets them. Returns the lowest and highest pressures seen.
+static void run(Tank &tank, unsigned long ms, float *low = NULL, float *high = NULL)
+{
+	if (low) *low = tank.pressure;
+	if (high) *high = tank.pressure;
+	for (unsigned long t = 0; t < ms; t += 10) {
+		tank.step(0.01);
+		Hardware__AdvanceMs(10);
+		if (t % 164 == 0) PneumaticPump__Update(tank.reading());
+		if (low && tank.pressure < *low) *low = tank.pressure;
+		if (high && tank.pressure > *high) *high = tank.pressure;
+	}
+}
+
+class pneumatic_pump_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Firmware__ResetMotion();
+
+		Hardware__Reset();
+		plan_init();
+		set_regulator_setpoint(0);
+		target_value_pneumatic = 0;
+		// Settle the draw estimate of the previous test back to nothing
+		Tank idle_tank = { 0, 0, 1 };
+		run(idle_tank, 200000);
+	}
+};
+
+TEST_F(pneumatic_pump_test, holds_the_tank_without_a_sawtooth)
+{
+	setTargetPressure(30);
+	// The pump only gives 80% of its rated flow
+	Tank tank = { 30, 1.5, 0.8 };
+	run(tank, 60000);
+
+	float low, high;
+	run(tank, 30000, &low, &high);
+	EXPECT_GT(low, 30 - 1.0);
+	EXPECT_LT(high - low, 1.5);  // Bang-bang swung over 2 * PNEUMATIC_HYSTERESIS_PSI
+	EXPECT_GT(PneumaticPump__GetDuty(), 0);
+}
+
+TEST_F(pneumatic_pump_test, estimates_the_draw)
+{
+	setTargetPressure(30);
+	Tank tank = { 30, 2.0, 1 };
+	run(tank, 120000);
+	EXPECT_NEAR(PneumaticPump__GetDraw(), 2.0, 0.4);
+}
+
+TEST_F(pneumatic_pump_test, precharges_for_planned_setpoints)
+{
+	setTargetPressure(20);
+	Tank tank = { 20, 0.5, 1 };
+	run(tank, 10000);
+	EXPECT_FLOAT_EQ(PneumaticPump__GetDemand(), 20);
+
+	// A queued move needs 40 psi out of the regulator, the ones after it less
+	set_regulator_setpoint(40);
+	plan_buffer_line(10, 0, 0, 0, 50, 0);
+	set_regulator_setpoint(10);
+	plan_buffer_line(20, 0, 0, 0, 50, 0);
+	ASSERT_EQ(movesplanned(), 2);
+
+	run(tank, 10000);
+	float needed = 40 + PNEUMATIC_HYSTERESIS_PSI + PUMP_PRECHARGE_MARGIN;
+	EXPECT_FLOAT_EQ(PneumaticPump__GetDemand(), needed);
+	EXPECT_GT(tank.pressure, needed - 1.0);
+
+	// Once the moves are done the M125 target is held again, and the pump
+	// rests while the draw brings the tank down to it
+	plan_init();
+	set_regulator_setpoint(0);
+	run(tank, 1000);
+	EXPECT_FLOAT_EQ(PneumaticPump__GetDemand(), 20);
+	EXPECT_EQ(PneumaticPump__GetDuty(), 0);
+	run(tank, 60000);
+	EXPECT_NEAR(tank.pressure, 20, 1.0);
+}
+
+TEST_F(pneumatic_pump_test, demand_is_capped_below_the_pump_stall)
+{
+	setTargetPressure(20);
+	set_regulator_setpoint(PUMP_STALL_PSI);
+	Tank tank = { 20, 0, 1 };
+	run(tank, 1000);
+	EXPECT_FLOAT_EQ(PneumaticPump__GetDemand(), PUMP_MAX_TANK_PSI);
+}
+
+TEST_F(pneumatic_pump_test, max_output_falls_with_the_draw)
+{
+	EXPECT_FLOAT_EQ(PneumaticPump__GetMaxOutput(), PUMP_MAX_OUTPUT_PSI);
+
+	// Where the full fill rate meets a draw of 4 psi/s
+	setTargetPressure(30);
+	Tank tank = { 30, 4.0, 1 };
+	run(tank, 120000);
+	float full = PUMP_FLOW * 14.7 / PNEUMATIC_TANK_VOLUME;
+	float tank_max = PUMP_STALL_PSI * (1 - 4.0 / full);
+	EXPECT_NEAR(PneumaticPump__GetMaxOutput(), tank_max - PNEUMATIC_HYSTERESIS_PSI - PUMP_PRECHARGE_MARGIN, 4.0);
+	EXPECT_LT(PneumaticPump__GetMaxOutput(), PUMP_MAX_OUTPUT_PSI - 10);
+}
+
+TEST_F(pneumatic_pump_test, stops_without_a_target_or_below_the_stall_duty)
+{
+	Tank tank = { 10, 0, 1 };
+	set_regulator_setpoint(30);
+	run(tank, 5000);
+	EXPECT_EQ(PneumaticPump__GetDuty(), 0);
+
+	// Holding a tank with no draw needs less than the motor can turn at
+	set_regulator_setpoint(0);
+	setTargetPressure(10);
+	run(tank, 20000);
+	EXPECT_TRUE(PneumaticPump__GetDuty() == 0 || PneumaticPump__GetDuty() >= PUMP_MIN_DUTY);
+
+	PneumaticPump__Off();
+	EXPECT_EQ(Hardware__AnalogOut(PNEUMATIC_PUMP_PIN), 0);
+}
@@ -0,0 +1,142 @@
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+extern "C" void TIMER1_COMPA_vect(void);
+
+// Output latch of a pin, as WRITE() sets it
+#define PIN_OUTPUT(IO) _PIN_OUTPUT(IO)
+#define _PIN_OUTPUT(IO) TEST(DIO ## IO ## _WPORT, DIO ## IO ## _PIN)
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+// One Timer1 compare match
+static void tick()
+{
+	TCNT1 = 0;
+	TIMER1_COMPA_vect();
+	Hardware__AdvanceTicks(OCR1A);
+}
+
+void idle() { tick(); }
+
+// Runs the stepper ISR until the block at index starts
+static void run_until_block(uint8_t index)
+{
+	for (long i = 0; i < 1000000L && current_block != &block_buffer[index]; i++) tick();
+	ASSERT_EQ(current_block, &block_buffer[index]);
+}
+
+static void move_x(float x)
+{
+	plan_buffer_line(x, 0, 0, 0, 50, 0);
+}
+
+class pneumatics_sync_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Firmware__ResetMotion();
+
+		Hardware__Reset();
+		plan_init();
+		st_init();
+		enable_endstops(false);
+		#if ENABLED(PNEUMATICS)
+			solenoid_state = 0;
+		#endif
+		#if ENABLED(E_REGULATOR)
+			float psi;
+			set_regulator_setpoint(0);
+			tick();
+			st_regulator_setpoint_changed(psi);
+		#endif
+		tick();
+	}
+	virtual void TearDown()
+	{
+		while (blocks_queued()) tick();
+	}
+};
+
+#if ENABLED(PNEUMATICS) && HAS_SOLENOID_1
+
+TEST_F(pneumatics_sync_test, solenoid_switches_when_its_block_starts)
+{
+	move_x(10);
+	solenoid_state = BIT(1);
+	move_x(20);
+	solenoid_state = 0;
+	move_x(30);
+
+	run_until_block(0);
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+	run_until_block(1);
+	EXPECT_TRUE(PIN_OUTPUT(SOL1_PIN));
+	run_until_block(2);
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+}
+
+TEST_F(pneumatics_sync_test, solenoid_change_after_last_move_applies_when_drained)
+{
+	move_x(10);
+	solenoid_state = BIT(1);
+
+	run_until_block(0);
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+	while (blocks_queued()) tick();
+	tick();
+	EXPECT_TRUE(PIN_OUTPUT(SOL1_PIN));
+}
+
+TEST_F(pneumatics_sync_test, closing_on_error_keeps_queued_blocks_from_reopening)
+{
+	solenoid_state = BIT(1);
+	move_x(10);
+	move_x(20);
+	move_x(30);
+
+	run_until_block(0);
+	EXPECT_TRUE(PIN_OUTPUT(SOL1_PIN));
+	st_close_solenoids();
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+	EXPECT_EQ(solenoid_state, 0);
+
+	// The moves go on, closed
+	run_until_block(1);
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+	run_until_block(2);
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+	while (blocks_queued()) tick();
+	tick();
+	EXPECT_FALSE(PIN_OUTPUT(SOL1_PIN));
+}
+
+#endif // PNEUMATICS && HAS_SOLENOID_1
+
+#if ENABLED(E_REGULATOR)
+
+TEST_F(pneumatics_sync_test, regulator_setpoint_is_reported_once_its_block_starts)
+{
+	float psi;
+	EXPECT_FALSE(st_regulator_setpoint_changed(psi));
+
+	move_x(10);
+	set_regulator_setpoint(25);
+	move_x(20);
+
+	run_until_block(0);
+	EXPECT_FALSE(st_regulator_setpoint_changed(psi));
+	run_until_block(1);
+	ASSERT_TRUE(st_regulator_setpoint_changed(psi));
+	EXPECT_EQ(psi, 25);
+	EXPECT_FALSE(st_regulator_setpoint_changed(psi));
+}
+
+#endif // E_REGULATOR
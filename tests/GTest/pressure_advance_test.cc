@@ -0,0 +1,127 @@
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/PressureAdvance.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+extern "C" void TIMER1_COMPA_vect(void);
+extern volatile long count_position[NUM_AXIS];
+
+//===========================================================================
+//======================== Firmware stand-ins (Regulator) ===================
+//===========================================================================
+
+static float target_pressure;
+static float output_pressure;
+
+float Regulator__GetTargetPressure() { return target_pressure; }
+bool Regulator__AdvanceOutputPressure(float pressure) { output_pressure = pressure; return true; }
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+// One Timer1 compare match
+static void tick()
+{
+	TCNT1 = 0;
+	TIMER1_COMPA_vect();
+	Hardware__AdvanceTicks(OCR1A);
+}
+
+void idle() { tick(); }
+
+static float rate_now()
+{
+	block_t *block;
+	return st_rate_ahead(0, block);
+}
+
+class pressure_advance_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Firmware__ResetMotion();
+
+		// No Hardware__Reset(): PressureAdvance__Update() is scheduled on
+		// millis(), which must not run backwards between tests
+		plan_init();
+		st_init();
+		st_set_position(0, 0, 0, 0);
+		enable_endstops(false);
+		solenoid_state = 0;
+		tick();
+
+		target_pressure = 20;
+		output_pressure = 0;
+		PressureAdvance__SetLead(50);
+		PressureAdvance__SetGain(1);
+	}
+	virtual void TearDown()
+	{
+		while (blocks_queued()) tick();
+	}
+};
+
+TEST_F(pressure_advance_test, look_ahead_follows_the_trapezoid)
+{
+	block_t *block;
+	EXPECT_EQ(st_rate_ahead(0, block), 0);
+	EXPECT_EQ(block, (block_t *)NULL);
+
+	plan_buffer_line(50, 0, 0, 0, 100, 0);
+	tick();
+	ASSERT_EQ(current_block, &block_buffer[0]);
+
+	// Accelerating from the start
+	float rate = st_rate_ahead(0.01, block);
+	EXPECT_EQ(block, &block_buffer[0]);
+	EXPECT_NEAR(rate, block->initial_rate + block->acceleration_st * 0.01, block->nominal_rate * 0.02);
+
+	// Past the end of the buffer the head stands still
+	EXPECT_EQ(st_rate_ahead(10, block), 0);
+	EXPECT_EQ(block, &block_buffer[0]);
+
+	// Cruising halfway
+	while (count_position[X_AXIS] < 25 * axis_steps_per_unit[X_AXIS]) tick();
+	EXPECT_NEAR(rate_now(), block_buffer[0].nominal_rate, 1);
+}
+
+TEST_F(pressure_advance_test, pressure_drops_ahead_of_a_corner)
+{
+	solenoid_state = BIT(1);
+	plan_buffer_line(40, 0, 0, 0, 100, 0);
+	plan_buffer_line(40, 40, 0, 0, 100, 0);
+	tick();
+	ASSERT_EQ(current_block, &block_buffer[0]);
+	const float nominal = block_buffer[0].nominal_rate;
+
+	// While cruising far from the corner the setpoint is used as is
+	while (count_position[X_AXIS] < 10 * axis_steps_per_unit[X_AXIS]) tick();
+	PressureAdvance__Update();
+	EXPECT_NEAR(output_pressure, target_pressure, 0.01);
+
+	// The pressure comes down while the head is still at full speed
+	bool led = false;
+	while (current_block == &block_buffer[0]) {
+		tick();
+		PressureAdvance__Update();
+		if (rate_now() >= nominal - 1 && output_pressure < target_pressure * 0.9) led = true;
+	}
+	EXPECT_TRUE(led);
+	EXPECT_LT(output_pressure, target_pressure);
+}
+
+TEST_F(pressure_advance_test, travel_keeps_the_setpoint)
+{
+	plan_buffer_line(40, 0, 0, 0, 100, 0);
+	tick();
+	while (current_block) {
+		tick();
+		PressureAdvance__Update();
+		EXPECT_NEAR(output_pressure, target_pressure, 0.01);
+	}
+}
@@ -0,0 +1,118 @@
+#include <math.h>
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/PressureSensor.h"
+
+void idle() {}
+
+// The shapes of the tables in thermistortables.h
+static const short single_slope[][2] PROGMEM = {
+	{0*OVERSAMPLENR,       2},
+	{1023*OVERSAMPLENR, 1500},
+};
+static const short dead_band[][2] PROGMEM = {
+	{0*OVERSAMPLENR,       0},
+	{201*OVERSAMPLENR,     0},
+	{1023*OVERSAMPLENR, 1000},
+};
+static const short many_points[][2] PROGMEM = {
+	{0*OVERSAMPLENR,       0},
+	{206*OVERSAMPLENR,     0},
+	{237*OVERSAMPLENR,    50},
+	{268*OVERSAMPLENR,   100},
+	{299*OVERSAMPLENR,   150},
+	{330*OVERSAMPLENR,   200},
+	{361*OVERSAMPLENR,   250},
+	{392*OVERSAMPLENR,   300},
+	{422*OVERSAMPLENR,   350},
+	{454*OVERSAMPLENR,   400},
+	{1023*OVERSAMPLENR, 1305},
+};
+
+// The linear scan temperature.cpp used before
+static float scan(const short (*table)[2], uint8_t length, int raw)
+{
+	float psi = 0;
+	uint8_t i;
+	for (i = 1; i < length; i++) {
+		if (table[i][0] > raw) {
+			psi = table[i-1][1] + (raw - table[i-1][0]) *
+				(float)(table[i][1] - table[i-1][1]) / (float)(table[i][0] - table[i-1][0]);
+			break;
+		}
+	}
+	if (i == length) psi = table[i-1][1];
+	return psi;
+}
+
+static void expect_same_as_scan(const short (*table)[2], uint8_t length)
+{
+	PressureSegment segments[16];
+	PressureSensor__BuildSegments(table, length, segments);
+	for (int raw = 0; raw <= 16383; raw++) {
+		float expected = scan(table, length, raw);
+		ASSERT_NEAR(PressureSensor__Convert(segments, length, raw), expected,
+		            1e-4 * (1 + fabs(expected))) << "raw " << raw;
+	}
+}
+
+class pressure_sensor_test : public ::testing::Test {};
+
+TEST_F(pressure_sensor_test, conversion_matches_the_table_scan)
+{
+	expect_same_as_scan(single_slope, COUNT(single_slope));
+	expect_same_as_scan(dead_band, COUNT(dead_band));
+	expect_same_as_scan(many_points, COUNT(many_points));
+}
+
+TEST_F(pressure_sensor_test, iir_follows_a_step_and_starts_at_the_first_sum)
+{
+	PressureFilter filter = {};
+	EXPECT_EQ(PressureSensor__Filter(&filter, PRESSURE_FILTER_IIR, 4000), 4000);
+
+	int value = 0;
+	for (int i = 0; i < 3; i++) value = PressureSensor__Filter(&filter, PRESSURE_FILTER_IIR, 8000);
+	EXPECT_GT(value, 4000);
+	EXPECT_LT(value, 8000);
+	for (int i = 0; i < 60; i++) value = PressureSensor__Filter(&filter, PRESSURE_FILTER_IIR, 8000);
+	EXPECT_NEAR(value, 8000, 1 << PRESSURE_IIR_SHIFT);
+}
+
+TEST_F(pressure_sensor_test, median_drops_a_spike)
+{
+	PressureFilter filter = {};
+	PressureSensor__Filter(&filter, PRESSURE_FILTER_MEDIAN, 5000);
+	PressureSensor__Filter(&filter, PRESSURE_FILTER_MEDIAN, 5010);
+	EXPECT_LE(PressureSensor__Filter(&filter, PRESSURE_FILTER_MEDIAN, 16000), 5010);
+	for (int i = 0; i < PRESSURE_MEDIAN_LEN; i++)
+		PressureSensor__Filter(&filter, PRESSURE_FILTER_MEDIAN, 7000);
+	EXPECT_EQ(PressureSensor__Filter(&filter, PRESSURE_FILTER_MEDIAN, 7000), 7000);
+}
+
+TEST_F(pressure_sensor_test, no_filter_passes_through)
+{
+	PressureFilter filter = {};
+	EXPECT_EQ(PressureSensor__Filter(&filter, PRESSURE_FILTER_NONE, 123), 123);
+	EXPECT_EQ(PressureSensor__Filter(&filter, PRESSURE_FILTER_NONE, 9876), 9876);
+}
+
+TEST_F(pressure_sensor_test, statistics)
+{
+	PressureStats stats;
+	PressureSensor__StatsReset(&stats);
+	EXPECT_EQ(PressureSensor__StatsStdDev(&stats), 0);
+
+	const float values[] = { 30.2, 29.8, 30.0, 30.4, 29.6 };
+	for (size_t i = 0; i < COUNT(values); i++) PressureSensor__StatsAdd(&stats, values[i]);
+	EXPECT_EQ(stats.count, 5);
+	EXPECT_FLOAT_EQ(stats.min, 29.6);
+	EXPECT_FLOAT_EQ(stats.max, 30.4);
+	EXPECT_NEAR(stats.mean, 30.0, 1e-5);
+	EXPECT_NEAR(PressureSensor__StatsStdDev(&stats), sqrt(0.4 / 4), 1e-5);
+
+	PressureSensor__StatsReset(&stats);
+	PressureSensor__StatsAdd(&stats, 12);
+	EXPECT_EQ(stats.count, 1);
+	EXPECT_FLOAT_EQ(stats.min, 12);
+	EXPECT_FLOAT_EQ(stats.max, 12);
+}
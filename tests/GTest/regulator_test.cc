@@ -0,0 +1,170 @@
+#include <math.h>
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/TwiQueue.h"
+#include "../../Marlin/MCP4725.h"
+#include "../../Marlin/Regulator.h"
+#include "../../Marlin/temperature.h"
+#include "mocks/hardware.h"
+
+//===========================================================================
+//====================== Firmware stand-ins (temperature) ===================
+//===========================================================================
+
+float current_regulator = 0;
+float current_pneumatic = 0;
+void disable_all_heaters() {}
+void idle() {}
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+/**
+ * A regulator that does not match the nominal conversion: its own counts
+ * per psi and zero offset, a first order lag, and a ceiling set by the tank.
+ */
+struct Plant {
+	float bitsPerPsi;
+	float offset;      // psi
+	float tau;         // s
+	float ceiling;     // psi
+	float pressure;    // psi
+
+	uint16_t dac(const MockTwiDevice &device) const
+	{
+		size_t n = device.written.size();
+		if (n < 3) return 0;
+		return ((uint8_t)device.written[n - 2] << 4) | ((uint8_t)device.written[n - 1] >> 4);
+	}
+
+	void step(const MockTwiDevice &device, float dt)
+	{
+		float goal = dac(device) ? dac(device) / bitsPerPsi + offset : 0;
+		goal = constrain(goal, 0, ceiling);
+		pressure += (goal - pressure) * dt / (tau + dt);
+	}
+};
+
+class regulator_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		TwiQueue__Init();
+		Hardware__TwiAttach(MCP4725_I2C_ADDRESS, &device);
+		Regulator__SetPressureProtections(false);
+		current_pneumatic = 60 * 10;  // Plenty in the tank
+		Regulator__SetOutputPressure(0);
+		current_regulator = 0;
+		Hardware__AdvanceMs(REGULATOR_CHECK_INTERVAL);
+		Regulator__Control(0);
+	}
+
+	// Runs the plant in 10 ms steps, and the loop as manage_heater() does
+	void run(Plant &plant, unsigned long ms)
+	{
+		for (unsigned long t = 0; t < ms; t += 10) {
+			plant.step(device, 0.01);
+			Hardware__AdvanceMs(10);
+			current_regulator = plant.pressure * 10;
+			if ((t + 10) % REGULATOR_CHECK_INTERVAL == 0)
+				Regulator__Control(pressureRegulator());
+		}
+	}
+
+	MockTwiDevice device;
+};
+
+TEST_F(regulator_test, tracks_the_setpoint_on_mismatched_units)
+{
+	const Plant units[] = {
+		{ 43.0, 0.0, 0.3, 100, 0 },  // The unit BITS_PER_PSI was tuned on
+		{ 38.0, 0.5, 0.5, 100, 0 },
+		{ 46.0, -0.8, 0.2, 100, 0 },
+	};
+	for (size_t i = 0; i < sizeof(units) / sizeof(units[0]); i++) {
+		SetUp();
+		Plant plant = units[i];
+		Regulator__SetOutputPressure(20);
+		run(plant, 20000);
+		EXPECT_NEAR(plant.pressure, 20, REGULATOR_SETTLE_BAND) << "unit " << i;
+		EXPECT_GE(Regulator__GetSettlingTime(), 0) << "unit " << i;
+		EXPECT_LT(Regulator__GetSettlingTime(), 10000) << "unit " << i;
+		EXPECT_LT(fabs(Regulator__GetSteadyStateError()), 0.1) << "unit " << i;
+	}
+}
+
+TEST_F(regulator_test, settling_restarts_on_a_new_target)
+{
+	Plant plant = { 38.0, 0.5, 0.5, 100, 0 };
+	Regulator__SetOutputPressure(20);
+	run(plant, 20000);
+	ASSERT_GE(Regulator__GetSettlingTime(), 0);
+
+	Regulator__SetOutputPressure(30);
+	EXPECT_EQ(Regulator__GetSettlingTime(), -1);
+	run(plant, 20000);
+	EXPECT_NEAR(plant.pressure, 30, REGULATOR_SETTLE_BAND);
+	EXPECT_GE(Regulator__GetSettlingTime(), 0);
+}
+
+TEST_F(regulator_test, integral_holds_while_short_of_pressure)
+{
+	// The tank cannot reach the target for a long time
+	Plant plant = { 40.92, 0.0, 0.3, 25, 0 };
+	current_pneumatic = 25 * 10;
+	Regulator__SetOutputPressure(35);
+	run(plant, 120000);
+	EXPECT_EQ(Regulator__GetSettlingTime(), -1);
+
+	// A reachable target is then met without first unwinding a huge integral
+	Regulator__SetOutputPressure(15);
+	run(plant, 3000);
+	EXPECT_NEAR(plant.pressure, 15, 0.5);
+}
+
+TEST_F(regulator_test, the_same_advanced_pressure_is_not_written_again)
+{
+	Plant plant = { 38.0, 0.5, 0.5, 100, 0 };
+	Regulator__SetOutputPressure(20);
+	run(plant, 1000);
+
+	Regulator__AdvanceOutputPressure(26);
+	size_t written = device.written.size();
+	Regulator__AdvanceOutputPressure(26);
+	run(plant, 10);
+	EXPECT_EQ(device.written.size(), written);
+}
+
+TEST_F(regulator_test, pressure_advance_leaves_the_trim_alone)
+{
+	Plant plant = { 38.0, 0.5, 0.5, 100, 0 };
+	Regulator__SetOutputPressure(20);
+	run(plant, 20000);
+	uint16_t settled = plant.dac(device);
+
+	// Led up for a while, through several control steps, and back
+	Regulator__AdvanceOutputPressure(26);
+	EXPECT_GT(plant.dac(device), settled);
+	run(plant, 5000);
+	Regulator__AdvanceOutputPressure(20);
+	EXPECT_EQ(plant.dac(device), settled);
+}
+
+TEST_F(regulator_test, venting_writes_zero_and_clears_the_trim)
+{
+	Plant plant = { 38.0, 0.5, 0.5, 100, 0 };
+	Regulator__SetOutputPressure(20);
+	run(plant, 20000);
+
+	Regulator__SetOutputPressure(0);
+	EXPECT_EQ(plant.dac(device), 0);
+	run(plant, 5000);
+	EXPECT_EQ(plant.dac(device), 0);
+
+	// Restarting applies the nominal conversion, with no trim left over
+	Regulator__SetOutputPressure(10);
+	EXPECT_EQ(plant.dac(device), (uint16_t)(10 * BITS_PER_PSI));
+}
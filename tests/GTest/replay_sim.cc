@@ -0,0 +1,427 @@
+/**
+ * replay_sim.cc - Host-native replay of a G-code file through the whole
+ * firmware: MarlinSerial RX, get_command(), process_next_command() and the
+ * planner, with the stepper interrupt draining the buffer.
+ *
+ * A simulated host streams the file into the USART0 model at the chosen baud
+ * rate, one byte per ten bit times, and reads the firmware's replies back.
+ * Marlin's own setup() and loop() run unmodified; the clock hook of the mock
+ * hardware charges a fixed amount of virtual CPU time each time the firmware
+ * polls millis() (every pass of loop() and idle() does), delivers the bytes
+ * and Timer1 compare matches that fall due and lets the host react to "ok".
+ *
+ * The host either waits for each "ok" before sending the next line
+ * (ping-pong, as Printrun and mecode do) or keeps up to --window bytes of
+ * unacknowledged lines in flight (character counting). With --checksum every
+ * line is sent as "N<n> ... *<checksum>", which the firmware has to verify.
+ * With --batched the host first turns on batched acks with M256 S1 and then
+ * keeps RX_BUFFER_SIZE - 1 bytes (or --window) past the line the last
+ * "ok N<n>" acknowledged in flight; numbered lines are implied. --latency-us
+ * holds each reply back from the host that long, as a USB round trip does.
+ *
+ * Reports:
+ *   - commands per second of virtual time
+ *   - planner occupancy (movesplanned()) sampled every millisecond, as a
+ *     histogram and optionally as a CSV timeline
+ *   - starvation events: the planner ran dry while lines were still to come
+ *   - bytes dropped because the RX ring was full
+ *   - ok latency: from the last byte of a line reaching the UART to the host
+ *     reading the "ok" that covers it. Replies leave the mock UART instantly.
+ *
+ * Usage: replay_sim <file.gcode> [--baud N] [--window BYTES] [--checksum]
+ *                   [--batched] [--latency-us N] [--poll-us N] [--csv occupancy.csv]
+ *
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/temperature.h"
+#include "mocks/hardware.h"
+
+extern "C" void TIMER1_COMPA_vect(void);
+
+void setup();
+void loop();
+
+//===========================================================================
+//=============================== Definitions ===============================
+//===========================================================================
+
+#define TICKS_PER_MS (HARDWARE_TICKS_PER_SECOND / 1000)
+#define NEVER ((uint64_t)-1)
+#define STALL_LIMIT_MS 60000UL // No "ok" for this long ends the replay
+#define OCCUPANCY_BUCKET (BLOCK_BUFFER_SIZE / 8)
+
+// An open switch reads as its INVERTING level, as through the pull-ups
+#define _ENDSTOP_OPEN(IO, INVERTING) do{ \
+    if (INVERTING) DIO ## IO ## _RPORT |= MASK(DIO ## IO ## _PIN); \
+    else DIO ## IO ## _RPORT &= ~MASK(DIO ## IO ## _PIN); \
+  }while(0)
+#define ENDSTOP_OPEN(IO, INVERTING) _ENDSTOP_OPEN(IO, INVERTING)
+
+struct Line {
+  std::string text;
+  unsigned long number; // Line number, counting from 1
+  uint64_t sent_tick;   // Last byte reached the UART, NEVER while in flight
+};
+
+struct Reply {
+  std::string text;
+  uint64_t due_tick;    // When the host sees it
+};
+
+//===========================================================================
+//============================ Private Variables ============================
+//===========================================================================
+
+// Options
+static unsigned long baudrate = BAUDRATE;
+static size_t window = 0;
+static bool checksum = false;
+static bool batched = false;
+static uint64_t latency_ticks = 0;
+static uint64_t poll_ticks = 20 * (HARDWARE_TICKS_PER_SECOND / 1000000);
+static std::ofstream occupancy_csv;
+
+// Host side of the link
+static std::vector<std::string> lines;
+static size_t next_line = 0;
+static std::deque<Line> in_flight;     // Sent or sending, not acknowledged
+static size_t bytes_in_flight = 0;
+static std::deque<char> wire;          // Bytes not yet on the UART
+static uint64_t byte_ticks;
+static uint64_t next_byte_tick = NEVER;
+static std::string reply;
+static std::deque<Reply> replies;      // Lines on their way to the host
+static unsigned long acknowledged = 0;
+static bool batched_on = false;        // M256 S1 acknowledged
+static unsigned long errors = 0;
+static uint64_t last_ok_tick = 0;
+
+// Timer1
+static bool timer1_running = false;
+static uint64_t timer1_due = NEVER;
+
+// Measurements
+static std::vector<uint64_t> ok_latency;
+static unsigned long occupancy_histogram[BLOCK_BUFFER_SIZE];
+static uint64_t next_sample_tick = 0;
+static bool planner_busy = false;
+static bool moves_started = false;
+static unsigned long starvation_events = 0;
+static uint64_t starved_since = 0;
+static uint64_t starved_ticks = 0;
+static std::chrono::steady_clock::time_point host_start;
+
+//===========================================================================
+//======================== Private Functions Prototypes =====================
+//===========================================================================
+
+static void _clock_hook();
+static void _deliver_byte();
+static void _read_replies();
+static void _acknowledge();
+static void _send_lines();
+static void _sample();
+static bool _finished();
+static std::string _frame(const std::string& text, unsigned long number);
+static void _report();
+
+//===========================================================================
+//================================== Main ===================================
+//===========================================================================
+
+static bool _load(const char *path) {
+  std::ifstream gcode(path);
+  if (!gcode) return false;
+  std::string text;
+  if (batched) lines.push_back(_frame("M256 S1", 1));
+  while (std::getline(gcode, text)) {
+    // Strip what a host would strip: comments, blank lines, line endings
+    text = text.substr(0, text.find(';'));
+    text.erase(text.find_last_not_of(" \t\r") + 1);
+    text.erase(0, text.find_first_not_of(" \t"));
+    if (text.empty()) continue;
+    lines.push_back(checksum ? _frame(text, lines.size() + 1) : text);
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char *path = NULL;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (arg == "--baud" && has_value) baudrate = strtoul(argv[++i], NULL, 10);
+    else if (arg == "--window" && has_value) window = strtoul(argv[++i], NULL, 10);
+    else if (arg == "--checksum") checksum = true;
+    else if (arg == "--batched") batched = checksum = true;
+    else if (arg == "--latency-us" && has_value) latency_ticks = strtoul(argv[++i], NULL, 10) * (HARDWARE_TICKS_PER_SECOND / 1000000);
+    else if (arg == "--poll-us" && has_value) poll_ticks = strtoul(argv[++i], NULL, 10) * (HARDWARE_TICKS_PER_SECOND / 1000000);
+    else if (arg == "--csv" && has_value) occupancy_csv.open(argv[++i]);
+    else if (!path && arg[0] != '-') path = argv[i];
+    else path = NULL, i = argc;
+  }
+  if (!path || !baudrate || !poll_ticks) {
+    std::cerr << "Usage: " << argv[0] << " <file.gcode> [--baud N] [--window BYTES] [--checksum]"
+              << " [--batched] [--latency-us N] [--poll-us N] [--csv occupancy.csv]" << std::endl;
+    return 1;
+  }
+  if (!_load(path)) {
+    std::cerr << "Cannot open " << path << std::endl;
+    return 1;
+  }
+  if (batched && !window) window = RX_BUFFER_SIZE - 1;
+  if (occupancy_csv.is_open()) occupancy_csv << "ms,blocks" << std::endl;
+  byte_ticks = 10 * HARDWARE_TICKS_PER_SECOND / baudrate; // Start, 8 data and stop bit
+
+  Hardware__Reset();
+  #if HAS_X_MIN
+    ENDSTOP_OPEN(X_MIN_PIN, X_MIN_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_Y_MIN
+    ENDSTOP_OPEN(Y_MIN_PIN, Y_MIN_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_Z_MIN
+    ENDSTOP_OPEN(Z_MIN_PIN, Z_MIN_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_X_MAX
+    ENDSTOP_OPEN(X_MAX_PIN, X_MAX_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_Y_MAX
+    ENDSTOP_OPEN(Y_MAX_PIN, Y_MAX_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_Z_MAX
+    ENDSTOP_OPEN(Z_MAX_PIN, Z_MAX_ENDSTOP_INVERTING);
+  #endif
+  #if HAS_Z_PROBE
+    ENDSTOP_OPEN(Z_MIN_PROBE_PIN, Z_MIN_PROBE_ENDSTOP_INVERTING);
+  #endif
+  #if ENABLED(CURRENT_LIMIT)
+    Hardware__AnalogIn(PS_MONITOR_PIN, (PS_ENABLE_LOWER_LIMIT + PS_ENABLE_UPPER_LIMIT) / 2); // No short on 24V
+  #endif
+  setup();
+  Hardware__SerialTake(); // Start banner
+  // No temperature ISR runs on the host: hotends hot enough to extrude, bed present
+  for (uint8_t e = 0; e < EXTRUDERS; e++) current_temperature[e] = 250;
+  current_temperature_bed = 60;
+  Hardware__SetClockHook(_clock_hook);
+
+  host_start = std::chrono::steady_clock::now();
+  while (!_finished()) {
+    loop();
+    _clock_hook();
+  }
+  Hardware__SetClockHook(NULL);
+
+  _report();
+  return errors ? 1 : 0;
+}
+
+//===========================================================================
+//============================ Private Functions ============================
+//===========================================================================
+
+/**
+ * One slice of virtual CPU time: runs every byte arrival and Timer1 compare
+ * match that falls within it, in order, then answers the firmware.
+ */
+static void _clock_hook() {
+  uint64_t end = Hardware__Ticks() + poll_ticks;
+
+  for (;;) {
+    // Timer1 starts counting when the stepper interrupt is enabled
+    bool enabled = TEST(TIMSK1, OCIE1A);
+    if (enabled && !timer1_running) timer1_due = Hardware__Ticks() + OCR1A;
+    timer1_running = enabled;
+
+    uint64_t next = min(timer1_running ? timer1_due : NEVER, next_byte_tick);
+    if (next > end) break;
+    if (next > Hardware__Ticks()) Hardware__AdvanceTicks(next - Hardware__Ticks());
+
+    if (timer1_running && next == timer1_due) {
+      TCNT1 = 0;
+      TIMER1_COMPA_vect();
+      timer1_due = Hardware__Ticks() + max((uint16_t)1, (uint16_t)OCR1A);
+    }
+    else
+      _deliver_byte();
+
+    _sample();
+  }
+  Hardware__AdvanceTicks(end - Hardware__Ticks());
+
+  _read_replies();
+  _send_lines();
+  _sample();
+
+  // The firmware may be stuck in a wait loop, so give up from here
+  if ((Hardware__Ticks() - last_ok_tick) / TICKS_PER_MS > STALL_LIMIT_MS) {
+    std::cout << "No ok for " << STALL_LIMIT_MS / 1000 << " s, giving up" << std::endl;
+    _report();
+    exit(1);
+  }
+}
+
+static void _deliver_byte() {
+  char c = wire.front();
+  wire.pop_front();
+  Hardware__SerialInject(&c, 1);
+  Hardware__SerialPoll();
+  if (c == '\n') {
+    for (std::deque<Line>::iterator it = in_flight.begin(); it != in_flight.end(); ++it)
+      if (it->sent_tick == NEVER) {
+        it->sent_tick = Hardware__Ticks();
+        break;
+      }
+  }
+  next_byte_tick = wire.empty() ? NEVER : Hardware__Ticks() + byte_ticks;
+}
+
+static void _read_replies() {
+  reply += Hardware__SerialTake();
+  size_t end;
+  while ((end = reply.find('\n')) != std::string::npos) {
+    Reply line = { reply.substr(0, end), Hardware__Ticks() + latency_ticks };
+    replies.push_back(line);
+    reply.erase(0, end + 1);
+  }
+
+  while (!replies.empty() && replies.front().due_tick <= Hardware__Ticks()) {
+    std::string text = replies.front().text;
+    replies.pop_front();
+    if (text.compare(0, 2, "ok") == 0) {
+      size_t n = text.find(" N");
+      if (batched_on) {
+        // One ok covers every line up to N. M105's "ok T:" has no N.
+        if (n == std::string::npos) continue;
+        unsigned long number = strtoul(text.c_str() + n + 2, NULL, 10);
+        while (!in_flight.empty() && in_flight.front().number <= number) _acknowledge();
+        continue;
+      }
+      if (in_flight.empty()) continue; // Not ours, e.g. after a resend
+      _acknowledge();
+      batched_on = batched;
+    }
+    else if (text.compare(0, 5, "Error") == 0 || text.compare(0, 6, "Resend") == 0) {
+      if (errors++ < 10) std::cerr << "Firmware: " << text << std::endl;
+    }
+  }
+}
+
+static void _acknowledge() {
+  const Line& line = in_flight.front();
+  if (line.sent_tick != NEVER) ok_latency.push_back(Hardware__Ticks() - line.sent_tick);
+  bytes_in_flight -= line.text.size() + 1;
+  in_flight.pop_front();
+  acknowledged++;
+  last_ok_tick = Hardware__Ticks();
+}
+
+static void _send_lines() {
+  while (next_line < lines.size()) {
+    const std::string& text = lines[next_line];
+    // Batched acks start once M256 S1 is acknowledged
+    if (window && (!batched || batched_on) ? bytes_in_flight + text.size() + 1 > window && !in_flight.empty()
+                                           : !in_flight.empty()) break;
+    Line line = { text, next_line + 1, NEVER };
+    in_flight.push_back(line);
+    bytes_in_flight += text.size() + 1;
+    wire.insert(wire.end(), text.begin(), text.end());
+    wire.push_back('\n');
+    if (next_byte_tick == NEVER) next_byte_tick = Hardware__Ticks() + byte_ticks;
+    next_line++;
+  }
+}
+
+/**
+ * Samples the planner once per millisecond and watches it run dry
+ */
+static void _sample() {
+  bool busy = blocks_queued();
+  if (busy) moves_started = true;
+  if (planner_busy && !busy && !_finished()) {
+    starvation_events++;
+    starved_since = Hardware__Ticks();
+  }
+  if (!planner_busy && busy && starved_since) {
+    starved_ticks += Hardware__Ticks() - starved_since;
+    starved_since = 0;
+  }
+  planner_busy = busy;
+
+  while (moves_started && Hardware__Ticks() >= next_sample_tick) {
+    uint8_t blocks = movesplanned();
+    occupancy_histogram[blocks]++;
+    if (occupancy_csv.is_open()) occupancy_csv << next_sample_tick / TICKS_PER_MS << ',' << (int)blocks << '\n';
+    next_sample_tick += TICKS_PER_MS;
+  }
+  if (!moves_started) next_sample_tick = Hardware__Ticks();
+}
+
+static bool _finished() {
+  return acknowledged == lines.size() && !blocks_queued();
+}
+
+static std::string _frame(const std::string& text, unsigned long number) {
+  std::string framed = "N" + std::to_string(number) + " " + text;
+  uint8_t sum = 0;
+  for (size_t i = 0; i < framed.size(); i++) sum ^= (uint8_t)framed[i];
+  return framed + "*" + std::to_string(sum);
+}
+
+static void _report() {
+  double host_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - host_start).count();
+  double seconds = Hardware__Ticks() / (double)HARDWARE_TICKS_PER_SECOND;
+  std::cout << "Link: " << baudrate << " baud, "
+            << (window ? "window of " + std::to_string(window) + " bytes" : std::string("ping-pong"))
+            << (checksum ? ", line numbers and checksums" : "")
+            << (batched ? ", batched ok" : "")
+            << (latency_ticks ? ", " + std::to_string(latency_ticks * 1000000 / HARDWARE_TICKS_PER_SECOND) + " us round trip" : "")
+            << std::endl;
+  std::cout << "Virtual time: " << seconds << " s (" << host_seconds << " s on the host)" << std::endl;
+  std::cout << "Commands: " << acknowledged << " of " << lines.size() << " acknowledged, "
+            << acknowledged / seconds << " per second" << std::endl;
+  if (errors) std::cout << "Errors and resends: " << errors << std::endl;
+  if (MYSERIAL.rxOverflows()) std::cout << "RX overflows: " << MYSERIAL.rxOverflows() << " bytes dropped" << std::endl;
+
+  if (!ok_latency.empty()) {
+    std::sort(ok_latency.begin(), ok_latency.end());
+    double sum = 0;
+    for (size_t i = 0; i < ok_latency.size(); i++) sum += ok_latency[i];
+    double us_per_tick = 1e6 / HARDWARE_TICKS_PER_SECOND;
+    std::cout << "ok latency (us): mean " << sum / ok_latency.size() * us_per_tick
+              << ", median " << ok_latency[ok_latency.size() / 2] * us_per_tick
+              << ", 99th " << ok_latency[ok_latency.size() * 99 / 100] * us_per_tick
+              << ", max " << ok_latency.back() * us_per_tick << std::endl;
+  }
+
+  std::cout << "Starvation: " << starvation_events << " times the planner ran dry, "
+            << starved_ticks / (double)HARDWARE_TICKS_PER_SECOND << " s idle before the end" << std::endl;
+
+  unsigned long samples = 0;
+  double blocks = 0;
+  for (uint8_t i = 0; i < BLOCK_BUFFER_SIZE; i++) {
+    samples += occupancy_histogram[i];
+    blocks += (double)i * occupancy_histogram[i];
+  }
+  if (samples) {
+    std::cout << "Planner occupancy (blocks, " << samples << " ms sampled, mean " << blocks / samples << "):" << std::endl;
+    for (uint8_t low = 0; low < BLOCK_BUFFER_SIZE; low += OCCUPANCY_BUCKET) {
+      unsigned long count = 0;
+      for (uint8_t i = low; i < low + OCCUPANCY_BUCKET; i++) count += occupancy_histogram[i];
+      std::cout << "  " << (int)low << "-" << low + OCCUPANCY_BUCKET - 1 << ": "
+                << 100.0 * count / samples << "%" << std::endl;
+    }
+  }
+}
@@ -0,0 +1,140 @@
+#include <math.h>
+
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/SegmentMerge.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+void idle() {}
+
+class segment_merge_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Firmware__ResetMotion();
+
+		Hardware__Reset();
+		SegmentMerge__Discard();
+		plan_init();
+		for (uint8_t i = 0; i < NUM_AXIS; i++) position[i] = 0;
+		plan_set_position(0, 0, 0, 0);
+	}
+
+	// Fills the planner far enough for moves to be held back
+	void prime()
+	{
+		for (int i = 1; i < SEGMENT_MERGE_MIN_BLOCKS; i++) line(i * 10, 0, 0);
+		line(0, 0, 0);
+		queued = movesplanned();
+	}
+
+	void line(float x, float y, float e)
+	{
+		float target[NUM_AXIS] = { x, y, position[Z_AXIS], e };
+		SegmentMerge__Line(position, target, 50, 0);
+		memcpy(position, target, sizeof(position));
+	}
+
+	// Blocks planned since prime()
+	int planned()
+	{
+		return movesplanned() - queued;
+	}
+
+	block_t *last_block()
+	{
+		return &block_buffer[BLOCK_MOD(block_buffer_head - 1 + BLOCK_BUFFER_SIZE)];
+	}
+
+	float position[NUM_AXIS];
+	int queued;
+};
+
+TEST_F(segment_merge_test, collinear_moves_become_one_block)
+{
+	prime();
+	for (int i = 1; i <= SEGMENT_MERGE_MAX_POINTS; i++) line(i * 0.5, i * 0.25, i * 0.01);
+	EXPECT_EQ(planned(), 0);
+	EXPECT_EQ(SegmentMerge__Held(), SEGMENT_MERGE_MAX_POINTS);
+
+	SegmentMerge__Flush();
+	ASSERT_EQ(planned(), 1);
+	EXPECT_NEAR(last_block()->millimeters, hypot(4, 2), 0.01);
+	EXPECT_EQ(SegmentMerge__Held(), 0);
+
+	// A full run starts a new block
+	for (int i = 1; i <= SEGMENT_MERGE_MAX_POINTS + 1; i++) line(4 + i * 0.5, 2 + i * 0.25, 0.08 + i * 0.01);
+	EXPECT_EQ(planned(), 2);
+	EXPECT_EQ(SegmentMerge__Held(), 1);
+}
+
+TEST_F(segment_merge_test, corners_and_chord_error_split_the_run)
+{
+	prime();
+	line(1, 0, 0);
+	line(1, 1, 0);  // 90 degrees
+	EXPECT_EQ(planned(), 1);
+
+	// 0.5mm segments on a 100mm radius arc turn by 0.3 degrees each, well
+	// within the angle limit, so the chord error decides where runs end
+	const float r = 100, cx = 1 - r, cy = 1;
+	int moves = 0;
+	for (float a = 0.005; a < 0.2; a += 0.005, moves++) line(cx + r * cos(a), cy + r * sin(a), 0);
+	SegmentMerge__Flush();
+	int blocks = planned() - 1; // The arc and the move up to it, which it continues
+	EXPECT_GT(blocks, 2);
+	EXPECT_LT(blocks, moves / 3);
+
+	// No longer than the chord whose sagitta is the tolerance, plus a move
+	float angle = 2 * acos(1 - SEGMENT_MERGE_TOLERANCE / r);
+	EXPECT_LE(last_block()->millimeters, 2 * r * sin(angle / 2) + 0.5);
+}
+
+TEST_F(segment_merge_test, extrusion_per_mm_must_match)
+{
+	prime();
+	line(1, 0, 0.05);
+	line(2, 0, 0.10);
+	line(3, 0, 0.16);  // 20% more
+	line(4, 0, 0.16);  // Travel
+	line(5, 0, 0.16);
+	SegmentMerge__Flush();
+	EXPECT_EQ(planned(), 3);
+}
+
+TEST_F(segment_merge_test, short_planner_plans_right_away)
+{
+	line(1, 0, 0);
+	line(2, 0, 0);
+	EXPECT_EQ(movesplanned(), 2);
+	EXPECT_EQ(SegmentMerge__Held(), 0);
+}
+
+TEST_F(segment_merge_test, update_plans_the_held_move_when_the_planner_runs_low)
+{
+	prime();
+	line(1, 0, 0);
+	line(2, 0, 0);
+	SegmentMerge__Update();
+	EXPECT_EQ(planned(), 0);
+
+	while (movesplanned() >= SEGMENT_MERGE_MIN_BLOCKS) plan_discard_current_block();
+	queued = movesplanned();
+	SegmentMerge__Update();
+	EXPECT_EQ(planned(), 1);
+	EXPECT_NEAR(last_block()->millimeters, 2, 0.01);
+}
+
+TEST_F(segment_merge_test, quick_stop_drops_the_held_move)
+{
+	prime();
+	line(1, 0, 0);
+	quickStop();
+	EXPECT_EQ(SegmentMerge__Held(), 0);
+	SegmentMerge__Flush();
+	EXPECT_EQ(movesplanned(), 0);
+}
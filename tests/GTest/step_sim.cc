@@ -0,0 +1,307 @@
+/**
+ * step_sim.cc - Host-native simulator for the motion core (planner + stepper).
+ *
+ * Replays the G0/G1 moves of a G-code file through plan_buffer_line() and
+ * services ISR(TIMER1_COMPA_vect) from a virtual Timer1 clock. Planning takes
+ * no virtual time; the stepper interrupt runs whenever the planner waits for a
+ * free block and until the buffer drains, so the step stream is the one the
+ * firmware would produce with a full look-ahead buffer.
+ *
+ * Reports per-axis step counts and peak step rates (per motor, so X and Y are
+ * the A and B motors on COREXY), the distribution of OCR1A intervals (the
+ * step rate the ISR asked for) and a histogram of ISR durations. Durations are
+ * measured on the host and are only meaningful relative to each other, not
+ * as AVR cycle counts.
+ *
+ * Usage: step_sim <file.gcode> [steps.csv] [--blocks blocks.csv] [--compare reference.csv]
+ *   steps.csv receives one "tick,axis,direction" line per step, where a tick
+ *   is one Timer1 count (0.5us at 16MHz).
+ *   --blocks writes one "block,x,y,z,e,ticks" line per block: the steps of
+ *   each motor and the Timer1 ticks of the intervals the ISR programmed while
+ *   running it.
+ *   --compare checks the blocks against such a file, written by an earlier
+ *   build: steps must match exactly and times within COMPARE_BLOCK_TOLERANCE
+ *   and COMPARE_TOTAL_TOLERANCE. The exit status is 1 if they do not.
+ *   gcode/step_sim.blocks.csv holds the blocks of gcode/step_sim.gcode as
+ *   the time based ramps (v = u + at) ran them, before the distance based
+ *   ones (v^2 = u^2 + 2as), which ramp up from rest slightly slower.
+ *
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/planner.h"
+#include "../../Marlin/stepper.h"
+#include "../../Marlin/temperature.h"
+#include "mocks/hardware.h"
+#include "mocks/firmware.h"
+
+extern "C" void TIMER1_COMPA_vect(void);
+extern volatile long count_position[NUM_AXIS];
+
+//===========================================================================
+//============================ Stepper ISR driver ===========================
+//===========================================================================
+
+#define DURATION_BUCKETS 16 // Power-of-two buckets starting at 32ns
+#define INTERVAL_BUCKETS 8
+#define COMPARE_BLOCK_TOLERANCE 0.10 // Of each block's time
+#define COMPARE_TOTAL_TOLERANCE 0.01 // Of the total
+
+static const uint16_t interval_limits[INTERVAL_BUCKETS] = { 100, 200, 400, 800, 1600, 3200, 6400, 0xFFFF };
+static const char axis_codes[NUM_AXIS] = { 'X', 'Y', 'Z', 'E' };
+
+static unsigned long duration_histogram[DURATION_BUCKETS];
+static unsigned long interval_histogram[INTERVAL_BUCKETS];
+static unsigned long isr_count = 0;
+static unsigned long step_count[NUM_AXIS];
+static uint64_t last_step_tick[NUM_AXIS];
+static unsigned long peak_step_rate[NUM_AXIS];
+static std::ofstream step_log;
+
+struct BlockRecord {
+  long steps[NUM_AXIS];
+  uint64_t ticks;
+};
+static std::vector<BlockRecord> blocks;
+static BlockRecord running;
+
+/**
+ * Service one Timer1 compare match at the current virtual time and advance
+ * the clock to the next one, as programmed by the ISR in OCR1A.
+ */
+static void StepSim__Tick() {
+  if (!TEST(TIMSK1, OCIE1A)) {
+    Hardware__AdvanceTicks(2000);
+    return;
+  }
+
+  long before[NUM_AXIS];
+  for (uint8_t i = 0; i < NUM_AXIS; i++) before[i] = count_position[i];
+  uint8_t tail = block_buffer_tail;
+
+  TCNT1 = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  TIMER1_COMPA_vect();
+  long nanos = (long)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+  uint8_t bucket = 0;
+  while (bucket < DURATION_BUCKETS - 1 && nanos >= (32L << bucket)) bucket++;
+  duration_histogram[bucket]++;
+  isr_count++;
+
+  uint64_t now = Hardware__Ticks();
+  bool stepped = false;
+  for (uint8_t i = 0; i < NUM_AXIS; i++) {
+    long delta = count_position[i] - before[i];
+    long steps = labs(delta);
+    if (!steps) continue;
+    stepped = true;
+    running.steps[i] += steps;
+    // With step_loops > 1 several steps share one interrupt, so rate = steps / interval
+    if (step_count[i] && now > last_step_tick[i]) {
+      unsigned long rate = (unsigned long)(steps * HARDWARE_TICKS_PER_SECOND / (now - last_step_tick[i]));
+      if (rate > peak_step_rate[i]) peak_step_rate[i] = rate;
+    }
+    last_step_tick[i] = now;
+    step_count[i] += steps;
+    if (step_log.is_open())
+      for (long s = 0; s < steps; s++)
+        step_log << now << ',' << axis_codes[i] << ',' << (delta > 0 ? 1 : -1) << '\n';
+  }
+
+  uint16_t interval = OCR1A;
+  uint8_t slot = 0;
+  while (interval > interval_limits[slot]) slot++;
+  interval_histogram[slot]++;
+  Hardware__AdvanceTicks(interval);
+
+  if (stepped) running.ticks += interval;
+  if (block_buffer_tail != tail) {
+    blocks.push_back(running);
+    running = BlockRecord();
+  }
+}
+
+// plan_buffer_line() calls idle() while it waits for a free block
+void idle() { StepSim__Tick(); }
+
+//===========================================================================
+//============================== G-code replay ==============================
+//===========================================================================
+
+static float destination[NUM_AXIS];
+static float feedrate = 1500.0;
+static bool relative_mode = false;
+static bool relative_e = false;
+
+static bool StepSim__Parameter(const std::string& line, char code, float& value) {
+  size_t pos = line.find(code);
+  if (pos == std::string::npos) return false;
+  value = strtod(line.c_str() + pos + 1, NULL);
+  return true;
+}
+
+static void StepSim__Line(std::string line) {
+  line = line.substr(0, line.find(';'));
+  for (size_t i = 0; i < line.size(); i++) line[i] = toupper(line[i]);
+  float code;
+  if (StepSim__Parameter(line, 'G', code)) {
+    int g = (int)code;
+    if (g == 0 || g == 1) {
+      float value;
+      for (uint8_t i = 0; i < NUM_AXIS; i++)
+        if (StepSim__Parameter(line, axis_codes[i], value))
+          destination[i] = (relative_mode || (i == E_AXIS && relative_e)) ? destination[i] + value : value;
+      if (StepSim__Parameter(line, 'F', value) && value > 0) feedrate = value;
+      plan_buffer_line(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS], feedrate / 60.0, 0);
+    }
+    else if (g == 28) {
+      for (uint8_t i = 0; i < NUM_AXIS; i++) destination[i] = 0;
+      st_synchronize();
+      plan_set_position(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS]);
+    }
+    else if (g == 90) relative_mode = false;
+    else if (g == 91) relative_mode = true;
+    else if (g == 92) {
+      float value;
+      for (uint8_t i = 0; i < NUM_AXIS; i++)
+        if (StepSim__Parameter(line, axis_codes[i], value)) destination[i] = value;
+      st_synchronize();
+      plan_set_position(destination[X_AXIS], destination[Y_AXIS], destination[Z_AXIS], destination[E_AXIS]);
+    }
+  }
+  else if (StepSim__Parameter(line, 'M', code)) {
+    if ((int)code == 82) relative_e = false;
+    else if ((int)code == 83) relative_e = true;
+  }
+}
+
+static void StepSim__Report() {
+  std::cout << "Virtual time: " << (Hardware__Ticks() / (double)HARDWARE_TICKS_PER_SECOND) << " s, "
+            << isr_count << " stepper interrupts" << std::endl;
+
+  std::cout << "Steps per axis:" << std::endl;
+  for (uint8_t i = 0; i < NUM_AXIS; i++) {
+    std::cout << "  " << axis_codes[i] << ": " << step_count[i];
+    if (peak_step_rate[i]) std::cout << " steps, peak " << peak_step_rate[i] << " steps/s";
+    std::cout << std::endl;
+  }
+
+  std::cout << "OCR1A interval (ticks):" << std::endl;
+  for (uint8_t i = 0; i < INTERVAL_BUCKETS; i++)
+    std::cout << "  <= " << interval_limits[i] << ": " << interval_histogram[i] << std::endl;
+
+  std::cout << "ISR duration (host ns):" << std::endl;
+  for (uint8_t i = 0; i < DURATION_BUCKETS; i++)
+    if (duration_histogram[i])
+      std::cout << "  < " << (32L << i) << ": " << duration_histogram[i] << std::endl;
+}
+
+static void StepSim__WriteBlocks(const char* path) {
+  std::ofstream out(path);
+  for (size_t b = 0; b < blocks.size(); b++) {
+    out << b;
+    for (uint8_t i = 0; i < NUM_AXIS; i++) out << ',' << blocks[b].steps[i];
+    out << ',' << blocks[b].ticks << '\n';
+  }
+}
+
+/**
+ * Compare the blocks run with those of a --blocks file
+ * @returns  true if they match
+ */
+static bool StepSim__Compare(const char* path) {
+  std::ifstream in(path);
+  if (!in) {
+    std::cerr << "Cannot open " << path << std::endl;
+    return false;
+  }
+  std::vector<BlockRecord> reference;
+  std::string line;
+  while (std::getline(in, line)) {
+    BlockRecord record;
+    unsigned long long ticks;
+    if (sscanf(line.c_str(), "%*u,%ld,%ld,%ld,%ld,%llu", &record.steps[X_AXIS], &record.steps[Y_AXIS],
+               &record.steps[Z_AXIS], &record.steps[E_AXIS], &ticks) != 5) continue;
+    record.ticks = ticks;
+    reference.push_back(record);
+  }
+
+  bool match = true;
+  if (reference.size() != blocks.size()) {
+    std::cout << "Blocks: " << blocks.size() << ", reference " << reference.size() << std::endl;
+    match = false;
+  }
+  uint64_t total = 0, reference_total = 0;
+  double worst = 0;
+  size_t worst_block = 0;
+  for (size_t b = 0; b < blocks.size() && b < reference.size(); b++) {
+    for (uint8_t i = 0; i < NUM_AXIS; i++)
+      if (blocks[b].steps[i] != reference[b].steps[i]) {
+        std::cout << "Block " << b << ' ' << axis_codes[i] << ": " << blocks[b].steps[i]
+                  << " steps, reference " << reference[b].steps[i] << std::endl;
+        match = false;
+      }
+    double error = fabs((double)blocks[b].ticks - reference[b].ticks) / reference[b].ticks;
+    if (error > worst) {
+      worst = error;
+      worst_block = b;
+    }
+    total += blocks[b].ticks;
+    reference_total += reference[b].ticks;
+  }
+  double total_error = fabs((double)total - reference_total) / reference_total;
+  std::cout << "Against " << path << ": total time " << (100.0 * ((double)total - reference_total) / reference_total)
+            << "%, worst block " << worst_block << " " << (100.0 * worst) << "%" << std::endl;
+  if (worst > COMPARE_BLOCK_TOLERANCE || total_error > COMPARE_TOTAL_TOLERANCE) match = false;
+  return match;
+}
+
+int main(int argc, char** argv) {
+  const char *gcode_path = NULL, *blocks_path = NULL, *compare_path = NULL;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--blocks" && i + 1 < argc) blocks_path = argv[++i];
+    else if (arg == "--compare" && i + 1 < argc) compare_path = argv[++i];
+    else if (!gcode_path) gcode_path = argv[i];
+    else step_log.open(argv[i]);
+  }
+  if (!gcode_path) {
+    std::cerr << "Usage: " << argv[0] << " <file.gcode> [steps.csv] [--blocks blocks.csv] [--compare reference.csv]" << std::endl;
+    return 1;
+  }
+  std::ifstream gcode(gcode_path);
+  if (!gcode) {
+    std::cerr << "Cannot open " << gcode_path << std::endl;
+    return 1;
+  }
+
+  Hardware__Reset();
+  Firmware__ResetMotion();
+  plan_init();
+  st_init();
+  enable_endstops(false);
+
+  std::string line;
+  while (std::getline(gcode, line)) StepSim__Line(line);
+  while (blocks_queued()) StepSim__Tick();
+
+  StepSim__Report();
+
+  std::string output = Hardware__SerialTake();
+  if (!output.empty()) std::cout << "Firmware output:" << std::endl << output;
+
+  if (blocks_path) StepSim__WriteBlocks(blocks_path);
+  if (compare_path && !StepSim__Compare(compare_path)) return 1;
+  return 0;
+}
@@ -0,0 +1,138 @@
+#include <string>
+
+#include "gtest_marlin.h"
+#include "mocks/hardware.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/temperature.h"
+#include "../../Marlin/BinaryProtocol.h"
+#include "../../Marlin/Telemetry.h"
+
+//===========================================================================
+//================ Firmware stand-ins (temperature, laser ADC) ==============
+//===========================================================================
+
+const char errormagic[] PROGMEM = "Error:";
+
+float current_temperature_bed = 0;
+float current_pneumatic = 0;     // psi * 10
+float current_regulator = 0;     // psi * 10
+
+static uint16_t adc_count = 0;
+static uint16_t adc_value = 0;
+
+uint16_t ADC_sampler_count(void) { return adc_count; }
+uint16_t ADC_sampler_latest(void) { return adc_value; }
+uint16_t ADC_sampler_filtered(void) { return adc_value; }
+uint16_t get_dist_from_raw(uint16_t val_raw) { return val_raw * 2; }
+
+void idle() {}
+
+//===========================================================================
+//================================= Helpers =================================
+//===========================================================================
+
+static int16_t value_at(const std::string& frame, int index)
+{
+	// Sync, seq, type, length, mask, time stamp (index -1)
+	int at = 7 + 2 * index;
+	return (int16_t)((uint8_t)frame[at] | (uint8_t)frame[at + 1] << 8);
+}
+
+class telemetry_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		customizedSerial.begin(BAUDRATE);
+		customizedSerial.flush();
+		BinaryProtocol__SetEnabled(false);
+		for (uint8_t e = 0; e < EXTRUDERS; e++) current_temperature[e] = 200 + e + 0.25;
+		current_temperature_bed = 60.04;
+		current_pneumatic = 401;
+		current_regulator = 198;
+		regulator_setpoint = 20;
+		adc_count = 100;
+		adc_value = 2500;
+		Telemetry__Configure(0, 0);
+		Hardware__SerialTake();
+	}
+};
+
+TEST_F(telemetry_test, off_until_configured)
+{
+	Hardware__AdvanceMs(5000);
+	Telemetry__Update();
+	EXPECT_EQ(Hardware__SerialTake(), "");
+}
+
+TEST_F(telemetry_test, line_holds_the_selected_channels)
+{
+	Hardware__AdvanceMs(1234);
+	Telemetry__Configure(100, TELEMETRY_HOTENDS | TELEMETRY_TANK | TELEMETRY_REGULATOR);
+	Telemetry__Update();
+	EXPECT_EQ(Hardware__SerialTake(), "TM:1234 T0:200.3 T1:201.3 T2:202.3 P:40.1 R:19.8/20.0\n");
+
+	Telemetry__Configure(100, TELEMETRY_BED | TELEMETRY_LASER);
+	Telemetry__Update();
+	EXPECT_EQ(Hardware__SerialTake(), "TM:1234 B:60.0 L:5000\n");
+}
+
+TEST_F(telemetry_test, reports_once_per_interval)
+{
+	Telemetry__Configure(250, TELEMETRY_BED);
+	int reports = 0;
+	for (int ms = 0; ms < 1000; ms++) {
+		Telemetry__Update();
+		if (Hardware__SerialTake() != "") reports++;
+		Hardware__AdvanceMs(1);
+	}
+	EXPECT_EQ(reports, 4);
+
+	// A long command does not cause a burst of late reports afterwards
+	Hardware__AdvanceMs(2000);
+	Telemetry__Update();
+	Telemetry__Update();
+	EXPECT_NE(Hardware__SerialTake(), "");
+	Hardware__AdvanceMs(249);
+	Telemetry__Update();
+	EXPECT_EQ(Hardware__SerialTake(), "");
+}
+
+TEST_F(telemetry_test, short_intervals_and_missing_channels_are_limited)
+{
+	Telemetry__Configure(1, 0xFF);
+	EXPECT_EQ(Telemetry__GetInterval(), TELEMETRY_MIN_INTERVAL);
+	EXPECT_EQ(Telemetry__GetChannels(), TELEMETRY_HOTENDS | TELEMETRY_BED | TELEMETRY_TANK
+	                                    | TELEMETRY_REGULATOR | TELEMETRY_LASER);
+}
+
+TEST_F(telemetry_test, binary_mode_sends_frames)
+{
+	BinaryProtocol__SetEnabled(true);
+	Hardware__AdvanceMs(70000);
+	Telemetry__Configure(100, TELEMETRY_HOTENDS | TELEMETRY_REGULATOR | TELEMETRY_LASER);
+	Telemetry__Update();
+	std::string frame = Hardware__SerialTake();
+
+	ASSERT_EQ(frame.size(), 4 + 3 + 2 * (EXTRUDERS + 3) + 2u);
+	EXPECT_EQ((uint8_t)frame[0], BINARY_FRAME_SYNC);
+	EXPECT_EQ((uint8_t)frame[2], BINARY_FRAME_TELEMETRY);
+	EXPECT_EQ((uint8_t)frame[4], TELEMETRY_HOTENDS | TELEMETRY_REGULATOR | TELEMETRY_LASER);
+	EXPECT_EQ((uint16_t)value_at(frame, -1), (uint16_t)70000);
+	EXPECT_EQ(value_at(frame, 0), 2003);
+	EXPECT_EQ(value_at(frame, EXTRUDERS), 198);
+	EXPECT_EQ(value_at(frame, EXTRUDERS + 1), 200);
+	EXPECT_EQ(value_at(frame, EXTRUDERS + 2), 5000);
+
+	uint16_t crc = 0xFFFF;
+	for (size_t i = 1; i < frame.size() - 2; i++) crc = BinaryProtocol__Crc16(crc, frame[i]);
+	EXPECT_EQ((uint8_t)frame[frame.size() - 2], crc & 0xFF);
+	EXPECT_EQ((uint8_t)frame[frame.size() - 1], crc >> 8);
+
+	// The next frame counts up
+	Hardware__AdvanceMs(100);
+	Telemetry__Update();
+	EXPECT_EQ((uint8_t)Hardware__SerialTake()[1], (uint8_t)frame[1] + 1);
+	BinaryProtocol__SetEnabled(false);
+}
@@ -0,0 +1,109 @@
+/**
+ * thermistor_bench.cc - Host benchmark of the thermistor table conversion.
+ *
+ * Converts every raw sum from 0 to 16383 on the hot end and bed tables of
+ * Configuration.h with the linear table scan analog2temp() used before and
+ * with temptable_lookup(), and reports for each the host time per conversion,
+ * the table rows read per conversion and the largest difference between the
+ * two. Times are only meaningful relative to each other; the row counts are
+ * what tracks the AVR cost, as each row read is a pair of flash loads.
+ *
+ * Fails if the two conversions differ by more than MAX_ERROR degrees.
+ *
+ * Copyright (C) 2016 Voxel8
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "../../Marlin/Marlin.h"
+
+#define MAX_ERROR 0.01
+#define RAW_COUNT 16384
+#define REPEATS   20
+
+// Counts the rows read by either conversion
+static unsigned long rows_read;
+
+//===========================================================================
+//============================ Conversions ==================================
+//===========================================================================
+
+// The linear scan analog2temp() used before temptable_lookup()
+static float scan(const short (*table)[2], uint8_t length, int raw) {
+  float celsius = 0;
+  uint8_t i;
+  for (i = 1; i < length; i++) {
+    rows_read++;
+    if (table[i][0] > raw) {
+      celsius = table[i-1][1] + (raw - table[i-1][0]) *
+        (float)(table[i][1] - table[i-1][1]) / (float)(table[i][0] - table[i-1][0]);
+      break;
+    }
+  }
+  if (i == length) celsius = table[i-1][1];
+  return celsius;
+}
+
+static float lookup(const short (*table)[2], const float *slopes, uint8_t length, int raw) {
+  // At most one row per halving, and the one the value is read from
+  for (uint8_t n = length; n > 1; n = (n + 1) >> 1) rows_read++;
+  rows_read++;
+  return temptable_lookup(table, slopes, length, raw);
+}
+
+//===========================================================================
+//============================ Benchmark ====================================
+//===========================================================================
+
+typedef struct {
+  double ns;      // Per conversion
+  double rows;    // Per conversion
+  float value[RAW_COUNT];
+} Result;
+
+static Result scan_result, lookup_result;
+
+template <typename F> static void run(F convert, Result *result) {
+  rows_read = 0;
+  float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < REPEATS; r++)
+    for (int raw = 0; raw < RAW_COUNT; raw++)
+      sink += result->value[raw] = convert(raw);
+  auto end = std::chrono::steady_clock::now();
+  result->ns = std::chrono::duration<double, std::nano>(end - start).count() / (REPEATS * RAW_COUNT);
+  result->rows = (double)rows_read / (REPEATS * RAW_COUNT);
+  if (sink == 12345.678f) printf(" ");  // Keeps the loop from being dropped
+}
+
+static bool bench(const char *name, int sensor, const short (*table)[2], const float *slopes, uint8_t length) {
+  run([=](int raw) { return scan(table, length, raw); }, &scan_result);
+  run([=](int raw) { return lookup(table, slopes, length, raw); }, &lookup_result);
+
+  float max_error = 0;
+  int max_raw = 0;
+  for (int raw = 0; raw < RAW_COUNT; raw++) {
+    float error = fabs(lookup_result.value[raw] - scan_result.value[raw]);
+    if (error > max_error) { max_error = error; max_raw = raw; }
+  }
+
+  printf("%s %d (%d entries)\n", name, sensor, length);
+  printf("  scan:   %6.1f ns  %5.1f rows\n", scan_result.ns, scan_result.rows);
+  printf("  lookup: %6.1f ns  %5.1f rows\n", lookup_result.ns, lookup_result.rows);
+  printf("  max error %.5f C at raw %d\n", max_error, max_raw);
+  return max_error <= MAX_ERROR;
+}
+
+int main() {
+  bool ok = true;
+  #if ENABLED(HEATER_0_USES_THERMISTOR)
+    ok &= bench("TEMP_SENSOR_0", THERMISTORHEATER_0, HEATER_0_TEMPTABLE, HEATER_0_TEMPSLOPES, HEATER_0_TEMPTABLE_LEN);
+  #endif
+  #if ENABLED(BED_USES_THERMISTOR)
+    ok &= bench("TEMP_SENSOR_BED", THERMISTORBED, BEDTEMPTABLE, BEDTEMPSLOPES, BEDTEMPTABLE_LEN);
+  #endif
+  if (!ok) printf("FAIL: lookup differs from the table scan by more than %.2f C\n", MAX_ERROR);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+#include "gtest_marlin.h"
+#include "../../Marlin/Marlin.h"
+#include "../../Marlin/TwiQueue.h"
+#include "../../Marlin/MCP4725.h"
+#include "../../Marlin/Voxel8_I2C_Commands.h"
+#include "mocks/hardware.h"
+
+void idle() {}
+
+static uint8_t callback_status;
+static int callback_count;
+
+static void on_done(uint8_t status)
+{
+	callback_status = status;
+	callback_count++;
+}
+
+class twi_queue_test : public ::testing::Test
+{
+	protected:
+	virtual void SetUp()
+	{
+		Hardware__Reset();
+		TwiQueue__Init();
+		callback_count = 0;
+	}
+	virtual void TearDown()
+	{
+		EXPECT_FALSE(TwiQueue__Busy());
+	}
+};
+
+TEST_F(twi_queue_test, dac_writes_are_sent_in_order)
+{
+	MockTwiDevice dac;
+	Hardware__TwiAttach(MCP4725_I2C_ADDRESS, &dac);
+
+	DAC_write(MCP4725_I2C_ADDRESS, 0xABC);
+	DAC_write(MCP4725_I2C_ADDRESS, 0x123);
+	EXPECT_EQ(dac.written, std::string("\x40\xAB\xC0\x40\x12\x30", 6));
+}
+
+TEST_F(twi_queue_test, read_follows_write_after_repeated_start)
+{
+	MockTwiDevice adc;
+	adc.response = std::string("\x85\x83", 2);
+	Hardware__TwiAttach(0x48, &adc);
+
+	const uint8_t reg = 0x01;
+	uint8_t rx[2] = { 0, 0 };
+	volatile uint8_t status;
+	ASSERT_TRUE(TwiQueue__Transfer(0x48, &reg, 1, rx, 2, &status, on_done));
+	EXPECT_EQ(TwiQueue__Wait(&status), TWI_STATUS_OK);
+	EXPECT_EQ(adc.written, std::string("\x01", 1));
+	EXPECT_EQ(rx[0], 0x85);
+	EXPECT_EQ(rx[1], 0x83);
+	EXPECT_EQ(callback_count, 1);
+	EXPECT_EQ(callback_status, TWI_STATUS_OK);
+}
+
+TEST_F(twi_queue_test, missing_device_does_not_hold_up_the_queue)
+{
+	MockTwiDevice dac;
+	Hardware__TwiAttach(MCP4725_I2C_ADDRESS, &dac);
+
+	uint8_t rx;
+	volatile uint8_t status;
+	TwiQueue__Transfer(CART0_ADDR, NULL, 0, &rx, 1, &status, NULL);
+	DAC_write(MCP4725_I2C_ADDRESS, 0);
+	EXPECT_EQ(TwiQueue__Wait(&status), TWI_STATUS_NACK);
+	EXPECT_EQ(dac.written.size(), 3u);
+}
+
+TEST_F(twi_queue_test, stuck_bus_times_out)
+{
+	MockTwiDevice dac;
+	Hardware__TwiAttach(MCP4725_I2C_ADDRESS, &dac);
+	Hardware__TwiStall(true);
+
+	// Queuing returns even though nothing moves on the bus
+	volatile uint8_t status;
+	const uint8_t packet[3] = { 0x40, 0, 0 };
+	TwiQueue__Transfer(MCP4725_I2C_ADDRESS, packet, 3, NULL, 0, &status, NULL);
+	EXPECT_TRUE(TwiQueue__Busy());
+	EXPECT_EQ(status, TWI_STATUS_PENDING);
+
+	TwiQueue__Update();
+	EXPECT_EQ(status, TWI_STATUS_PENDING);
+	Hardware__AdvanceMs(TWI_TIMEOUT + 1);
+	TwiQueue__Update();
+	EXPECT_EQ(status, TWI_STATUS_TIMEOUT);
+	EXPECT_TRUE(dac.written.empty());
+
+	// The bus works again once released
+	Hardware__TwiStall(false);
+	DAC_write(MCP4725_I2C_ADDRESS, 0x800);
+	EXPECT_EQ(dac.written, std::string("\x40\x80\x00", 3));
+}
+
+TEST_F(twi_queue_test, cartridge_serial_is_read_and_printed)
+{
+	MockTwiDevice cartridge;
+	// Programmer station, type, serial number
+	cartridge.response = std::string("\x03\x01\x00\x2A", 4);
+	Hardware__TwiAttach(CART0_ADDR, &cartridge);
+	Hardware__SerialTake();
+
+	I2C__GetSerial(CART0_ADDR);
+	EXPECT_EQ(cartridge.written, std::string("\x08\xFF\xFF", 3));
+	EXPECT_EQ(Hardware__SerialTake(), "Serial Number = 130042\n\n");
+}